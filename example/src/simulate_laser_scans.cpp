@@ -18,6 +18,7 @@ using francor::vision::ColourSpace;
 using francor::base::Pose2d;
 using francor::base::Point2d;
 using francor::base::Point2dVector;
+using francor::base::BufferHandle;
 using francor::base::Transform2d;
 using francor::base::LogError;
 using francor::base::LogInfo;
@@ -153,7 +154,7 @@ bool processStep(const Vector2d& delta_position)
   out.transformTo(ColourSpace::BGR);
   drawPoseOnImage(_ego.pose(), out);
   drawLaserScanOnImage(pipeline.output(PipeSimulateLaserScan::OUT_SCAN).data<LaserScan>(), out);
-  drawPointsOnImage(pipeline.output(PipeSimulateLaserScan::OUT_POINTS).data<Point2dVector>(), out);
+  drawPointsOnImage(*pipeline.output(PipeSimulateLaserScan::OUT_POINTS).data<BufferHandle<Point2dVector>>(), out);
   cv::imshow("occupancy grid", out.cvMat());
   cv::waitKey(10);
   francor::vision::saveImageToFile("/tmp/occupancy_grid.png", out);
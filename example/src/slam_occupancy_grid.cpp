@@ -24,6 +24,7 @@ using francor::vision::ColourSpace;
 using francor::base::Pose2d;
 using francor::base::Point2d;
 using francor::base::Point2dVector;
+using francor::base::BufferHandle;
 using francor::base::Transform2d;
 using francor::base::LogError;
 using francor::base::LogInfo;
@@ -263,7 +264,7 @@ bool processStep(const Vector2d& delta_position)
   out_grid.transformTo(ColourSpace::BGR);
   drawPose(_ego.pose(), out_grid);
   drawLaserScanOnImage(*std::static_pointer_cast<LaserScan>(scan), out_grid);
-  const auto& points = _pipe_localize.output(PipeLocalizeOnOccupancyGrid::OUT_POINTS).data<Point2dVector>();
+  const auto& points = *_pipe_localize.output(PipeLocalizeOnOccupancyGrid::OUT_POINTS).data<BufferHandle<Point2dVector>>();
   // francor::base::algorithm::point::convertLaserScanToPoints(scan, _ego_ground_truth.pose(), points);
   drawPointsOnImage(points, out_grid);
   cv::Mat scaled;
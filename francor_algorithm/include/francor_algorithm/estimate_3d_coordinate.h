@@ -8,6 +8,12 @@
 
 #include "francor_base/vector.h"
 #include "francor_base/matrix.h"
+#include "francor_base/point.h"
+#include "francor_base/line_segment.h"
+#include "francor_base/span.h"
+
+#include <cstddef>
+#include <vector>
 
 namespace francor
 {
@@ -18,21 +24,102 @@ namespace algorithm
 /**
  * \brief Estimates the postion of an pixel on the ground plane based on the intrinsic camera parameters and
  *        the pose of the camera (extrinsic).
- * 
+ *
  * \param intrinsic The intrinsic camera parameters [ [ fx 0 cx ], [ 0 fy cy ] [ 0 0 1 ] ].
- * \param extrinsic The camera pose as homogene transformation matrix.
+ * \param extrinsic The camera pose as homogene transformation matrix. The camera looks along its z axis, x points to
+ *                  the right and y downwards in the image. The ground plane is z = 0.
  * \param input The 2d pixel coordinate.
  * \param output The estimated 3d coordinate.
- * \return true if estimation was successfully.
+ * \return true if estimation was successfully, false if the ray of the pixel doesn't hit the ground plane.
  */
 bool estimate3dCoordinateOnGroundplane(const base::Matrix3d& intrinsic,
                                        const base::Matrix4d& extrinsic,
                                        const base::Vector2d& input,
-                                       base::Vector3d& output)
+                                       base::Vector3d& output);
+
+/**
+ * \brief Projects pixels of one camera onto the ground plane z = 0. The undistorted ray of each pixel is computed once
+ *        when the projector is initialized, so projecting a pixel is a table lookup and a ray plane intersection. The
+ *        pose of the camera can change each frame without touching the table.
+ */
+class GroundPlaneProjector
 {
+public:
+  /**
+   * \brief Distortion coefficients [ k1 k2 p1 p2 k3 ] like used by opencv.
+   */
+  using Distortion = base::VectorX<double, 5>;
+  using Pixel = base::Point2<unsigned int>;
+
+  GroundPlaneProjector(void) = default;
+
+  /**
+   * \brief Computes the ray of each pixel of an image of the given size.
+   *
+   * \param intrinsic The intrinsic camera parameters [ [ fx 0 cx ], [ 0 fy cy ] [ 0 0 1 ] ].
+   * \param width Number of columns of the camera image.
+   * \param height Number of rows of the camera image.
+   * \param distortion Lens distortion coefficients, zero for a pinhole camera.
+   * \return true if the projector was successfully initialized.
+   */
+  bool initialize(const base::Matrix3d& intrinsic, const std::size_t width, const std::size_t height,
+                  const Distortion& distortion = Distortion::Zero());
+  inline bool isInitialized(void) const noexcept { return _width > 0 && _height > 0; }
+  inline std::size_t width(void) const noexcept { return _width; }
+  inline std::size_t height(void) const noexcept { return _height; }
+
+  /**
+   * \brief Sets the pose of the camera. See estimate3dCoordinateOnGroundplane() for the convention.
+   */
+  void setExtrinsic(const base::Matrix4d& extrinsic);
+  inline const base::Matrix4d& extrinsic(void) const noexcept { return _extrinsic; }
+
+  /**
+   * \brief Projects one pixel onto the ground plane. Sub pixel coordinates are interpolated in the ray table.
+   *
+   * \param pixel Pixel coordinate, x is the column and y the row.
+   * \param point Point on the ground plane.
+   * \return true if the ray of the pixel hits the ground plane.
+   */
+  bool project(const base::Point2d& pixel, base::Point2d& point) const;
+
+  /**
+   * \brief Projects a batch of pixels, e.g. the contour of a cluster. Pixels whose ray doesn't hit the ground plane or
+   *        that are outside of the image are projected to NaN, so the output keeps the order and size of the input.
+   *
+   * \param pixels Pixel coordinates, x is the column and y the row.
+   * \param points Points on the ground plane. Will be resized to the number of pixels.
+   * \return Number of pixels that hit the ground plane.
+   */
+  std::size_t project(const base::Span<const Pixel> pixels, base::Point2dVector& points) const;
+  std::size_t project(const base::Point2dVector& pixels, base::Point2dVector& points) const;
+  std::size_t project(const base::VectorVector2d& pixels, base::Point2dVector& points) const;
+
+  /**
+   * \brief Projects line segments, e.g. detected lane markings. A straight line in the image is a straight line on
+   *        the ground plane, so only the end points are projected. Segments with an end point that doesn't hit the
+   *        ground plane are dropped.
+   *
+   * \param segments Line segments in pixel coordinates.
+   * \param projected Line segments on the ground plane. Will be cleared first.
+   * \return Number of projected line segments.
+   */
+  std::size_t project(const base::LineSegmentVector& segments, base::LineSegmentVector& projected) const;
+
+private:
+  template <typename FetchRay>
+  std::size_t projectRays(const std::size_t count, FetchRay fetch_ray, base::Point2d* points) const;
+  void fetchRay(const double x, const double y, double& ray_x, double& ray_y) const;
+
+  std::size_t _width = 0;
+  std::size_t _height = 0;
+  // normalized and undistorted image coordinates of each pixel, the ray is (x, y, 1) in the camera frame
+  std::vector<float> _ray_x;
+  std::vector<float> _ray_y;
 
-}
+  base::Matrix4d _extrinsic = base::Matrix4d::Identity();
+};
 
 } // end namespace algorithm
 
-} // end namespace francor
\ No newline at end of file
+} // end namespace francor
@@ -30,6 +30,11 @@ double estimateTransform(const base::Point2dVector& dataset_a,
                          const PointPairIndexVector& pair_indices,
                          const double max_distance,
                          base::Transform2d& transform);
+double estimateTransform(const base::Point2fVector& dataset_a,
+                         const base::Point2fVector& dataset_b,
+                         const PointPairIndexVectorf& pair_indices,
+                         const double max_distance,
+                         base::Transform2f& transform);
 
 } // end namespace algorithm
 
@@ -27,28 +27,36 @@ namespace francor {
 
 namespace algorithm {
 
-class FlannPointPairEstimator final : public PointPairEstimator
+namespace impl {
+
+template <typename Type>
+class FlannPointPairEstimator final : public PointPairEstimator<Type>
 {
 public:
   FlannPointPairEstimator();
   ~FlannPointPairEstimator() final;
 
-  bool setPointDataset(const base::Point2dVector& points) final;
-  bool findPairs(const base::Point2dVector& points, PointPairIndexVector& pairs) final;
+  bool setPointDataset(const base::Point2Vector<Type>& points) final;
+  bool findPairs(const base::Point2Vector<Type>& points, PointPairIndexVector<Type>& pairs) final;
 
 private:
-  void copyPointDataset(const base::Point2dVector& points, std::vector<double>& dataset) const;
+  void copyPointDataset(const base::Point2Vector<Type>& points, std::vector<Type>& dataset) const;
   void copyIndexPairs(const std::vector<int>& indices,
-                      const std::vector<double>& distances,
-                      PointPairIndexVector& pairs) const;
+                      const std::vector<Type>& distances,
+                      PointPairIndexVector<Type>& pairs) const;
   bool createFlannIndex();
 
-  std::unique_ptr<flann::Index<flann::L2<double>>> _flann_index;
-  std::vector<double> _point_dataset;
+  std::unique_ptr<flann::Index<flann::L2<Type>>> _flann_index;
+  std::vector<Type> _point_dataset;
   std::vector<int> _indicies;
-  std::vector<double> _distances;  
+  std::vector<Type> _distances;  
 };
 
+} // end namespace impl
+
+using FlannPointPairEstimator = impl::FlannPointPairEstimator<double>;
+using FlannPointPairEstimatorf = impl::FlannPointPairEstimator<float>;
+
 } // end namespace algorithm
 
 } // end namespace francor
\ No newline at end of file
@@ -7,7 +7,6 @@
 #pragma once
 
 #include <memory>
-#include <functional>
 
 #include <francor_base/point.h>
 #include <francor_base/transform.h>
@@ -17,18 +16,27 @@ namespace francor {
 
 namespace algorithm {
 
-using TransformEstimationFunction = std::function<double(const base::Point2dVector& dataset_a,
-                                                         const base::Point2dVector& dataset_b,
-                                                         const PointPairIndexVector& pair_indices,
-                                                         const double max_distance,
-                                                         base::Transform2d& transform)>;
+/**
+ * \brief Function that estimates the transform between two point datasets, e.g. estimateTransform(). A plain
+ *        function pointer lets the overload of the matching scalar type be selected by name.
+ */
+template <typename Type>
+using TransformEstimationFunction = double (*)(const base::Point2Vector<Type>& dataset_a,
+                                               const base::Point2Vector<Type>& dataset_b,
+                                               const impl::PointPairIndexVector<Type>& pair_indices,
+                                               const double max_distance,
+                                               base::impl::Transform2<Type>& transform);
 
 // \todo make icp more generic
 
+namespace impl {
+
+template <typename Type>
 class Icp
 {
 public:
-  Icp(std::unique_ptr<PointPairEstimator>&& pair_estimator, const TransformEstimationFunction& transform_estimator)
+  Icp(std::unique_ptr<PointPairEstimator<Type>>&& pair_estimator,
+      const TransformEstimationFunction<Type> transform_estimator)
     : _pair_estimator(std::move(pair_estimator)),
       _transform_estimator(transform_estimator)
   { }
@@ -40,19 +48,25 @@ public:
   inline double getMaxRms() const noexcept { return _max_rms; }
   inline double getTerminationRms() const noexcept { return _termination_rms; }
 
-  bool estimateTransform(const base::Point2dVector& origin, const base::Point2dVector& target, base::Transform2d& transform) const;
+  bool estimateTransform(const base::Point2Vector<Type>& origin, const base::Point2Vector<Type>& target,
+                         base::impl::Transform2<Type>& transform) const;
 
 private:
-  bool doIteration(const base::Point2dVector& origin, const base::Point2dVector& target,
-                   base::Transform2d& transform, const double distance_threshold, double& rms) const;
+  bool doIteration(const base::Point2Vector<Type>& origin, const base::Point2Vector<Type>& target,
+                   base::impl::Transform2<Type>& transform, const double distance_threshold, double& rms) const;
 
-  std::unique_ptr<PointPairEstimator> _pair_estimator;
-  TransformEstimationFunction _transform_estimator;
+  std::unique_ptr<PointPairEstimator<Type>> _pair_estimator;
+  TransformEstimationFunction<Type> _transform_estimator;
   std::size_t _max_iterations = 100;
   double _max_rms = 1.0;
   double _termination_rms = 1.0;
 };
 
+} // end namespace impl
+
+using Icp = impl::Icp<double>;
+using Icpf = impl::Icp<float>;
+
 } // end namespace algorithm
 
 } // end namespace francor
\ No newline at end of file
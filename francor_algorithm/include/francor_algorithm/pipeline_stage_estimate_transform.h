@@ -9,6 +9,7 @@
 
 #include <francor_base/transform.h>
 #include <francor_base/point.h>
+#include <francor_base/buffer_pool.h>
 
 #include "francor_algorithm/icp.h"
 #include "francor_algorithm/flann_point_pair_estimator.h"
@@ -83,7 +84,8 @@ private:
   bool isReady() const final;
   bool validateInputData() const final;  
 
-  base::Point2dVector _resulted_points;
+  base::BufferPool<base::Point2dVector> _point_buffers;
+  base::BufferHandle<base::Point2dVector> _resulted_points;
 };
 
 
@@ -129,7 +131,7 @@ public:
   };
 
   StageExtractSensorPose()
-    : processing::ProcessingStage<processing::NoDataType>("estimate normals from ordered points", COUNT_INPUTS, COUNT_OUTPUTS)
+    : processing::ProcessingStage<processing::NoDataType>("extract sensor pose", COUNT_INPUTS, COUNT_OUTPUTS)
   { }
 
 private:
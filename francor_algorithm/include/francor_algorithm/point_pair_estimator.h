@@ -19,13 +19,20 @@ struct PointPairIndex
   float distance;
 };
 
+namespace impl {
+
+/**
+ * \brief Point pairs between two point vectors of the given scalar type. The pairs only hold indices, so they are
+ *        the same for double and float points.
+ */
+template <typename Type>
 class PointPairIndexVector : public std::vector<PointPairIndex>
 {
 public:
   PointPairIndexVector() = default;
 
-  inline void setFristPointVector(const base::Point2dVector& vector) { _first_point_vector = &vector; }
-  inline void setSecondPointVector(const base::Point2dVector& vector) { _second_point_vector = &vector; }
+  inline void setFristPointVector(const base::Point2Vector<Type>& vector) { _first_point_vector = &vector; }
+  inline void setSecondPointVector(const base::Point2Vector<Type>& vector) { _second_point_vector = &vector; }
   void clear()
   {
     std::vector<PointPairIndex>::clear();
@@ -78,11 +85,13 @@ private:
     _median_distance = distances[distances.size() / 2];
   }
 
-  const base::Point2dVector* _first_point_vector = nullptr;
-  const base::Point2dVector* _second_point_vector = nullptr;
+  const base::Point2Vector<Type>* _first_point_vector = nullptr;
+  const base::Point2Vector<Type>* _second_point_vector = nullptr;
   double _avg_distance = 0.0; //> average distance of all pairs
   double _median_distance = 0.0; //> median distance of all pairs
 };
+
+template <typename Type>
 class PointPairEstimator
 {
 protected:
@@ -91,10 +100,17 @@ protected:
 public:
   virtual ~PointPairEstimator() = default;
 
-  virtual bool setPointDataset(const base::Point2dVector& points) = 0;
-  virtual bool findPairs(const base::Point2dVector& points, PointPairIndexVector& pairs) = 0;
+  virtual bool setPointDataset(const base::Point2Vector<Type>& points) = 0;
+  virtual bool findPairs(const base::Point2Vector<Type>& points, PointPairIndexVector<Type>& pairs) = 0;
 };
 
+} // end namespace impl
+
+using PointPairIndexVector = impl::PointPairIndexVector<double>;
+using PointPairIndexVectorf = impl::PointPairIndexVector<float>;
+using PointPairEstimator = impl::PointPairEstimator<double>;
+using PointPairEstimatorf = impl::PointPairEstimator<float>;
+
 } // end namespace algorithm
 
 } // end namespace francor
@@ -107,7 +123,8 @@ inline ostream& operator<<(ostream& os, const francor::algorithm::PointPairIndex
   return os;
 }
 
-inline ostream& operator<<(ostream& os, const francor::algorithm::PointPairIndexVector& indices)
+template <typename Type>
+inline ostream& operator<<(ostream& os, const francor::algorithm::impl::PointPairIndexVector<Type>& indices)
 {
   os << "### point pair index ###" << endl;
   os << "num pairs: " << indices.size() << endl;
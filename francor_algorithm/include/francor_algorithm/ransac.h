@@ -8,6 +8,9 @@
 
 #include "francor_algorithm/ransac_target_model.h"
 
+#include <francor_base/trace.h>
+#include <francor_base/frame_arena.h>
+
 #include <random>
 #include <vector>
 
@@ -51,20 +54,25 @@ public:
    *        there aren't enough data elements left.
    * 
    * \param inputData the ransac will seach on this container. If the number of elements are too less nothing will happen.
+   * \param memoryResource used for temporaries. If nullptr the frame arena of the calling thread is used.
    * \return the found model stored in a vector. The vector size can be zero if nothing was found.
    */
   std::vector<typename Output::type>
-  operator()(const std::vector<typename Input::type>& inputData)
+  operator()(const std::vector<typename Input::type>& inputData, std::pmr::memory_resource* const memoryResource = nullptr)
   {
+    FRANCOR_TRACE_SCOPE("Ransac", "input_size", inputData.size());
     this->prepareProcessing(inputData);
     typename Output::type model;
     std::vector<typename Output::type> models;
+    base::FrameArenaScope frame;
+    std::pmr::vector<std::size_t> modelDataIndices(frame.resource(memoryResource));
 
-    while (this->process(inputData, model))
+    while (this->process(inputData, modelDataIndices, model))
     {
       models.push_back(model);
     }
     
+    FRANCOR_TRACE_ARGUMENT("models", models.size());
     return models;
   }
 
@@ -130,13 +138,13 @@ public:
   }
 
 private:
-  bool process(const std::vector<typename Input::type>& inputData, typename Output::type& foundModel)
+  bool process(const std::vector<typename Input::type>& inputData, std::pmr::vector<std::size_t>& modelDataIndices,
+               typename Output::type& foundModel)
   {
     if (inputData.size() - _count_data_used < _min_number_points)
       return false;
 
     std::size_t foundModelPoints = 0;
-    std::vector<std::size_t> modelDataIndices;
     typename Output::type model = typename Output::type();
 
     for (unsigned int iteration = 0; iteration < this->maxIterations(); ++iteration)
@@ -164,8 +172,9 @@ private:
       if (modelDataIndices.size() >= _min_number_points && modelDataIndices.size() > foundModelPoints)
       {
         foundModelPoints = modelDataIndices.size();
-        model = _target_model.fitData(inputData, modelDataIndices);
-        _index_data_to_model = std::move(modelDataIndices);
+        // the capacity was reserved by prepareProcessing(), so no allocation happens here
+        _index_data_to_model.assign(modelDataIndices.begin(), modelDataIndices.end());
+        model = _target_model.fitData(inputData, _index_data_to_model);
       }
     }
 
@@ -17,7 +17,13 @@ namespace francor {
 
 namespace algorithm {
 
-class Ray2d
+namespace impl {
+
+/**
+ * \brief Casts a ray through a 2d grid. Type is the scalar type of the position, direction and distances.
+ */
+template <typename Type>
+class Ray2
 {
 public:
   struct Operation {
@@ -30,22 +36,22 @@ public:
     };
   };
 
-  Ray2d() = default;
-  ~Ray2d() = default;
-  static Ray2d create(const std::size_t xIdx,
-                      const std::size_t yIdx,
-                      const std::size_t numCellsX,
-                      const std::size_t numcellsY,
-                      const double cellSize,
-                      const base::Point2d position,
-                      const base::Vector2d direction,
-                      const double distance);                
+  Ray2() = default;
+  ~Ray2() = default;
+  static Ray2 create(const std::size_t xIdx,
+                     const std::size_t yIdx,
+                     const std::size_t numCellsX,
+                     const std::size_t numcellsY,
+                     const Type cellSize,
+                     const base::Point2<Type> position,
+                     const base::Vector2<Type> direction,
+                     const Type distance);                
 
   class iterator
   {
   public:
     iterator() = delete;
-    iterator(const base::Vector2u& currentIdx, const base::Vector2d& sideDist, const base::Vector2d& deltaDist, const std::uint8_t operation)
+    iterator(const base::Vector2u& currentIdx, const base::Vector2<Type>& sideDist, const base::Vector2<Type>& deltaDist, const std::uint8_t operation)
       : _current_idx(currentIdx), _side_dist(sideDist), _delta_dist(deltaDist), _operation(operation)
     { }
 
@@ -97,8 +103,8 @@ public:
 
   private:
     base::Vector2u _current_idx;
-    base::Vector2d _side_dist;
-    base::Vector2d _delta_dist;
+    base::Vector2<Type> _side_dist;
+    base::Vector2<Type> _delta_dist;
     std::uint8_t _operation = Operation::NONE;
   };
 
@@ -112,7 +118,7 @@ public:
     return _operation != 0;
   }
 
-  inline Ray2d& operator++()
+  inline Ray2& operator++()
   {
     if (_side_dist.x() < _side_dist.y()) {
     // move in x direction
@@ -160,28 +166,33 @@ public:
 
   inline base::Size2u operator*() const { return {_current_idx.x(), _current_idx.y()}; }
   inline base::Size2u getCurrentIndex() const { return {_current_idx.x(), _current_idx.y()}; }
-  inline double getCurrentCellWeight() const { return 1.0; }
+  inline Type getCurrentCellWeight() const { return 1.0; }
 
 private:
   bool initialize(const std::size_t xIdx,
                   const std::size_t yIdx,
                   const std::size_t numCellsX,
                   const std::size_t numcellsY,
-                  const double cellSize,
-                  const base::Point2d position,
-                  const base::Vector2d direction,
-                  const double distance);             
+                  const Type cellSize,
+                  const base::Point2<Type> position,
+                  const base::Vector2<Type> direction,
+                  const Type distance);             
 
 
   base::Vector2u _current_idx; //> current x and y index on the map/grid
   base::Vector2u _max_idx;     //> the maximum valid index of the map/grid
-  base::Vector2d _side_dist;   //> length of ray from start position to current position
-  base::Vector2d _delta_dist;  //> length of ray from one x or y-side to next x or y-side
-  double _max_distance;        //> the maximum length of the ray. If max is reached the caster will terminate
-  double _interim_distance;    //> 
+  base::Vector2<Type> _side_dist;  //> length of ray from start position to current position
+  base::Vector2<Type> _delta_dist; //> length of ray from one x or y-side to next x or y-side
+  Type _max_distance;              //> the maximum length of the ray. If max is reached the caster will terminate
+  Type _interim_distance;          //> 
   std::uint8_t _operation = Operation::NONE;
 };
 
+} // end namespace impl
+
+using Ray2d = impl::Ray2<double>;
+using Ray2f = impl::Ray2<float>;
+
 } // end namespace algorithm
 
 } // end namespace francor
\ No newline at end of file
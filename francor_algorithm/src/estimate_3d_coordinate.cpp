@@ -0,0 +1,342 @@
+/**
+ * Estimates a 3d coordinate.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 25. April 2019
+ */
+#include "francor_algorithm/estimate_3d_coordinate.h"
+
+#include <francor_base/log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+namespace francor
+{
+
+namespace algorithm
+{
+
+namespace
+{
+
+// rays flatter than that are treated as parallel to the ground plane
+constexpr double _min_ray_slope = 1e-9;
+// number of rays that are fetched from the table before they are intersected in one go
+constexpr std::size_t _chunk_size = 256;
+
+// rotation and translation of the camera pose as plain values, taken once per batch
+struct PoseCoefficients
+{
+  PoseCoefficients(const base::Matrix4d& extrinsic)
+    : r00(extrinsic(0, 0)), r01(extrinsic(0, 1)), r02(extrinsic(0, 2)),
+      r10(extrinsic(1, 0)), r11(extrinsic(1, 1)), r12(extrinsic(1, 2)),
+      r20(extrinsic(2, 0)), r21(extrinsic(2, 1)), r22(extrinsic(2, 2)),
+      tx(extrinsic(0, 3)), ty(extrinsic(1, 3)), tz(extrinsic(2, 3))
+  { }
+
+  // intersects the ray (x, y, 1) given in the camera frame with the ground plane
+  inline bool apply(const double x, const double y, double& out_x, double& out_y) const
+  {
+    const double dx = r00 * x + r01 * y + r02;
+    const double dy = r10 * x + r11 * y + r12;
+    const double dz = r20 * x + r21 * y + r22;
+
+    // the camera must be above the ground and the ray pointing downwards; NaN rays fail here too
+    if (!(dz < -_min_ray_slope) || !(tz > 0.0))
+    {
+      out_x = std::numeric_limits<double>::quiet_NaN();
+      out_y = std::numeric_limits<double>::quiet_NaN();
+      return false;
+    }
+
+    const double scale = -tz / dz;
+    out_x = tx + scale * dx;
+    out_y = ty + scale * dy;
+    return true;
+  }
+
+  double r00, r01, r02;
+  double r10, r11, r12;
+  double r20, r21, r22;
+  double tx, ty, tz;
+};
+
+// intersects count rays with the ground plane and writes the points interleaved to output
+std::size_t intersectRays(const PoseCoefficients& pose, const double* ray_x, const double* ray_y,
+                          const std::size_t count, base::Point2d* output)
+{
+  std::size_t numValid = 0;
+  std::size_t i = 0;
+
+#if defined(__AVX2__) && defined(__FMA__)
+  if (pose.tz > 0.0)
+  {
+    const __m256d r00 = _mm256_set1_pd(pose.r00), r01 = _mm256_set1_pd(pose.r01), r02 = _mm256_set1_pd(pose.r02);
+    const __m256d r10 = _mm256_set1_pd(pose.r10), r11 = _mm256_set1_pd(pose.r11), r12 = _mm256_set1_pd(pose.r12);
+    const __m256d r20 = _mm256_set1_pd(pose.r20), r21 = _mm256_set1_pd(pose.r21), r22 = _mm256_set1_pd(pose.r22);
+    const __m256d tx = _mm256_set1_pd(pose.tx);
+    const __m256d ty = _mm256_set1_pd(pose.ty);
+    const __m256d negativeTz = _mm256_set1_pd(-pose.tz);
+    const __m256d maxSlope = _mm256_set1_pd(-_min_ray_slope);
+    const __m256d nan = _mm256_set1_pd(std::numeric_limits<double>::quiet_NaN());
+    double* const out = reinterpret_cast<double*>(output);
+
+    for (; i + 4 <= count; i += 4)
+    {
+      const __m256d x = _mm256_loadu_pd(ray_x + i);
+      const __m256d y = _mm256_loadu_pd(ray_y + i);
+      const __m256d dx = _mm256_fmadd_pd(r00, x, _mm256_fmadd_pd(r01, y, r02));
+      const __m256d dy = _mm256_fmadd_pd(r10, x, _mm256_fmadd_pd(r11, y, r12));
+      const __m256d dz = _mm256_fmadd_pd(r20, x, _mm256_fmadd_pd(r21, y, r22));
+      const __m256d valid = _mm256_cmp_pd(dz, maxSlope, _CMP_LT_OQ);
+      const __m256d scale = _mm256_div_pd(negativeTz, dz);
+      const __m256d px = _mm256_blendv_pd(nan, _mm256_fmadd_pd(scale, dx, tx), valid);
+      const __m256d py = _mm256_blendv_pd(nan, _mm256_fmadd_pd(scale, dy, ty), valid);
+
+      // [x0 x1 x2 x3] [y0 y1 y2 y3] -> [x0 y0 x1 y1] [x2 y2 x3 y3]
+      const __m256d low = _mm256_unpacklo_pd(px, py);
+      const __m256d high = _mm256_unpackhi_pd(px, py);
+      _mm256_storeu_pd(out + i * 2,     _mm256_permute2f128_pd(low, high, 0x20));
+      _mm256_storeu_pd(out + i * 2 + 4, _mm256_permute2f128_pd(low, high, 0x31));
+
+      numValid += __builtin_popcount(_mm256_movemask_pd(valid));
+    }
+  }
+#endif
+
+  for (; i < count; ++i)
+    numValid += pose.apply(ray_x[i], ray_y[i], output[i].x(), output[i].y());
+
+  return numValid;
+}
+
+// removes the lens distortion from normalized image coordinates, iterative like cv::undistortPoints()
+void undistort(const GroundPlaneProjector::Distortion& distortion, const double distorted_x, const double distorted_y,
+               double& x, double& y)
+{
+  const double k1 = distortion[0];
+  const double k2 = distortion[1];
+  const double p1 = distortion[2];
+  const double p2 = distortion[3];
+  const double k3 = distortion[4];
+
+  x = distorted_x;
+  y = distorted_y;
+
+  for (int iteration = 0; iteration < 10; ++iteration)
+  {
+    const double r2 = x * x + y * y;
+    const double inverseRadial = 1.0 / (1.0 + ((k3 * r2 + k2) * r2 + k1) * r2);
+    const double deltaX = 2.0 * p1 * x * y + p2 * (r2 + 2.0 * x * x);
+    const double deltaY = p1 * (r2 + 2.0 * y * y) + 2.0 * p2 * x * y;
+
+    x = (distorted_x - deltaX) * inverseRadial;
+    y = (distorted_y - deltaY) * inverseRadial;
+  }
+}
+
+} // end namespace
+
+bool estimate3dCoordinateOnGroundplane(const base::Matrix3d& intrinsic,
+                                       const base::Matrix4d& extrinsic,
+                                       const base::Vector2d& input,
+                                       base::Vector3d& output)
+{
+  const base::Vector3d ray(intrinsic.inverse() * base::Vector3d(input.x(), input.y(), 1.0));
+  double x, y;
+
+  if (!PoseCoefficients(extrinsic).apply(ray.x() / ray.z(), ray.y() / ray.z(), x, y))
+    return false;
+
+  output = base::Vector3d(x, y, 0.0);
+  return true;
+}
+
+bool GroundPlaneProjector::initialize(const base::Matrix3d& intrinsic, const std::size_t width,
+                                      const std::size_t height, const Distortion& distortion)
+{
+  using francor::base::LogError;
+
+  if (width == 0 || height == 0 || intrinsic(0, 0) == 0.0 || intrinsic(1, 1) == 0.0)
+  {
+    LogError() << "GroundPlaneProjector: invalid camera parameters. Can't initialize.";
+    return false;
+  }
+
+  const double fx = intrinsic(0, 0);
+  const double fy = intrinsic(1, 1);
+  const double cx = intrinsic(0, 2);
+  const double cy = intrinsic(1, 2);
+  const double skew = intrinsic(0, 1);
+
+  _width = width;
+  _height = height;
+  _ray_x.resize(width * height);
+  _ray_y.resize(width * height);
+
+  for (std::size_t row = 0; row < height; ++row)
+  {
+    for (std::size_t col = 0; col < width; ++col)
+    {
+      const double distortedY = (static_cast<double>(row) - cy) / fy;
+      const double distortedX = (static_cast<double>(col) - cx - skew * distortedY) / fx;
+      double x, y;
+
+      undistort(distortion, distortedX, distortedY, x, y);
+      _ray_x[row * width + col] = static_cast<float>(x);
+      _ray_y[row * width + col] = static_cast<float>(y);
+    }
+  }
+
+  return true;
+}
+
+void GroundPlaneProjector::setExtrinsic(const base::Matrix4d& extrinsic)
+{
+  _extrinsic = extrinsic;
+}
+
+void GroundPlaneProjector::fetchRay(const double x, const double y, double& ray_x, double& ray_y) const
+{
+  if (!(x >= 0.0 && y >= 0.0 && x <= static_cast<double>(_width - 1) && y <= static_cast<double>(_height - 1)))
+  {
+    ray_x = std::numeric_limits<double>::quiet_NaN();
+    ray_y = std::numeric_limits<double>::quiet_NaN();
+    return;
+  }
+
+  // bilinear interpolation between the four surrounding pixels, the last row and column are clamped
+  const std::size_t col = std::min(static_cast<std::size_t>(x), _width > 1 ? _width - 2 : 0);
+  const std::size_t row = std::min(static_cast<std::size_t>(y), _height > 1 ? _height - 2 : 0);
+  const std::size_t nextCol = _width > 1 ? 1 : 0;
+  const std::size_t nextRow = _height > 1 ? _width : 0;
+  const double wx = x - static_cast<double>(col);
+  const double wy = y - static_cast<double>(row);
+  const std::size_t index = row * _width + col;
+
+  const auto interpolate = [&] (const std::vector<float>& table)
+  {
+    const double top = table[index] + wx * (table[index + nextCol] - table[index]);
+    const double bottom = table[index + nextRow] + wx * (table[index + nextRow + nextCol] - table[index + nextRow]);
+    return top + wy * (bottom - top);
+  };
+
+  ray_x = interpolate(_ray_x);
+  ray_y = interpolate(_ray_y);
+}
+
+template <typename FetchRay>
+std::size_t GroundPlaneProjector::projectRays(const std::size_t count, FetchRay fetch_ray,
+                                              base::Point2d* points) const
+{
+  if (!this->isInitialized())
+  {
+    std::fill(points, points + count, base::Point2d(std::numeric_limits<double>::quiet_NaN(),
+                                                    std::numeric_limits<double>::quiet_NaN()));
+    return 0;
+  }
+
+  const PoseCoefficients pose(_extrinsic);
+  double rayX[_chunk_size];
+  double rayY[_chunk_size];
+  std::size_t numValid = 0;
+
+  for (std::size_t begin = 0; begin < count; begin += _chunk_size)
+  {
+    const std::size_t size = std::min(_chunk_size, count - begin);
+
+    for (std::size_t i = 0; i < size; ++i)
+      fetch_ray(begin + i, rayX[i], rayY[i]);
+
+    numValid += intersectRays(pose, rayX, rayY, size, points + begin);
+  }
+
+  return numValid;
+}
+
+bool GroundPlaneProjector::project(const base::Point2d& pixel, base::Point2d& point) const
+{
+  if (!this->isInitialized())
+    return false;
+
+  double rayX, rayY;
+  this->fetchRay(pixel.x(), pixel.y(), rayX, rayY);
+
+  return PoseCoefficients(_extrinsic).apply(rayX, rayY, point.x(), point.y());
+}
+
+std::size_t GroundPlaneProjector::project(const base::Span<const Pixel> pixels, base::Point2dVector& points) const
+{
+  points.resize(pixels.size());
+
+  // integer pixels are read directly from the table
+  return this->projectRays(pixels.size(), [&] (const std::size_t i, double& ray_x, double& ray_y)
+  {
+    if (pixels[i].x() >= _width || pixels[i].y() >= _height)
+    {
+      ray_x = ray_y = std::numeric_limits<double>::quiet_NaN();
+      return;
+    }
+
+    const std::size_t index = pixels[i].y() * _width + pixels[i].x();
+    ray_x = _ray_x[index];
+    ray_y = _ray_y[index];
+  },
+  points.data());
+}
+
+std::size_t GroundPlaneProjector::project(const base::Point2dVector& pixels, base::Point2dVector& points) const
+{
+  points.resize(pixels.size());
+
+  return this->projectRays(pixels.size(), [&] (const std::size_t i, double& ray_x, double& ray_y)
+  {
+    this->fetchRay(pixels[i].x(), pixels[i].y(), ray_x, ray_y);
+  },
+  points.data());
+}
+
+std::size_t GroundPlaneProjector::project(const base::VectorVector2d& pixels, base::Point2dVector& points) const
+{
+  points.resize(pixels.size());
+
+  return this->projectRays(pixels.size(), [&] (const std::size_t i, double& ray_x, double& ray_y)
+  {
+    this->fetchRay(pixels[i].x(), pixels[i].y(), ray_x, ray_y);
+  },
+  points.data());
+}
+
+std::size_t GroundPlaneProjector::project(const base::LineSegmentVector& segments,
+                                          base::LineSegmentVector& projected) const
+{
+  projected.clear();
+
+  // project all end points in one batch
+  base::Point2dVector ends(segments.size() * 2);
+
+  this->projectRays(ends.size(), [&] (const std::size_t i, double& ray_x, double& ray_y)
+  {
+    const base::Point2d& pixel = i % 2 ? segments[i / 2].p1() : segments[i / 2].p0();
+    this->fetchRay(pixel.x(), pixel.y(), ray_x, ray_y);
+  },
+  ends.data());
+
+  projected.reserve(segments.size());
+
+  for (std::size_t i = 0; i < segments.size(); ++i)
+    if (ends[i * 2].isValid() && ends[i * 2 + 1].isValid())
+      projected.emplace_back(ends[i * 2], ends[i * 2 + 1]);
+
+  return projected.size();
+}
+
+} // end namespace algorithm
+
+} // end namespace francor
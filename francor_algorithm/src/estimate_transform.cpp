@@ -15,11 +15,14 @@ namespace algorithm {
 
 using francor::base::LogError;
 
-double estimateTransform(const base::Point2dVector& dataset_a,
-                         const base::Point2dVector& dataset_b,
-                         const PointPairIndexVector& pair_indices,
-                         const double max_distance,
-                         base::Transform2d& transform)
+namespace {
+
+template <typename Type>
+double estimateTransformImpl(const base::Point2Vector<Type>& dataset_a,
+                             const base::Point2Vector<Type>& dataset_b,
+                             const impl::PointPairIndexVector<Type>& pair_indices,
+                             const double max_distance,
+                             base::impl::Transform2<Type>& transform)
 {
   if (dataset_a.empty() || dataset_b.empty())
   {
@@ -32,12 +35,12 @@ double estimateTransform(const base::Point2dVector& dataset_a,
     return -1.0;
   }
   // \todo Add check for pair indices. Check if the indices relate to the two datasets.
-  using base::Point2d;
-  using base::Vector2d;
+  using Point = base::Point2<Type>;
+  using Vector = base::Vector2<Type>;
 
-  // calculate centroid of each dataset
-  Point2d centroid_set_a(0.0, 0.0);
-  Point2d centroid_set_b(0.0, 0.0);
+  // calculate centroid of each dataset, accumulated in double also for float datasets
+  base::Point2d sum_set_a(0.0, 0.0);
+  base::Point2d sum_set_b(0.0, 0.0);
   double rms = 0.0;
   std::size_t used_pairs = 0;
 
@@ -49,15 +52,18 @@ double estimateTransform(const base::Point2dVector& dataset_a,
 
     const auto& point_a = dataset_a[pair.first ];
     const auto& point_b = dataset_b[pair.second];
-    centroid_set_a += point_a;
-    centroid_set_b += point_b;
+    sum_set_a += base::Point2d(point_a);
+    sum_set_b += base::Point2d(point_b);
     rms += pair.distance;
     ++used_pairs;
   }
 
-  centroid_set_a /= static_cast<double>(used_pairs);
-  centroid_set_b /= static_cast<double>(used_pairs);
-  rms            /= static_cast<double>(used_pairs);
+  sum_set_a /= static_cast<double>(used_pairs);
+  sum_set_b /= static_cast<double>(used_pairs);
+  rms       /= static_cast<double>(used_pairs);
+
+  Point centroid_set_a(sum_set_a);
+  const Point centroid_set_b(sum_set_b);
 
   // calculate nominator and denominator
   double d_nominator   = 0.0;
@@ -69,8 +75,8 @@ double estimateTransform(const base::Point2dVector& dataset_a,
       continue;
     }
 
-    const Vector2d dFC_a(dataset_a[pair.first ] - centroid_set_a);
-    const Vector2d dFC_b(dataset_b[pair.second] - centroid_set_b);
+    const Vector dFC_a(dataset_a[pair.first ] - centroid_set_a);
+    const Vector dFC_b(dataset_b[pair.second] - centroid_set_b);
     d_nominator   += dFC_a.y() * dFC_b.x() - dFC_a.x() * dFC_b.y();
     d_denominator += dFC_a.x() * dFC_b.x() + dFC_a.y() * dFC_b.y();
   }
@@ -84,6 +90,26 @@ double estimateTransform(const base::Point2dVector& dataset_a,
   return rms;
 }
 
+} // end namespace
+
+double estimateTransform(const base::Point2dVector& dataset_a,
+                         const base::Point2dVector& dataset_b,
+                         const PointPairIndexVector& pair_indices,
+                         const double max_distance,
+                         base::Transform2d& transform)
+{
+  return estimateTransformImpl(dataset_a, dataset_b, pair_indices, max_distance, transform);
+}
+
+double estimateTransform(const base::Point2fVector& dataset_a,
+                         const base::Point2fVector& dataset_b,
+                         const PointPairIndexVectorf& pair_indices,
+                         const double max_distance,
+                         base::Transform2f& transform)
+{
+  return estimateTransformImpl(dataset_a, dataset_b, pair_indices, max_distance, transform);
+}
+
 } // end namespace algorithm
 
 } // end namespace francor
\ No newline at end of file
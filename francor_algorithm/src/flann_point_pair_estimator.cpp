@@ -16,23 +16,29 @@ namespace algorithm {
 
 using francor::base::LogError;
 
-FlannPointPairEstimator::FlannPointPairEstimator()
+namespace impl {
+
+template <typename Type>
+FlannPointPairEstimator<Type>::FlannPointPairEstimator()
 {
 
 }
 
-FlannPointPairEstimator::~FlannPointPairEstimator()
+template <typename Type>
+FlannPointPairEstimator<Type>::~FlannPointPairEstimator()
 {
 
 }
 
-bool FlannPointPairEstimator::setPointDataset(const base::Point2dVector& points)
+template <typename Type>
+bool FlannPointPairEstimator<Type>::setPointDataset(const base::Point2Vector<Type>& points)
 {
   this->copyPointDataset(points, _point_dataset);
   return this->createFlannIndex();
 }
 
-bool FlannPointPairEstimator::findPairs(const base::Point2dVector& points, PointPairIndexVector& pairs)
+template <typename Type>
+bool FlannPointPairEstimator<Type>::findPairs(const base::Point2Vector<Type>& points, PointPairIndexVector<Type>& pairs)
 {
   if (_flann_index == nullptr)
   {
@@ -40,15 +46,16 @@ bool FlannPointPairEstimator::findPairs(const base::Point2dVector& points, Point
     return false;
   }
 
-  std::vector<double> target_dataset;
-  this->copyPointDataset(points, target_dataset);
+  // the points are stored interleaved (x, y), so flann can read them in place without a copy
+  static_assert(sizeof(base::impl::Point2<Type>) == 2 * sizeof(Type), "point must consist of x and y only");
+  Type* const target_dataset = const_cast<Type*>(reinterpret_cast<const Type*>(points.data()));
 
   _indicies.resize(points.size());
   _distances.resize(points.size());
 
   flann::Matrix<int> indices(_indicies.data(), _indicies.size(), 1);
-  flann::Matrix<double> distances(_distances.data(), _distances.size(), 1);
-  flann::Matrix<double> target(target_dataset.data(), _indicies.size(), 2);
+  flann::Matrix<Type> distances(_distances.data(), _distances.size(), 1);
+  flann::Matrix<Type> target(target_dataset, _indicies.size(), 2);
   flann::SearchParams parameter(-1, 1e-2);
 
   _flann_index->knnSearch(target, indices, distances, 1, parameter);
@@ -58,7 +65,9 @@ bool FlannPointPairEstimator::findPairs(const base::Point2dVector& points, Point
   return true;
 }
 
-void FlannPointPairEstimator::copyPointDataset(const base::Point2dVector& points, std::vector<double>& dataset) const
+template <typename Type>
+void FlannPointPairEstimator<Type>::copyPointDataset(const base::Point2Vector<Type>& points,
+                                                     std::vector<Type>& dataset) const
 {
   // allocate memory for dataset ((x,y) * num points)
   dataset.resize(points.size() * 2);
@@ -69,9 +78,10 @@ void FlannPointPairEstimator::copyPointDataset(const base::Point2dVector& points
   }
 }
 
-void FlannPointPairEstimator::copyIndexPairs(const std::vector<int>& indices,
-                                             const std::vector<double>& distances,
-                                             PointPairIndexVector& pairs) const
+template <typename Type>
+void FlannPointPairEstimator<Type>::copyIndexPairs(const std::vector<int>& indices,
+                                                   const std::vector<Type>& distances,
+                                                   PointPairIndexVector<Type>& pairs) const
 {
   pairs.resize(indices.size());
 
@@ -84,18 +94,24 @@ void FlannPointPairEstimator::copyIndexPairs(const std::vector<int>& indices,
   pairs.update();
 }
 
-bool FlannPointPairEstimator::createFlannIndex()
+template <typename Type>
+bool FlannPointPairEstimator<Type>::createFlannIndex()
 {
   // \todo select good parameter
   flann::KDTreeSingleIndexParams parameter;
-  const flann::Matrix<double> points(_point_dataset.data(), _point_dataset.size() / 2, 2);
+  const flann::Matrix<Type> points(_point_dataset.data(), _point_dataset.size() / 2, 2);
 
-  _flann_index = std::make_unique<flann::Index<flann::L2<double>>>(points, parameter); 
+  _flann_index = std::make_unique<flann::Index<flann::L2<Type>>>(points, parameter); 
   _flann_index->buildIndex();
   
   return true;
 }
 
+template class FlannPointPairEstimator<double>;
+template class FlannPointPairEstimator<float>;
+
+} // end namespace impl
+
 } // end namespace algorithm
 
 } // end namespace francor
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "francor_algorithm/icp.h"
 
 #include <francor_base/log.h>
+#include <francor_base/trace.h>
+#include <francor_base/algorithm/transform.h>
 
 namespace francor {
 
@@ -16,8 +18,14 @@ using francor::base::LogError;
 using francor::base::LogWarn;
 using francor::base::LogDebug;
 
-bool Icp::estimateTransform(const base::Point2dVector& origin, const base::Point2dVector& target, base::Transform2d& transform) const
+namespace impl {
+
+template <typename Type>
+bool Icp<Type>::estimateTransform(const base::Point2Vector<Type>& origin, const base::Point2Vector<Type>& target,
+                                  base::impl::Transform2<Type>& transform) const
 {
+  FRANCOR_TRACE_SCOPE("Icp::estimateTransform", "origin_points", origin.size(), "target_points", target.size());
+
   if (_pair_estimator == nullptr) {
     LogError() << "Icp::estimateTransform(): no point pair estimator is set. Cancel estimation.";
     return false;
@@ -30,7 +38,7 @@ bool Icp::estimateTransform(const base::Point2dVector& origin, const base::Point
   }
 
   // get a copy the target points
-  base::Point2dVector moved_points(target);
+  base::Point2Vector<Type> moved_points(target);
   double rms = _max_rms;
   transform.setRotation(0.0);
   transform.setTranslation({ 0.0, 0.0 });
@@ -38,7 +46,7 @@ bool Icp::estimateTransform(const base::Point2dVector& origin, const base::Point
   // iterate until max iterations is reached or a other criterion is fulfilled
   for (std::size_t iteration = 0; iteration < _max_iterations; ++iteration)
   {
-    base::Transform2d current_transform;
+    base::impl::Transform2<Type> current_transform;
     double current_rms;
 
     // do iteration and estimate transformation
@@ -54,6 +62,8 @@ bool Icp::estimateTransform(const base::Point2dVector& origin, const base::Point
 
     // integrate current iteration results
     rms = current_rms;
+    FRANCOR_TRACE_ARGUMENT("iterations", iteration + 1);
+    FRANCOR_TRACE_ARGUMENT("rms", rms);
     // \todo I expect the opposite 
     transform = transform * current_transform;
 
@@ -63,42 +73,44 @@ bool Icp::estimateTransform(const base::Point2dVector& origin, const base::Point
     }
 
     // transform points
-    current_transform = current_transform.inverse();
-    
-    for (auto& point : moved_points)
-      point = current_transform * point;
+    base::algorithm::transform::transformPointVector(current_transform.inverse(), moved_points);
   }
 
   return true;
 }
 
-bool Icp::doIteration(const base::Point2dVector& origin, const base::Point2dVector& target,
-                      base::Transform2d& transform, const double distance_threshold, double& rms) const
+template <typename Type>
+bool Icp<Type>::doIteration(const base::Point2Vector<Type>& origin, const base::Point2Vector<Type>& target,
+                            base::impl::Transform2<Type>& transform, const double distance_threshold,
+                            double& rms) const
 {
-  PointPairIndexVector pairs;
+  if (_transform_estimator == nullptr) {
+    LogError() << "Icp::estimateTransform(): no transform estimation function is set. Cancel estimation process.";
+    return false;
+  }
+
+  PointPairIndexVector<Type> pairs;
 
   if (!_pair_estimator->findPairs(target, pairs)) {
     LogError() << "Icp::estimateTransform(): error occurred during finding point pairs. Cancel estimation process.";
     return false;
   }  
 
-  try {
-    rms = _transform_estimator(origin, target, pairs, std::max(pairs.medianDistance() * 2.0, distance_threshold), transform);
+  rms = _transform_estimator(origin, target, pairs, std::max(pairs.medianDistance() * 2.0, distance_threshold), transform);
 
-    if (rms >= _max_rms) {
-      LogWarn() << "Icp::estimateTransform(): max rms value reached. Cancel estimation process.";
-      return false;
-    }
-  }
-  catch (std::bad_function_call& ex) {
-    LogError() << "Icp::estimateTransform(): estimate transform can't be called. Maybe function isn't set. Cancel estimation"
-                  " process. ex.what(): " << ex.what();
+  if (rms >= _max_rms) {
+    LogWarn() << "Icp::estimateTransform(): max rms value reached. Cancel estimation process.";
     return false;
   }
 
   return true;
 }
 
+template class Icp<double>;
+template class Icp<float>;
+
+} // end namespace impl
+
 } // end namespace algorithm
 
 } // end namespace francor
\ No newline at end of file
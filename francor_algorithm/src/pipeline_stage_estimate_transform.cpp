@@ -20,11 +20,11 @@ bool StageEstimateTransformBetweenPoints::doProcess(processing::NoDataType&)
   using francor::base::LogDebug;
   using francor::base::LogError;
 
-  const auto& point_set_a = this->input(IN_POINTS_A).data<base::Point2dVector>();
-  const auto& point_set_b = this->input(IN_POINTS_B).data<base::Point2dVector>();
-  LogDebug() << this->name() << ": input points";
-  LogDebug() << point_set_a;
-  LogDebug() << point_set_b;
+  const auto& point_set_a = *this->input(IN_POINTS_A).data<base::BufferHandle<base::Point2dVector>>();
+  const auto& point_set_b = *this->input(IN_POINTS_B).data<base::BufferHandle<base::Point2dVector>>();
+  FRANCOR_LOG(LogDebug) << this->name() << ": input points";
+  FRANCOR_LOG(LogDebug) << point_set_a;
+  FRANCOR_LOG(LogDebug) << point_set_b;
 
   // estimate transform between point sets using icp
   if (!_icp.estimateTransform(point_set_a, point_set_b, _estimated_transform)) {
@@ -33,7 +33,7 @@ bool StageEstimateTransformBetweenPoints::doProcess(processing::NoDataType&)
   }
 
   _estimated_transform = _estimated_transform.inverse();
-  LogDebug() << this->name() << ": estimated transform = " << _estimated_transform;
+  FRANCOR_LOG(LogDebug) << this->name() << ": estimated transform = " << _estimated_transform;
   return true;
 }
 
@@ -48,8 +48,8 @@ bool StageEstimateTransformBetweenPoints::doInitialization()
 
 bool StageEstimateTransformBetweenPoints::initializePorts()
 {
-  this->initializeInputPort<base::Point2dVector>(IN_POINTS_A, "points 2d");
-  this->initializeInputPort<base::Point2dVector>(IN_POINTS_B, "points 2d");
+  this->initializeInputPort<base::BufferHandle<base::Point2dVector>>(IN_POINTS_A, "points 2d");
+  this->initializeInputPort<base::BufferHandle<base::Point2dVector>>(IN_POINTS_B, "points 2d");
 
   this->initializeOutputPort(OUT_TRANSFORM, "transform", &_estimated_transform);
 
@@ -74,15 +74,19 @@ bool StageConvertLaserScanToPoints::doProcess(processing::NoDataType&)
   const auto& ego_pose   = this->input(IN_EGO_POSE).numOfConnections() > 0 ? this->input(IN_EGO_POSE).data<base::Pose2d>() : base::Pose2d();
 
   // @todo replace debug messages with proper one
-  LogDebug() << "uses scan pose " << scan.pose();
-  LogDebug() << "uses ego pose " << ego_pose;
+  FRANCOR_LOG(LogDebug) << "uses scan pose " << scan.pose();
+  FRANCOR_LOG(LogDebug) << "uses ego pose " << ego_pose;
 
-  if (!base::algorithm::point::convertLaserScanToPoints(scan, ego_pose, _resulted_points)) {
+  // convert into a local handle, so the result of the last run stays valid if the conversion fails
+  auto points = _point_buffers.acquire();
+
+  if (!base::algorithm::point::convertLaserScanToPoints(scan, ego_pose, *points)) {
     LogError() << this->name() << ": error occurred during convertion. Can't convert laser scan.";
     return false;
   }
 
-  LogDebug() << this->name() << ": converted " << _resulted_points.size() << " laser beams to points.";
+  _resulted_points = std::move(points);
+  FRANCOR_LOG(LogDebug) << this->name() << ": converted " << _resulted_points->size() << " laser beams to points.";
   return true;
 }
 
@@ -130,7 +134,7 @@ bool StageEstimateNormalsFromOrderedPoints::doProcess(processing::NoDataType&)
   using francor::base::LogDebug;
   using francor::base::LogError;
 
-  const auto& points = this->input(IN_POINTS).data<base::Point2dVector>();
+  const auto& points = *this->input(IN_POINTS).data<base::BufferHandle<base::Point2dVector>>();
 
   if (auto result = estimateNormalsFromOrderedPoints(points, 5)) {
     _resulted_normals = std::move(*result);
@@ -150,7 +154,7 @@ bool StageEstimateNormalsFromOrderedPoints::doInitialization()
 
 bool StageEstimateNormalsFromOrderedPoints::initializePorts()
 {
-  this->initializeInputPort<base::Point2dVector>(IN_POINTS, "points 2d");
+  this->initializeInputPort<base::BufferHandle<base::Point2dVector>>(IN_POINTS, "points 2d");
 
   this->initializeOutputPort<std::vector<base::AnglePiToPi>>(OUT_NORMALS, "normals 2d", &_resulted_normals);
 
@@ -171,7 +175,7 @@ bool StageExtractSensorPose::doProcess(processing::NoDataType&)
 
   const auto sensor_data = this->input(IN_SENSOR_DATA).data<std::shared_ptr<base::SensorData>>();
   _sensor_pose = sensor_data->pose();
-  LogDebug() << this->name() << ": extracted " << _sensor_pose << " from sensor data of sensor "
+  FRANCOR_LOG(LogDebug) << this->name() << ": extracted " << _sensor_pose << " from sensor data of sensor "
              << sensor_data->sensorName();
 
   return true;
@@ -4,16 +4,19 @@ namespace francor {
 
 namespace algorithm {
 
-Ray2d Ray2d::create(const std::size_t xIdx,
-                    const std::size_t yIdx,
-                    const std::size_t numCellsX,
-                    const std::size_t numCellsY,                    
-                    const double cellSize,
-                    const base::Point2d position,
-                    const base::Vector2d direction,
-                    const double distance)
+namespace impl {
+
+template <typename Type>
+Ray2<Type> Ray2<Type>::create(const std::size_t xIdx,
+                              const std::size_t yIdx,
+                              const std::size_t numCellsX,
+                              const std::size_t numCellsY,                    
+                              const Type cellSize,
+                              const base::Point2<Type> position,
+                              const base::Vector2<Type> direction,
+                              const Type distance)
 {
-  Ray2d ray;
+  Ray2 ray;
 
   if (!ray.initialize(xIdx, yIdx, numCellsX, numCellsY, cellSize, position, direction, distance))
   {
@@ -24,18 +27,19 @@ Ray2d Ray2d::create(const std::size_t xIdx,
   return ray;
 }                
 
-bool Ray2d::initialize(const std::size_t xIdx,
-                       const std::size_t yIdx,
-                       const std::size_t numCellsX,
-                       const std::size_t numCellsY,
-                       const double cellSize,
-                       const base::Point2d position,
-                       const base::Vector2d direction,
-                       const double distance)
+template <typename Type>
+bool Ray2<Type>::initialize(const std::size_t xIdx,
+                            const std::size_t yIdx,
+                            const std::size_t numCellsX,
+                            const std::size_t numCellsY,
+                            const Type cellSize,
+                            const base::Point2<Type> position,
+                            const base::Vector2<Type> direction,
+                            const Type distance)
 {
-  using francor::base::Line;
-  using francor::base::Vector2d;
-  using francor::base::Point2d;
+  using Line = base::impl::Line<Type>;
+  using Vector2 = base::Vector2<Type>;
+  using Point2 = base::Point2<Type>;
 
   assert(direction.norm() >= 0.99 && direction.norm() <= 1.01);
 
@@ -54,12 +58,12 @@ bool Ray2d::initialize(const std::size_t xIdx,
   _max_idx.y() = numCellsY;
 
   // calculate cell position (mid)
-  const Point2d cellPosition((static_cast<double>(_current_idx.x()) + 0.5) * cellSize,
-                             (static_cast<double>(_current_idx.y()) + 0.5) * cellSize);
+  const Point2 cellPosition((static_cast<Type>(_current_idx.x()) + Type(0.5)) * cellSize,
+                            (static_cast<Type>(_current_idx.y()) + Type(0.5)) * cellSize);
 
   // calculate next x and y position of next y and x grid line.
-  const double posNextGridLineX = direction.x() >= 0.0 ? cellPosition.x() + cellSize * 0.5 : cellPosition.x() - cellSize * 0.5;
-  const double posNextGridLineY = direction.y() >= 0.0 ? cellPosition.y() + cellSize * 0.5 : cellPosition.y() - cellSize * 0.5;
+  const Type posNextGridLineX = direction.x() >= 0.0 ? cellPosition.x() + cellSize * Type(0.5) : cellPosition.x() - cellSize * Type(0.5);
+  const Type posNextGridLineY = direction.y() >= 0.0 ? cellPosition.y() + cellSize * Type(0.5) : cellPosition.y() - cellSize * Type(0.5);
 
   // calculate intersections with the next x and y-axis
   const Line ray(Line::createFromVectorAndPoint(direction, position));
@@ -68,16 +72,21 @@ bool Ray2d::initialize(const std::size_t xIdx,
 
   // if intersection exists then initialize current distance with the distance to that point, otherwise assign biggest number, to
   // avoid moving in that direction
-  _side_dist.x() = intersectionNextCellX.isValid() ? (intersectionNextCellX - position).norm() : std::numeric_limits<double>::max();
-  _side_dist.y() = intersectionNextCellY.isValid() ? (intersectionNextCellY - position).norm() : std::numeric_limits<double>::max();
+  _side_dist.x() = intersectionNextCellX.isValid() ? (intersectionNextCellX - position).norm() : std::numeric_limits<Type>::max();
+  _side_dist.y() = intersectionNextCellY.isValid() ? (intersectionNextCellY - position).norm() : std::numeric_limits<Type>::max();
 
   // calculate for each direction the step length
-  _delta_dist.x() = (Vector2d(direction) / direction.x()).norm() * cellSize;
-  _delta_dist.y() = (Vector2d(direction) / direction.y()).norm() * cellSize;
+  _delta_dist.x() = (Vector2(direction) / direction.x()).norm() * cellSize;
+  _delta_dist.y() = (Vector2(direction) / direction.y()).norm() * cellSize;
 
   return true;  
 }                     
 
+template class Ray2<double>;
+template class Ray2<float>;
+
+} // end namespace impl
+
 } // end namespace algorithm
 
 } // end namespace francor
\ No newline at end of file
@@ -0,0 +1,216 @@
+/**
+ * Unit test for the estimation of 3d coordinates on the ground plane.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_algorithm/estimate_3d_coordinate.h"
+
+#include <cmath>
+#include <random>
+
+using francor::algorithm::estimate3dCoordinateOnGroundplane;
+using francor::algorithm::GroundPlaneProjector;
+using francor::base::Matrix3d;
+using francor::base::Matrix4d;
+using francor::base::Vector2d;
+using francor::base::Vector3d;
+using francor::base::Point2d;
+using francor::base::Point2dVector;
+using francor::base::LineSegment;
+using francor::base::LineSegmentVector;
+
+namespace {
+
+constexpr std::size_t _width = 64;
+constexpr std::size_t _height = 48;
+
+Matrix3d createIntrinsic()
+{
+  Matrix3d intrinsic;
+  intrinsic << 50.0,  0.0, 31.5,
+                0.0, 50.0, 23.5,
+                0.0,  0.0,  1.0;
+
+  return intrinsic;
+}
+
+// camera 1.5 m above the origin, looking along the x axis and pitched downwards by the given angle
+Matrix4d createExtrinsic(const double pitch)
+{
+  const double c = std::cos(pitch);
+  const double s = std::sin(pitch);
+  Matrix4d extrinsic(Matrix4d::Identity());
+
+  // columns are the camera axes in world frame: x right, y down, z forward
+  extrinsic.block<3, 1>(0, 0) = Vector3d(0.0, -1.0, 0.0);
+  extrinsic.block<3, 1>(0, 1) = Vector3d(-s, 0.0, -c);
+  extrinsic.block<3, 1>(0, 2) = Vector3d(c, 0.0, -s);
+  extrinsic.block<3, 1>(0, 3) = Vector3d(0.0, 0.0, 1.5);
+
+  return extrinsic;
+}
+
+} // end namespace
+
+TEST(EstimateCoordinateOnGroundPlane, SinglePixel)
+{
+  const double pitch = M_PI / 6.0;
+  Vector3d point;
+
+  // the principal point is the optical axis
+  ASSERT_TRUE(estimate3dCoordinateOnGroundplane(createIntrinsic(), createExtrinsic(pitch), Vector2d(31.5, 23.5), point));
+  EXPECT_NEAR(point.x(), 1.5 / std::tan(pitch), 1e-9);
+  EXPECT_NEAR(point.y(), 0.0, 1e-9);
+  EXPECT_EQ(point.z(), 0.0);
+
+  // a camera that looks upwards doesn't see the ground
+  EXPECT_FALSE(estimate3dCoordinateOnGroundplane(createIntrinsic(), createExtrinsic(-pitch), Vector2d(31.5, 23.5),
+                                                 point));
+}
+
+TEST(GroundPlaneProjector, BatchEqualsSinglePixel)
+{
+  // pitched a little, so the upper rows are above the horizon
+  const double pitch = 0.2;
+  GroundPlaneProjector projector;
+  ASSERT_TRUE(projector.initialize(createIntrinsic(), _width, _height));
+  projector.setExtrinsic(createExtrinsic(pitch));
+
+  // all pixels of the image, the count isn't a multiple of the chunk or vector size
+  std::vector<GroundPlaneProjector::Pixel> pixels;
+
+  for (unsigned int row = 0; row < _height; ++row)
+    for (unsigned int col = 0; col < _width; ++col)
+      pixels.emplace_back(col, row);
+
+  pixels.emplace_back(_width, 0);
+  pixels.emplace_back(0, _height);
+
+  Point2dVector points;
+  const std::size_t numValid = projector.project(pixels, points);
+  ASSERT_EQ(points.size(), pixels.size());
+
+  std::size_t numExpected = 0;
+
+  for (std::size_t i = 0; i < pixels.size(); ++i)
+  {
+    Vector3d expected;
+    const bool isInside = pixels[i].x() < _width && pixels[i].y() < _height;
+
+    if (isInside && estimate3dCoordinateOnGroundplane(createIntrinsic(), createExtrinsic(pitch),
+                                                      Vector2d(pixels[i].x(), pixels[i].y()), expected))
+    {
+      ++numExpected;
+      ASSERT_TRUE(points[i].isValid());
+      // the ray table is stored in single precision
+      const double tolerance = 1e-5 * std::hypot(expected.x(), expected.y());
+      EXPECT_NEAR(points[i].x(), expected.x(), tolerance);
+      EXPECT_NEAR(points[i].y(), expected.y(), tolerance);
+    }
+    else
+    {
+      EXPECT_FALSE(points[i].isValid()) << "pixel " << pixels[i].x() << ", " << pixels[i].y();
+    }
+  }
+
+  EXPECT_EQ(numValid, numExpected);
+  EXPECT_GT(numValid, 0);
+  EXPECT_LT(numValid, _width * _height);
+}
+
+TEST(GroundPlaneProjector, SubPixel)
+{
+  const double pitch = M_PI / 4.0;
+  GroundPlaneProjector projector;
+  ASSERT_TRUE(projector.initialize(createIntrinsic(), _width, _height));
+  projector.setExtrinsic(createExtrinsic(pitch));
+
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<double> col(0.0, _width - 1);
+  std::uniform_real_distribution<double> row(0.0, _height - 1);
+  Point2dVector pixels;
+
+  for (std::size_t i = 0; i < 301; ++i)
+    pixels.emplace_back(col(generator), row(generator));
+
+  Point2dVector points;
+  EXPECT_EQ(projector.project(pixels, points), pixels.size());
+
+  for (std::size_t i = 0; i < pixels.size(); ++i)
+  {
+    Vector3d expected;
+    ASSERT_TRUE(estimate3dCoordinateOnGroundplane(createIntrinsic(), createExtrinsic(pitch),
+                                                  Vector2d(pixels[i].x(), pixels[i].y()), expected));
+    EXPECT_NEAR(points[i].x(), expected.x(), 1e-5);
+    EXPECT_NEAR(points[i].y(), expected.y(), 1e-5);
+  }
+}
+
+TEST(GroundPlaneProjector, Distortion)
+{
+  const double pitch = M_PI / 4.0;
+  GroundPlaneProjector::Distortion distortion;
+  distortion << -0.2, 0.05, 0.001, -0.001, 0.0;
+
+  GroundPlaneProjector projector;
+  ASSERT_TRUE(projector.initialize(createIntrinsic(), _width, _height, distortion));
+  projector.setExtrinsic(createExtrinsic(pitch));
+
+  // distort a ray like the lens does and project the resulting pixel
+  const double x = -0.3;
+  const double y = 0.2;
+  const double r2 = x * x + y * y;
+  const double radial = 1.0 + distortion[0] * r2 + distortion[1] * r2 * r2;
+  const double distortedX = x * radial + 2.0 * distortion[2] * x * y + distortion[3] * (r2 + 2.0 * x * x);
+  const double distortedY = y * radial + distortion[2] * (r2 + 2.0 * y * y) + 2.0 * distortion[3] * x * y;
+  const Point2d pixel(distortedX * 50.0 + 31.5, distortedY * 50.0 + 23.5);
+
+  Vector3d expected;
+  ASSERT_TRUE(estimate3dCoordinateOnGroundplane(createIntrinsic(), createExtrinsic(pitch),
+                                                Vector2d(x * 50.0 + 31.5, y * 50.0 + 23.5), expected));
+
+  Point2d point;
+  ASSERT_TRUE(projector.project(pixel, point));
+  // the rays are interpolated between pixels
+  EXPECT_NEAR(point.x(), expected.x(), 1e-3);
+  EXPECT_NEAR(point.y(), expected.y(), 1e-3);
+}
+
+TEST(GroundPlaneProjector, LineSegments)
+{
+  const double pitch = 0.2;
+  GroundPlaneProjector projector;
+  ASSERT_TRUE(projector.initialize(createIntrinsic(), _width, _height));
+  projector.setExtrinsic(createExtrinsic(pitch));
+
+  // the second segment ends above the horizon
+  const LineSegmentVector segments = { LineSegment(Point2d(10.0, 47.0), Point2d(20.0, 30.0)),
+                                       LineSegment(Point2d(10.0, 47.0), Point2d(10.0, 0.0)) };
+  LineSegmentVector projected;
+
+  ASSERT_EQ(projector.project(segments, projected), 1);
+  ASSERT_EQ(projected.size(), 1);
+
+  Vector3d p0, p1;
+  ASSERT_TRUE(estimate3dCoordinateOnGroundplane(createIntrinsic(), createExtrinsic(pitch), Vector2d(10.0, 47.0), p0));
+  ASSERT_TRUE(estimate3dCoordinateOnGroundplane(createIntrinsic(), createExtrinsic(pitch), Vector2d(20.0, 30.0), p1));
+  EXPECT_NEAR(projected[0].p0().x(), p0.x(), 1e-4);
+  EXPECT_NEAR(projected[0].p0().y(), p0.y(), 1e-4);
+  EXPECT_NEAR(projected[0].p1().x(), p1.x(), 1e-4);
+  EXPECT_NEAR(projected[0].p1().y(), p1.y(), 1e-4);
+}
+
+TEST(GroundPlaneProjector, NotInitialized)
+{
+  GroundPlaneProjector projector;
+  Point2dVector points;
+
+  EXPECT_FALSE(projector.isInitialized());
+  EXPECT_EQ(projector.project(Point2dVector(3, Point2d(1.0, 1.0)), points), 0);
+  ASSERT_EQ(points.size(), 3);
+  EXPECT_FALSE(points[0].isValid());
+  EXPECT_FALSE(projector.initialize(createIntrinsic(), 0, 10));
+}
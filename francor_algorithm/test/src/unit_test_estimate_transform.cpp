@@ -15,6 +15,9 @@ using francor::base::Point2dVector;
 using francor::base::Transform2d;
 using francor::base::Angle;
 using francor::algorithm::PointPairIndexVector;
+using francor::algorithm::PointPairIndexVectorf;
+using francor::base::Point2fVector;
+using francor::base::Transform2f;
 
 TEST(EstimateTransform, EstimateFromTwoPointSets)
 {
@@ -40,6 +43,32 @@ TEST(EstimateTransform, EstimateFromTwoPointSets)
   }
 }
 
+TEST(EstimateTransform, EstimateFromTwoFloatPointSets)
+{
+  for (Angle angle = Angle::createFromDegree(-180.0); angle < Angle::createFromDegree(180.0); angle += Angle::createFromDegree(1.0))
+  {
+    const Transform2f transform( { angle }, { 1.0f, 2.0f } );
+    const Point2fVector origin = { { -2.0f, 3.0f }, { -1.0f, 3.0f }, { 0.0f, 3.0f }, { 1.0f, 3.0f }, { 2.0f, 3.0f } };
+    PointPairIndexVectorf pairs;
+    Point2fVector transformed(origin.size());
+
+    for (std::size_t i = 0; i < origin.size(); ++i) {
+        transformed[i] = transform * origin[i];
+        pairs.push_back( { i, i, 0.0f } );
+    }
+
+    Transform2f result;
+    const auto rms = estimateTransform(origin, transformed, pairs, std::numeric_limits<double>::max(), result);
+
+    EXPECT_GE(rms, 0.0);
+    // float precision can flip the sign at +-pi, so compare the normalized difference
+    EXPECT_NEAR(francor::base::AnglePiToPi(result.rotation().phi() - transform.rotation().phi()), 0.0,
+                Angle::createFromDegree(0.1));
+    EXPECT_NEAR(result.translation().x(), transform.translation().x(), 1e-3);
+    EXPECT_NEAR(result.translation().y(), transform.translation().y(), 1e-3);
+  }
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
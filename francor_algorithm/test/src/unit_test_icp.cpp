@@ -13,10 +13,14 @@
 #include <chrono>
 
 using francor::algorithm::Icp;
+using francor::algorithm::Icpf;
 using francor::algorithm::FlannPointPairEstimator;
+using francor::algorithm::FlannPointPairEstimatorf;
 using francor::algorithm::estimateTransform;
 using francor::base::Point2dVector;
 using francor::base::Transform2d;
+using francor::base::Point2fVector;
+using francor::base::Transform2f;
 using francor::base::Angle;
 
 TEST(Icp, Initialize)
@@ -158,6 +162,31 @@ TEST(Icp, EstimateTransformHalfAssignment)
   EXPECT_NEAR(result.translation().y(), 0.3, 0.01);
 }
 
+TEST(Icp, EstimateTransformHalfAssignmentFloat)
+{
+  const Point2dVector origin = { { 1.0, 1.0 }, { 2.0, 2.0 }, { 3.0, 3.0 }, { 4.0, 4.0 }, { 5.0, 5.0 }, { 6.0, 6.0 }, { 7.0, 7.0 },
+                                 { 1.5, 1.5 }, { 2.5, 2.5 }, { 3.5, 3.5 }, { 4.5, 4.5 }, { 5.5, 5.5 }, { 6.5, 6.5 }, { 7.5, 7.5 } };
+  const Point2fVector origin_f(origin.begin(), origin.end());
+  Point2fVector target(origin.size() / 2);
+  const Transform2f transform( { Angle::createFromDegree(30.0) }, { 0.5f, 0.3f } );
+
+  for (std::size_t i = 0; i < target.size(); ++i)
+    target[i] = transform * origin_f[i];
+
+  // the float pipeline must give the same result as the double one
+  Icpf icp(std::make_unique<FlannPointPairEstimatorf>(), estimateTransform);
+  Transform2f result;
+
+  icp.setMaxIterations(100);
+  icp.setMaxRms(10.0);
+  icp.setTerminationRms(0.05);
+
+  ASSERT_TRUE(icp.estimateTransform(origin_f, target, result));
+  EXPECT_NEAR(result.rotation().phi(), Angle::createFromDegree(30), Angle::createFromDegree(0.1));
+  EXPECT_NEAR(result.translation().x(), 0.5, 0.01);
+  EXPECT_NEAR(result.translation().y(), 0.3, 0.01);
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -11,6 +11,7 @@
 #include "francor_algorithm/ray_caster_2d.h"
 
 using francor::algorithm::Ray2d;
+using francor::algorithm::Ray2f;
 using francor::base::Vector2d;
 
 TEST(Ray, CreateUsingStaticFunction)
@@ -45,6 +46,26 @@ TEST(Ray, MoveInPositiveX)
   EXPECT_EQ(idxX, 10 + idxXOffset);
 }
 
+TEST(Ray, FloatRayVisitsSameCells)
+{
+  // diagonal ray, float and double version must walk through the same cells
+  const double length = std::sqrt(0.6 * 0.6 + 0.8 * 0.8);
+  Ray2d ray_d(Ray2d::create(5, 5, 100, 100, 0.1, { 0.55, 0.55 }, { 0.6 / length, 0.8 / length }, 2.0));
+  Ray2f ray_f(Ray2f::create(5, 5, 100, 100, 0.1f, { 0.55f, 0.55f },
+                            { static_cast<float>(0.6 / length), static_cast<float>(0.8 / length) }, 2.0f));
+  std::size_t steps = 0;
+
+  for (; ray_d && ray_f; ++ray_d, ++ray_f, ++steps)
+  {
+    EXPECT_EQ(ray_d.getCurrentIndex().x(), ray_f.getCurrentIndex().x());
+    EXPECT_EQ(ray_d.getCurrentIndex().y(), ray_f.getCurrentIndex().y());
+  }
+
+  EXPECT_FALSE(ray_d);
+  EXPECT_FALSE(ray_f);
+  EXPECT_LT(20u, steps);
+}
+
 TEST(Ray, IteratorBenchmark)
 {
   // start von index (5, 0) = [ 1.0, 1.0 ] and walk in positive x-direction 1.0 meter distance.
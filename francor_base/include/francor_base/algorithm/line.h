@@ -24,7 +24,8 @@ inline Vector2d calculateV(const Angle& phi)
   return { std::cos(phi),  std::sin(phi) };
 }
 
-inline Vector2d calculateV(const Point2d& p0, const Point2d& p1)
+template <typename Type>
+inline Vector2<Type> calculateV(const Point2<Type>& p0, const Point2<Type>& p1)
 {
   return (p1 - p0).normalized();
 }
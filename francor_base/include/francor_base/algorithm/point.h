@@ -6,27 +6,37 @@
 #pragma once
 
 #include "francor_base/point.h"
+#include "francor_base/pose.h"
 
 namespace francor {
 
 namespace base {
 
 class LaserScan;
-class Pose2d;
 
 namespace algorithm {
 
 namespace point {
 
 /**
- * \brief Converts an laser scan to 2d point vector. Nan and inf distance value of the scan will be ignored.
+ * \brief Converts an laser scan to 2d point vector. Nan and inf distance value of the scan will be ignored. The
+ *        beam angles are taken from the cos/sin tables shared by all scans of the same layout.
  * 
  * \param scan Laser scan that will be converted.
  * \param ego_pose That ego pose will be added to the scan pose.
- * \param points Resulting 2d points stored in a vector.
+ * \param points Resulting 2d points stored in a vector. Its capacity is reused.
  * \return true if convertion was successful.
  */
 bool convertLaserScanToPoints(const LaserScan& scan, const Pose2d& ego_pose, Point2dVector& points);
+/**
+ * \brief Same as above, but stores the points as structure of arrays.
+ */
+bool convertLaserScanToPoints(const LaserScan& scan, const Pose2d& ego_pose, Point2dSoA& points);
+/**
+ * \brief Same as above, but the points are stored as float. The beams are projected in double and rounded on store.
+ */
+bool convertLaserScanToPoints(const LaserScan& scan, const Pose2d& ego_pose, Point2fVector& points);
+bool convertLaserScanToPoints(const LaserScan& scan, const Pose2d& ego_pose, Point2fSoA& points);
 
 } // end namespace point
 
@@ -6,24 +6,62 @@
 #pragma once
 
 #include "francor_base/point.h"
+#include "francor_base/transform.h"
 
 namespace francor {
 
 namespace base {
 
-class Transform2d;
-
 namespace algorithm {
 
 namespace transform {
 
 /**
  * \brief Transforms a set of points by given transform.
- * 
+ *
  * \param transform The points will be transformed by that transfrom.
  * \param points Transformed points.
  */
 void transformPointVector(const Transform2d& transform, Point2dVector& points);
+void transformPointVector(const Transform2f& transform, Point2fVector& points);
+/**
+ * \brief Transforms a set of points by given transform and writes the result to output.
+ *
+ * \param transform The points will be transformed by that transfrom.
+ * \param input Points that will be transformed.
+ * \param output Transformed points. Will be resized to the size of input.
+ */
+void transformPointVector(const Transform2d& transform, const Point2dVector& input, Point2dVector& output);
+void transformPointVector(const Transform2f& transform, const Point2fVector& input, Point2fVector& output);
+/**
+ * \brief Transforms a set of points stored as structure of arrays by given transform.
+ *
+ * \param transform The points will be transformed by that transfrom.
+ * \param points Transformed points.
+ */
+void transformPointVector(const Transform2d& transform, Point2dSoA& points);
+void transformPointVector(const Transform2f& transform, Point2fSoA& points);
+/**
+ * \brief Batch kernel used by the functions above. Transforms count points from input to output. Input and output
+ *        can be the same array. The float version processes twice as many points per AVX2 register.
+ */
+void transformPoints(const Transform2d& transform, const Point2d* input, Point2d* output, const std::size_t count);
+void transformPoints(const Transform2f& transform, const Point2f* input, Point2f* output, const std::size_t count);
+
+/**
+ * \brief Transforms the points in place and calculates in the same pass the squared distance of each transformed
+ *        point to the reference point with the same index. Meant for ICP, where the correspondences are
+ *        gathered in the reference vector.
+ *
+ * \param transform The points will be transformed by that transfrom.
+ * \param points Transformed points.
+ * \param references Reference points, must be of the same size as points.
+ * \return Sum of the squared residuals.
+ */
+double transformAndSumSquaredResiduals(const Transform2d& transform, Point2dVector& points,
+                                       const Point2dVector& references);
+double transformAndSumSquaredResiduals(const Transform2f& transform, Point2fVector& points,
+                                       const Point2fVector& references);
 
 } // end namespace transform
 
@@ -31,4 +69,4 @@ void transformPointVector(const Transform2d& transform, Point2dVector& points);
 
 } // end namespace base
 
-} // end namespace francor
\ No newline at end of file
+} // end namespace francor
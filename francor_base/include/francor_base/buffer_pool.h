@@ -0,0 +1,271 @@
+/**
+ * Implements a pool of reference counted buffers. Processing stages acquire their output buffers from a pool and pass
+ * them downstream by handle. A buffer goes back to its pool when the last handle is released, so the allocated memory
+ * is reused over frames.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include "francor_base/reference_counter.h"
+#include "francor_base/log.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <stdexcept>
+
+namespace francor {
+
+namespace base {
+
+template <typename Data>
+class BufferPool;
+
+namespace impl {
+
+template <typename Data>
+class BufferPoolStorage;
+
+/**
+ * \brief A pooled buffer. Holds the data, the number of handles referencing it and its owning storage as long as it
+ *        is in use.
+ */
+template <typename Data>
+struct BufferSlot
+{
+  Data data;
+  ReferenceCounter references;
+  std::shared_ptr<BufferPoolStorage<Data>> owner; //> keeps the storage alive as long as this buffer is in use
+};
+
+/**
+ * \brief Owns all buffers of a pool. It is shared between the pool and all buffers in use, so handles stay valid
+ *        even if the pool is destroyed before them.
+ */
+template <typename Data>
+class BufferPoolStorage
+{
+public:
+  BufferSlot<Data>* take()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_available.empty()) {
+      _slots.push_back(std::make_unique<BufferSlot<Data>>());
+      return _slots.back().get();
+    }
+
+    BufferSlot<Data>* slot = _available.back();
+    _available.pop_back();
+
+    return slot;
+  }
+  void giveBack(BufferSlot<Data>* slot)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _available.push_back(slot);
+  }
+  void reserve(const std::size_t num_buffers)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    while (_slots.size() < num_buffers) {
+      _slots.push_back(std::make_unique<BufferSlot<Data>>());
+      _available.push_back(_slots.back().get());
+    }
+  }
+  std::size_t size() const
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _slots.size();
+  }
+  std::size_t numOfAvailable() const
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _available.size();
+  }
+
+private:
+  mutable std::mutex _mutex;
+  std::vector<std::unique_ptr<BufferSlot<Data>>> _slots;
+  std::vector<BufferSlot<Data>*> _available;
+};
+
+} // end namespace impl
+
+/**
+ * \brief Handle to a buffer of a BufferPool. Copying a handle shares the buffer, no data is copied. The buffer is
+ *        given back to its pool when the last handle is released. The content of a returned buffer is kept, so
+ *        already allocated memory (e.g. the capacity of a std::vector) is reused by the next user.
+ */
+template <typename Data>
+class BufferHandle
+{
+public:
+  /**
+   * \brief Constructs an empty handle that references no buffer.
+   */
+  BufferHandle() = default;
+  /**
+   * \brief Shares the buffer of rhs.
+   */
+  BufferHandle(const BufferHandle& rhs) : _slot(rhs._slot)
+  {
+    if (_slot != nullptr) {
+      _slot->references.increase();
+    }
+  }
+  /**
+   * \brief Takes over the buffer reference of rhs. Afterwards rhs is empty.
+   */
+  BufferHandle(BufferHandle&& rhs) noexcept : _slot(rhs._slot)
+  {
+    rhs._slot = nullptr;
+  }
+  /**
+   * \brief Releases the referenced buffer.
+   */
+  ~BufferHandle() { this->reset(); }
+
+  BufferHandle& operator=(const BufferHandle& rhs)
+  {
+    if (_slot != rhs._slot) {
+      BufferHandle copy(rhs);
+      this->swap(copy);
+    }
+
+    return *this;
+  }
+  BufferHandle& operator=(BufferHandle&& rhs) noexcept
+  {
+    if (this != &rhs) {
+      this->reset();
+      _slot = rhs._slot;
+      rhs._slot = nullptr;
+    }
+
+    return *this;
+  }
+  /**
+   * \brief Releases the referenced buffer. If this was the last handle the buffer goes back to its pool.
+   */
+  void reset() noexcept
+  {
+    if (_slot == nullptr) {
+      return;
+    }
+    if (_slot->references.decrease() == 0u) {
+      // last handle: give buffer back, the storage must live at least until the buffer is stored in it
+      auto owner = std::move(_slot->owner);
+      owner->giveBack(_slot);
+    }
+
+    _slot = nullptr;
+  }
+  inline void swap(BufferHandle& rhs) noexcept { std::swap(_slot, rhs._slot); }
+
+  /**
+   * \brief Checks if this handle references a buffer.
+   */
+  inline bool isValid() const noexcept { return _slot != nullptr; }
+  inline explicit operator bool() const noexcept { return this->isValid(); }
+  /**
+   * \brief Returns the number of handles referencing the same buffer.
+   * \return Number of handles. Zero if this handle is empty.
+   */
+  inline std::size_t useCount() const noexcept { return _slot != nullptr ? _slot->references.count() : 0u; }
+
+  /**
+   * \brief Accesses the buffer. If the handle is empty an exception is thrown.
+   */
+  inline Data& get()
+  {
+    this->checkSlot();
+    return _slot->data;
+  }
+  inline const Data& get() const
+  {
+    this->checkSlot();
+    return _slot->data;
+  }
+  inline Data& operator*() { return this->get(); }
+  inline const Data& operator*() const { return this->get(); }
+  inline Data* operator->() { return &this->get(); }
+  inline const Data* operator->() const { return &this->get(); }
+
+private:
+  friend class BufferPool<Data>;
+
+  explicit BufferHandle(impl::BufferSlot<Data>* slot) : _slot(slot) { }
+
+  inline void checkSlot() const
+  {
+    if (_slot == nullptr) {
+      LogError() << "BufferHandle: handle doesn't reference a buffer.";
+      throw std::runtime_error("BufferHandle: handle doesn't reference a buffer.");
+    }
+  }
+
+  impl::BufferSlot<Data>* _slot = nullptr;
+};
+
+/**
+ * \brief A pool of reusable buffers. A buffer is acquired as handle and returns automatically to this pool when the
+ *        last handle is released. New buffers are allocated only if all existing ones are in use.
+ */
+template <typename Data>
+class BufferPool
+{
+public:
+  /**
+   * \brief Constructs a pool and preallocates num_buffers buffers.
+   * \param num_buffers Number of preallocated buffers.
+   */
+  explicit BufferPool(const std::size_t num_buffers = 0u)
+    : _storage(std::make_shared<impl::BufferPoolStorage<Data>>())
+  {
+    _storage->reserve(num_buffers);
+  }
+  BufferPool(const BufferPool&) = delete;
+  BufferPool(BufferPool&&) = default;
+  ~BufferPool() = default;
+
+  BufferPool& operator=(const BufferPool&) = delete;
+  BufferPool& operator=(BufferPool&&) = default;
+
+  /**
+   * \brief Acquires an unused buffer. The content of the buffer is the one of its last usage.
+   * \return A handle to the acquired buffer.
+   */
+  BufferHandle<Data> acquire()
+  {
+    impl::BufferSlot<Data>* slot = _storage->take();
+
+    slot->owner = _storage;
+    slot->references.increase();
+
+    return BufferHandle<Data>(slot);
+  }
+  /**
+   * \brief Allocates buffers until num_buffers buffers are owned by this pool.
+   * \param num_buffers The minimum number of buffers.
+   */
+  inline void reserve(const std::size_t num_buffers) { _storage->reserve(num_buffers); }
+  /**
+   * \brief Returns the number of buffers owned by this pool, used or not.
+   */
+  inline std::size_t size() const { return _storage->size(); }
+  /**
+   * \brief Returns the number of buffers that are currently not in use.
+   */
+  inline std::size_t numOfAvailable() const { return _storage->numOfAvailable(); }
+
+private:
+  std::shared_ptr<impl::BufferPoolStorage<Data>> _storage;
+};
+
+} // end namespace base
+
+} // end namespace francor
@@ -0,0 +1,114 @@
+/**
+ * Monotonic arena for short-lived temporaries of one frame. Each thread has its own arena, so allocating from it needs
+ * no lock. Algorithms use it through std::pmr containers and rewind it when they return; pipelines rewind it at frame
+ * end. The memory blocks are kept, so after the first frames no allocation reaches the heap anymore.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace francor {
+
+namespace base {
+
+class FrameArena final : public std::pmr::memory_resource
+{
+public:
+  /**
+   * \brief Position in the arena. Rewinding to a marker releases everything allocated after it was taken.
+   */
+  struct Marker
+  {
+    std::size_t block;
+    std::size_t offset;
+  };
+
+  explicit FrameArena(const std::size_t block_size = 1u << 16) : _block_size(block_size) { }
+  FrameArena(const FrameArena&) = delete;
+  FrameArena(FrameArena&&) = delete;
+  ~FrameArena() final = default;
+
+  FrameArena& operator=(const FrameArena&) = delete;
+  FrameArena& operator=(FrameArena&&) = delete;
+
+  /**
+   * \brief Arena of the calling thread.
+   */
+  static FrameArena& threadInstance();
+
+  inline Marker marker() const noexcept { return { _current, _offset }; }
+  /**
+   * \brief Releases all memory allocated after the marker was taken. Memory must be released in reverse order of
+   *        allocation, like a stack.
+   */
+  void rewind(const Marker& marker);
+  /**
+   * \brief Releases all memory. If more than one block was needed, the blocks are merged into a single one.
+   */
+  inline void reset() { this->rewind({ 0, 0 }); }
+
+  /**
+   * \brief Size of all memory blocks in byte.
+   */
+  std::size_t capacity() const noexcept;
+  inline std::size_t numOfBlocks() const noexcept { return _blocks.size(); }
+
+private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) final;
+  void do_deallocate(void*, std::size_t, std::size_t) final { }
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept final { return this == &other; }
+
+  void* allocateFromCurrentBlock(const std::size_t bytes, const std::size_t alignment);
+
+  struct Block
+  {
+    std::unique_ptr<std::byte[]> data;
+    std::size_t size;
+  };
+
+  std::vector<Block> _blocks;
+  std::size_t _current = 0;    //> index of the block allocations are taken from
+  std::size_t _offset = 0;     //> first free byte in the current block
+  std::size_t _block_size;     //> minimum size of a new block
+};
+
+/**
+ * \brief Rewinds an arena to the position it had on construction when the scope ends. By default the arena of the
+ *        calling thread is used.
+ */
+class FrameArenaScope
+{
+public:
+  FrameArenaScope() : FrameArenaScope(FrameArena::threadInstance()) { }
+  explicit FrameArenaScope(FrameArena& arena) : _arena(arena), _marker(arena.marker()) { }
+  FrameArenaScope(const FrameArenaScope&) = delete;
+  FrameArenaScope(FrameArenaScope&&) = delete;
+  ~FrameArenaScope() { _arena.rewind(_marker); }
+
+  FrameArenaScope& operator=(const FrameArenaScope&) = delete;
+  FrameArenaScope& operator=(FrameArenaScope&&) = delete;
+
+  inline FrameArena& arena() noexcept { return _arena; }
+  /**
+   * \brief Returns the given memory resource or the arena of this scope if it is nullptr. Used by functions that
+   *        take an optional memory resource for their temporaries.
+   */
+  inline std::pmr::memory_resource* resource(std::pmr::memory_resource* const memory_resource) noexcept
+  {
+    return memory_resource != nullptr ? memory_resource : &_arena;
+  }
+
+private:
+  FrameArena& _arena;
+  FrameArena::Marker _marker;
+};
+
+} // end namespace base
+
+} // end namespace francor
@@ -7,19 +7,60 @@
 #pragma once
 
 #include <vector>
+#include <memory>
 #include <ostream>
 
+#include <Eigen/Core>
+
 #include "francor_base/angle.h"
 #include "francor_base/pose.h"
+#include "francor_base/span.h"
 #include "francor_base/sensor_data.h"
 
 namespace francor {
 
 namespace base {
 
+/**
+ * \brief Cosine and sine of each beam angle of a laser scan layout. Tables are shared between all scans that have
+ *        the same phi min, phi step and number of beams.
+ */
+class BeamTrigonometry
+{
+public:
+  using Table = std::vector<double, Eigen::aligned_allocator<double>>;
+
+  BeamTrigonometry(const Angle phi_min, const Angle phi_step, const std::size_t num_beams);
+
+  /**
+   * \brief Returns the tables of the given layout. They are calculated only if the layout is requested the first
+   *        time. Thread safe.
+   */
+  static std::shared_ptr<const BeamTrigonometry> get(const Angle phi_min, const Angle phi_step,
+                                                     const std::size_t num_beams);
+
+  inline Angle phiMin() const noexcept { return _phi_min; }
+  inline Angle phiStep() const noexcept { return _phi_step; }
+  inline std::size_t size() const noexcept { return _cos.size(); }
+  inline Span<const double> cos() const noexcept { return _cos; }
+  inline Span<const double> sin() const noexcept { return _sin; }
+
+private:
+  Angle _phi_min;
+  Angle _phi_step;
+  Table _cos;
+  Table _sin;
+};
+
+/**
+ * \brief A laser scan. The distances are stored as float in aligned memory. Derived per beam data is calculated
+ *        on first access and shared between copies of the scan.
+ */
 class LaserScan : public SensorData
 {
 public:
+  using Distances = std::vector<float, Eigen::aligned_allocator<float>>;
+
   LaserScan(char const* const sensor_name = "unkown") : SensorData(sensor_name, 0.0) { }
   LaserScan(const std::vector<double>& distances,
             const Pose2d& pose,
@@ -31,41 +72,71 @@ public:
             char const* const sensor_name = "unkown",
             const double time_stamp = 0.0)
     : SensorData(sensor_name, time_stamp, pose),
-      _distances(distances),
+      _distances(distances.begin(), distances.end()),
       _phi_step(phiStep),
       _phi_min(phiMin),
       _phi_max(phiMax),
       _range(range),
       _divergence(divergence)
-  {
-    this->estimatePointDiameters();
-  }
+  { }
+  /**
+   * \brief Takes over the distance buffer without copying it.
+   */
+  LaserScan(Distances&& distances,
+            const Pose2d& pose,
+            const Angle phiMin,
+            const Angle phiMax,
+            const Angle phiStep,
+            const double range,
+            const Angle divergence = 0.0,
+            char const* const sensor_name = "unkown",
+            const double time_stamp = 0.0)
+    : SensorData(sensor_name, time_stamp, pose),
+      _distances(std::move(distances)),
+      _phi_step(phiStep),
+      _phi_min(phiMin),
+      _phi_max(phiMax),
+      _range(range),
+      _divergence(divergence)
+  { }
+  LaserScan(const LaserScan& origin);
+  LaserScan(LaserScan&&) = default;
+
+  LaserScan& operator=(const LaserScan& origin);
+  LaserScan& operator=(LaserScan&&) = default;
 
   inline Angle phiMax() const noexcept { return _phi_max; }
   inline Angle phiMin() const noexcept { return _phi_min; }
   inline Angle phiStep() const noexcept { return _phi_step; }
   inline Angle divergence() const noexcept { return _divergence; }
-  inline const std::vector<double> distances() const noexcept { return _distances; }
+  inline Span<const float> distances() const noexcept { return _distances; }
   inline double range() const noexcept { return _range; }
-  inline const std::vector<float>& pointExpansions() const noexcept { return _point_diameters; }
+  /**
+   * \brief Returns the point diameter of each distance measurement (dealing with divergence). Calculated on first
+   *        call.
+   */
+  Span<const float> pointExpansions() const;
+  /**
+   * \brief Returns cosine and sine of each beam angle relative to the sensor. Calculated on first call, tables are
+   *        shared between scans of the same layout.
+   */
+  const BeamTrigonometry& trigonometry() const;
+
+  /**
+   * \brief Moves the distance buffer out of this scan, e.g. to reuse its memory for the next scan. The scan is
+   *        empty afterwards.
+   */
+  Distances releaseDistances();
 
 private:
-  void estimatePointDiameters()
-  {
-    _point_diameters.resize(_distances.size());
-
-    for (std::size_t i = 0; i < _point_diameters.size(); ++i) {
-      _point_diameters[i] = std::sin(_divergence / 2.0) * _distances[i] * 2.0;
-    }
-  }
-
-  std::vector<double> _distances;
+  Distances _distances;
   Angle _phi_step{0.0};
   Angle _phi_min{0.0};
   Angle _phi_max{0.0};
   double _range{0.0};
   Angle _divergence{0.0};
-  std::vector<float> _point_diameters; //> holds the point diameter of each distance measurement (dealing with divergence)
+  mutable std::shared_ptr<const Distances> _point_diameters;        //> lazy, accessed atomically
+  mutable std::shared_ptr<const BeamTrigonometry> _trigonometry;   //> lazy, accessed atomically
 };
 
 } // end namespace base
@@ -85,11 +156,11 @@ inline ostream& operator<<(ostream& os, const francor::base::LaserScan& scan)
   os << "phi step   : " << scan.phiStep() << std::endl;
   os << "range      : " << scan.range() << std::endl;
   os << "distances[]: ";
-  
+
   for (const auto& distance : scan.distances())
     os << "[" << distance << "] ";
 
   return os;
 }
 
-} // end namespace std
\ No newline at end of file
+} // end namespace std
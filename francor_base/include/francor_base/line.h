@@ -21,6 +21,9 @@ namespace base {
 
 using francor::base::Angle;
 
+namespace impl {
+
+template <typename Type>
 class Line
 {
 public:
@@ -35,7 +38,7 @@ public:
    * \param x0 x-value of this line for y == 0. Note: that value is ussely set by this class automatically, but
    *        in case the angle is close to pi/2 or -pi/2 it helps a lot.
    */
-  constexpr Line(const Angle& angle = Angle(0.0), const Point2d& point = Point2d(0.0, 0.0))
+  constexpr Line(const Angle& angle = Angle(0.0), const Point2<Type>& point = Point2<Type>(0.0, 0.0))
     : _phi(angle),
       _p(point)
   {
@@ -47,12 +50,12 @@ public:
    * 
    * \return The normal of this line.
    */
-  inline Vector2d n() const { return algorithm::line::calculateV(_phi + M_PI_2); }
-  inline Vector2d v() const { return algorithm::line::calculateV(_phi); }
-  inline constexpr double x0() const { const double delta_x = _p.y() / std::tan(_phi); return _phi >= 0.0 ? _p.x() - delta_x : _p.x() + delta_x; }
-  inline constexpr double y0() const { const double delta_y = _p.x() * std::tan(_phi); return _phi >= 0.0 ? _p.y() - delta_y : _p.x() + delta_y; }
+  inline Vector2<Type> n() const { return algorithm::line::calculateV(_phi + M_PI_2).template cast<Type>(); }
+  inline Vector2<Type> v() const { return algorithm::line::calculateV(_phi).template cast<Type>(); }
+  inline constexpr Type x0() const { const Type delta_x = _p.y() / std::tan(_phi); return _phi >= 0.0 ? _p.x() - delta_x : _p.x() + delta_x; }
+  inline constexpr Type y0() const { const Type delta_y = _p.x() * std::tan(_phi); return _phi >= 0.0 ? _p.y() - delta_y : _p.x() + delta_y; }
   inline constexpr Angle phi() const noexcept { return _phi; }
-  inline constexpr const Point2d& p() const noexcept { return _p; }
+  inline constexpr const Point2<Type>& p() const noexcept { return _p; }
 
   /**
    * Calculates the y value for the given x value.
@@ -60,7 +63,7 @@ public:
    * \param x The x value.
    * \return y The y value for given x value.
    */
-  inline constexpr double y(const double x) const { return std::tan(_phi) * x + _p.y(); }
+  inline constexpr Type y(const Type x) const { return std::tan(_phi) * x + _p.y(); }
 
   /**
    * Calculates the x value for the given y value.
@@ -68,7 +71,7 @@ public:
    * \param y The y value.
    * \return x The x value for the given y value.
    */
-  inline constexpr double x(const double y) const { return y / std::tan(_phi) + _p.x(); }
+  inline constexpr Type x(const Type y) const { return y / std::tan(_phi) + _p.x(); }
 
   /**
    * Calculates the distance along the normal of this line.
@@ -76,12 +79,12 @@ public:
    * \param p The distance will be calculated to that point.
    * \return Distance to the point p.
    */
-  double distanceTo(const Point2d p) const
+  Type distanceTo(const Point2<Type> p) const
   {
-    const Vector2d hypotenuse = p - _p;
-    const double hypotenuse_length = hypotenuse.norm();
+    const Vector2<Type> hypotenuse = p - _p;
+    const Type hypotenuse_length = hypotenuse.norm();
     const double angle_hypotenuse = std::atan2(hypotenuse.y(), hypotenuse.x());
-    const double gegenkathete_length = std::abs(std::sin(angle_hypotenuse - _phi) * hypotenuse_length);
+    const Type gegenkathete_length = std::abs(std::sin(angle_hypotenuse - _phi) * hypotenuse_length);
 
     return gegenkathete_length;
   }
@@ -92,7 +95,7 @@ public:
    * \param line Other line.
    * \return Intersection point of that two lines.
    */
-  Point2d intersectionPoint(const Line& line) const
+  Point2<Type> intersectionPoint(const Line& line) const
   {
     // p_x = intersection point
     //
@@ -113,19 +116,19 @@ public:
     // 
     const auto v0 = this->v();
     const auto v1 = line.v();
-    const double a = (line._p.y() - _p.y()) * v1.x() + (_p.x() - line._p.x()) * v1.y();
-    const double b = v0.y() * v1.x() - v0.x() * v1.y();
-    const double s0 = a / b;
+    const Type a = (line._p.y() - _p.y()) * v1.x() + (_p.x() - line._p.x()) * v1.y();
+    const Type b = v0.y() * v1.x() - v0.x() * v1.y();
+    const Type s0 = a / b;
 
     return _p + v0 * s0;
   }
 
-  static Line createFromVectorAndPoint(const Vector2d& v, const Point2d& p)
+  static Line createFromVectorAndPoint(const Vector2<Type>& v, const Point2<Type>& p)
   {
     assert(v.norm() - 1.0 <= 1e-6);
     return { std::atan2(v.y(), v.x()), p };
   }
-  static Line createFromTwoPoints(const Point2d& p0, const Point2d& p1)
+  static Line createFromTwoPoints(const Point2<Type>& p0, const Point2<Type>& p1)
   {
     assert(p0 != p1);
     const auto v = (p1 - p0).normalized();
@@ -134,10 +137,16 @@ public:
 
 private:
   AnglePi2ToPi2 _phi; //> angle in rad of the gradient regarding the x-axis
-  Point2d _p; //> center point of this line
+  Point2<Type> _p; //> center point of this line
 };
 
+} // end namespace impl
+
+using Line = impl::Line<double>;
+using Linef = impl::Line<float>;
+
 using LineVector = std::vector<Line>;
+using LineVectorf = std::vector<Linef>;
 
 } // end namespace base
 
@@ -146,7 +155,8 @@ using LineVector = std::vector<Line>;
 namespace std
 {
 
-inline std::ostream& operator<<(std::ostream& os, const francor::base::Line& line)
+template <typename Type>
+inline std::ostream& operator<<(std::ostream& os, const francor::base::impl::Line<Type>& line)
 {
   os << "line [phi = " << line.phi().radian() << ", p = " << line.p() << "]";
 
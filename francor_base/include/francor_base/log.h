@@ -6,8 +6,27 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <mutex>
+#include <sstream>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// log statements below this level are removed at compile time (0 = DEBUG ... 4 = FATAL)
+#ifndef FRANCOR_LOG_MIN_LEVEL
+#define FRANCOR_LOG_MIN_LEVEL 0
+#endif
+
+/**
+ * \brief Evaluates the log statement only if the level is enabled. Unlike a plain LogDebug() << ..., the arguments
+ *        are not evaluated if the level is filtered, so it is the choice for log statements in hot paths.
+ *
+ *        Usage: FRANCOR_LOG(base::LogDebug) << "value = " << value;
+ */
+#define FRANCOR_LOG(LogType) if (!LogType::isEnabled()) { } else LogType()
 
 namespace francor
 {
@@ -26,70 +45,180 @@ enum class LogLevel : std::uint8_t {
 void setLogLevel(const LogLevel level);
 LogLevel getLogLevel(void);
 
-//TODO: make thread safe
+/**
+ * \brief Starts a background thread that writes the log messages to the sink. Each logging thread gets its own
+ *        lock-free ring buffer, the messages are stored binary encoded and formatted by the background thread. If
+ *        the ring buffer of a thread is full, the thread waits until it is drained. Messages larger than half of the
+ *        buffer are written directly after the pending messages of the thread, so the order is kept.
+ *
+ * \param buffer_size Size of each per thread ring buffer in byte. Will be rounded up to a power of two.
+ */
+void enableAsyncLogging(const std::size_t buffer_size = 1u << 16);
+/**
+ * \brief Writes all pending messages and stops the background thread. Messages are written directly afterwards.
+ */
+void disableAsyncLogging();
+bool isAsyncLoggingEnabled();
+/**
+ * \brief Blocks until all messages committed before this call are written to the sink.
+ */
+void flushLog();
+/**
+ * \brief Sets the stream all log messages are written to. Default is std::clog. The stream must stay valid until
+ *        an other sink is set.
+ */
+void setLogSink(std::ostream& sink);
+
+namespace impl {
+
+enum class LogArgument : std::uint8_t {
+  BOOL = 0,
+  CHAR,
+  INT,
+  UINT,
+  REAL,
+  STRING,
+};
+
+/**
+ * \brief Binary encoded log message of the current thread. It is filled by a Log object and committed to the
+ *        backend when the Log object is destroyed. Numbers are stored raw, only types without a binary encoding are
+ *        formatted using their stream operator.
+ */
+class LogMessage
+{
+public:
+  static LogMessage& instance()
+  {
+    static thread_local LogMessage message;
+    return message;
+  }
+
+  inline bool isOpen() const noexcept { return _open; }
+  inline void open(const LogLevel level)
+  {
+    _data.clear();
+    _data.push_back(static_cast<std::uint8_t>(level));
+    _open = true;
+  }
+  void commit();
+
+  template <typename Type>
+  void append(const Type& value)
+  {
+    if constexpr (std::is_same<Type, bool>::value) {
+      this->appendValue(LogArgument::BOOL, static_cast<std::uint8_t>(value));
+    }
+    else if constexpr (std::is_same<Type, char>::value || std::is_same<Type, signed char>::value
+                       || std::is_same<Type, unsigned char>::value) {
+      this->appendValue(LogArgument::CHAR, static_cast<char>(value));
+    }
+    else if constexpr (std::is_integral<Type>::value && std::is_signed<Type>::value) {
+      this->appendValue(LogArgument::INT, static_cast<std::int64_t>(value));
+    }
+    else if constexpr (std::is_integral<Type>::value) {
+      this->appendValue(LogArgument::UINT, static_cast<std::uint64_t>(value));
+    }
+    else if constexpr (std::is_floating_point<Type>::value) {
+      this->appendValue(LogArgument::REAL, static_cast<double>(value));
+    }
+    else if constexpr (std::is_convertible<const Type&, std::string_view>::value) {
+      this->appendString(std::string_view(value));
+    }
+    else {
+      std::ostringstream os;
+      os << value;
+      this->appendString(os.str());
+    }
+  }
+
+private:
+  LogMessage() = default;
+
+  template <typename Value>
+  inline void appendValue(const LogArgument type, const Value value)
+  {
+    const std::size_t offset = _data.size();
+    _data.resize(offset + 1 + sizeof(value));
+    _data[offset] = static_cast<std::uint8_t>(type);
+    std::memcpy(_data.data() + offset + 1, &value, sizeof(value));
+  }
+  inline void appendString(const std::string_view value)
+  {
+    const std::uint32_t size = static_cast<std::uint32_t>(value.size());
+    this->appendValue(LogArgument::STRING, size);
+    _data.insert(_data.end(), value.begin(), value.end());
+  }
+
+  std::vector<std::uint8_t> _data;
+  bool _open = false;
+};
+
+/**
+ * \brief Decodes a binary log message and writes it as text line into the stream.
+ */
+void writeLogMessage(std::ostream& os, const std::uint8_t* data, const std::size_t size);
+
+} // end namespace impl
+
 template <LogLevel Level>
 class Log
 {
 public:
+  static constexpr LogLevel level = Level;
+  static constexpr bool COMPILED = static_cast<int>(Level) >= FRANCOR_LOG_MIN_LEVEL;
+
   Log()
   {
-    this->printWarnLevel(Level);
+    if constexpr (COMPILED) {
+      auto& message = impl::LogMessage::instance();
+
+      // a log statement inside a stream operator of a logged object would break the open message, so it is dropped
+      if (Level >= getLogLevel() && !message.isOpen()) {
+        message.open(Level);
+        _message = &message;
+      }
+    }
   }
   Log(const Log<Level>&) = delete;
   Log(Log<Level>&&) = delete;
   ~Log()
   {
-    if (Level >= getLogLevel())
-      std::clog << std::endl;
+    if constexpr (COMPILED) {
+      if (_message != nullptr)
+        _message->commit();
+    }
   }
 
   Log<Level>& operator=(const Log<Level>&) = delete;
   Log<Level>& operator=(Log<Level>&&) = delete;
 
-  static constexpr LogLevel level = Level;
+  /**
+   * \brief Checks if messages of this level will be written. Is constant false if the level is removed at compile
+   *        time.
+   */
+  static inline bool isEnabled()
+  {
+    if constexpr (COMPILED)
+      return Level >= getLogLevel();
+    else
+      return false;
+  }
 
   template<typename T>
   const Log<Level>& operator<<(const T& in) const
   {
-    // if global log level lower than of *this return without
-    if (Level < getLogLevel())
-      return *this;
-
-    std::clog << in;
+    if constexpr (COMPILED) {
+      // if global log level lower than of *this the message isn't open
+      if (_message != nullptr)
+        _message->append(in);
+    }
 
     return *this;
   }
 
 private:
-  static void printWarnLevel(const LogLevel level)
-  {
-    switch (level)
-    {
-    case LogLevel::DEBUG:
-      std::clog << "[DEBUG] ";
-      break;
-
-    case LogLevel::INFO:
-      std::clog << "[INFO] ";
-      break;
-
-    case LogLevel::WARNING:
-      std::clog << "[WARNING] ";
-      break;
-
-    case LogLevel::ERROR:
-      std::clog << "[ERROR] ";
-      break;
-
-    case LogLevel::FATAL:
-      std::clog << "[FATAL] ";
-      break;
-
-    default:
-      std::clog << "[UNKOWN] ";
-      break;
-    }
-  }
+  impl::LogMessage* _message = nullptr;
 };
 
 using LogDebug = Log<LogLevel::DEBUG>;
@@ -100,4 +229,4 @@ using LogFatal = Log<LogLevel::FATAL>;
 
 } // end namespace base
 
-} // end namespace francor
\ No newline at end of file
+} // end namespace francor
@@ -17,6 +17,8 @@ namespace base
 using Matrix2d = Eigen::Matrix2d;
 using Matrix3d = Eigen::Matrix3d;
 using Matrix4d = Eigen::Matrix4d;
+using Matrix2f = Eigen::Matrix2f;
+using Matrix3f = Eigen::Matrix3f;
 
 template <typename Type, std::size_t Rows, std::size_t Cols>
 using Matrix = Eigen::Matrix<Type, Rows, Cols>;
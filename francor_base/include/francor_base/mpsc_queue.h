@@ -0,0 +1,94 @@
+/**
+ * Implements a lock-free multiple producer single consumer queue.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace francor {
+
+namespace base {
+
+/**
+ * \brief Unbounded lock-free queue. Any number of threads can push concurrently, but only one thread is allowed to
+ *        pop. Pushing never blocks. Popping is wait free, but can report an empty queue while a producer is in the
+ *        middle of pushing. The pushed element is visible with the next call of pop().
+ *
+ *        Implementation follows the intrusive MPSC node queue of Dmitry Vyukov.
+ */
+template <typename Data>
+class MpscQueue
+{
+public:
+  MpscQueue() : _head(new Node()), _tail(_head.load(std::memory_order_relaxed)) { }
+  MpscQueue(const MpscQueue&) = delete;
+  ~MpscQueue()
+  {
+    Data data;
+    while (this->pop(data)) { }
+
+    delete _tail;
+  }
+
+  MpscQueue& operator=(const MpscQueue&) = delete;
+
+  /**
+   * \brief Adds an element to the queue. Can be called from any thread.
+   * \param data Element that will be moved into the queue.
+   */
+  void push(Data data)
+  {
+    Node* node = new Node(std::move(data));
+    Node* previous = _head.exchange(node, std::memory_order_acq_rel);
+
+    // links node to queue, after that the consumer can see it
+    previous->next.store(node, std::memory_order_release);
+  }
+  /**
+   * \brief Takes the oldest element from the queue. Must be called only by the consumer thread.
+   * \param data The taken element is moved into it.
+   * \return true if an element was taken, false if queue is empty.
+   */
+  bool pop(Data& data)
+  {
+    Node* tail = _tail;
+    Node* next = tail->next.load(std::memory_order_acquire);
+
+    if (next == nullptr) {
+      return false;
+    }
+
+    // next becomes the new dummy node, so its data is taken now
+    data = std::move(next->data);
+    _tail = next;
+    delete tail;
+
+    return true;
+  }
+  /**
+   * \brief Checks if the queue is empty. Must be called only by the consumer thread.
+   * \return true if no element is available.
+   */
+  inline bool empty() const { return _tail->next.load(std::memory_order_acquire) == nullptr; }
+
+private:
+  struct Node
+  {
+    Node() = default;
+    explicit Node(Data&& value) : data(std::move(value)) { }
+
+    std::atomic<Node*> next{nullptr};
+    Data data{};
+  };
+
+  alignas(64) std::atomic<Node*> _head; //> last pushed node, written by producers
+  alignas(64) Node* _tail;              //> dummy node in front of the oldest element, owned by consumer
+};
+
+} // end namespace base
+
+} // end namespace francor
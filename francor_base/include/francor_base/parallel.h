@@ -0,0 +1,84 @@
+/**
+ * Simple parallel loop on top of std::thread. Meant for coarse grained work like casting the beams of laser scans,
+ * where the cost of starting the threads is small compared to the work.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace francor {
+
+namespace base {
+
+namespace impl {
+
+inline std::atomic<std::size_t>& maxParallelThreads()
+{
+  static std::atomic<std::size_t> num_threads(std::max(std::thread::hardware_concurrency(), 1u));
+  return num_threads;
+}
+
+} // end namespace impl
+
+/**
+ * \brief Sets the maximum number of threads used by parallelFor() including the calling thread. 1 disables the
+ *        threading. Default is the number of hardware threads.
+ */
+inline void setMaxParallelThreads(const std::size_t num_threads)
+{
+  impl::maxParallelThreads() = std::max<std::size_t>(num_threads, 1);
+}
+inline std::size_t maxParallelThreads() { return impl::maxParallelThreads(); }
+
+/**
+ * \brief Splits [begin, end) into contiguous chunks and calls function(chunk_begin, chunk_end) for each chunk on its
+ *        own thread. The calling thread processes the first chunk and returns when all chunks are done. Don't call it
+ *        from inside the function, the threads would multiply.
+ *
+ * \param begin First index.
+ * \param end Index behind the last one.
+ * \param grain_size Minimum number of indices per chunk. A range smaller than two grains is processed by the calling
+ *                   thread only.
+ * \param function Callable with signature void(std::size_t, std::size_t).
+ */
+template <typename Function>
+void parallelFor(const std::size_t begin, const std::size_t end, const std::size_t grain_size, Function function)
+{
+  if (end <= begin) {
+    return;
+  }
+
+  const std::size_t count = end - begin;
+  const std::size_t num_chunks = std::min(maxParallelThreads(),
+                                          std::max<std::size_t>(count / std::max<std::size_t>(grain_size, 1), 1));
+  const auto chunkBegin = [&] (const std::size_t chunk) { return begin + count * chunk / num_chunks; };
+
+  if (num_chunks == 1) {
+    function(begin, end);
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_chunks - 1);
+
+  for (std::size_t chunk = 1; chunk < num_chunks; ++chunk) {
+    threads.emplace_back(function, chunkBegin(chunk), chunkBegin(chunk + 1));
+  }
+
+  function(begin, chunkBegin(1));
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+} // end namespace base
+
+} // end namespace francor
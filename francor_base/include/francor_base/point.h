@@ -23,6 +23,10 @@ class Point2
 {
 public:
   constexpr Point2(const Type x = 0.0, const Type y = 0.0) : _x(x), _y(y) { }
+  template <typename Other>
+  explicit constexpr Point2(const Point2<Other>& point)
+    : _x(static_cast<Type>(point.x())), _y(static_cast<Type>(point.y()))
+  { }
 
   inline constexpr Type& x() noexcept { return _x; }
   inline constexpr Type x() const noexcept { return _x; }
@@ -38,7 +42,7 @@ public:
   inline constexpr Point2 operator+(const Vector2<Type>& operant) const { return { _x + operant.x(), _y + operant.y() }; }
   inline constexpr Point2 operator+(const Point2& operant) const { return { _x + operant.x(), _y + operant.y() }; }
   inline constexpr Point2& operator+=(const Point2& operant) { _x += operant._x; _y += operant._y; return *this; }
-  inline constexpr Point2& operator/=(const double operant) { _x /= operant; _y /= operant; return *this; }
+  inline constexpr Point2& operator/=(const Type operant) { _x /= operant; _y /= operant; return *this; }
 
   inline constexpr bool operator==(const Point2& operant) const { return _x == operant._x && _y == operant._y; }
   inline constexpr bool operator!=(const Point2& operant) const { return !this->operator==(operant); }
@@ -48,13 +52,52 @@ private:
   Type _y;
 };
 
+/**
+ * \brief Points stored as structure of arrays: all x and all y coordinates in separate aligned vectors. Used by
+ *        batch kernels that process many points at once.
+ */
+template <typename Type>
+class Point2SoA
+{
+public:
+  using Coordinates = std::vector<Type, Eigen::aligned_allocator<Type>>;
+
+  Point2SoA() = default;
+  Point2SoA(const std::size_t size) : _x(size), _y(size) { }
+
+  inline std::size_t size() const noexcept { return _x.size(); }
+  inline bool empty() const noexcept { return _x.empty(); }
+  inline void resize(const std::size_t size) { _x.resize(size); _y.resize(size); }
+  inline void reserve(const std::size_t size) { _x.reserve(size); _y.reserve(size); }
+  inline void clear() noexcept { _x.clear(); _y.clear(); }
+  inline void push_back(const Point2<Type>& point) { _x.push_back(point.x()); _y.push_back(point.y()); }
+
+  inline Point2<Type> operator[](const std::size_t index) const { return { _x[index], _y[index] }; }
+
+  inline Coordinates& x() noexcept { return _x; }
+  inline const Coordinates& x() const noexcept { return _x; }
+  inline Coordinates& y() noexcept { return _y; }
+  inline const Coordinates& y() const noexcept { return _y; }
+
+private:
+  Coordinates _x;
+  Coordinates _y;
+};
+
 } // end namespace impl
 
 template <typename Data>
 using Point2 = impl::Point2<Data>;
 using Point2d = impl::Point2<double>;
+using Point2f = impl::Point2<float>;
+
+template <typename Data>
+using Point2Vector = std::vector<Point2<Data>>;
+using Point2dVector = Point2Vector<double>;
+using Point2fVector = Point2Vector<float>;
 
-using Point2dVector = std::vector<Point2d>;
+using Point2dSoA = impl::Point2SoA<double>;
+using Point2fSoA = impl::Point2SoA<float>;
 
 } // end namespace base
 
@@ -15,22 +15,30 @@ namespace francor {
 
 namespace base {
 
-class Pose2d
+namespace impl {
+
+template <typename Type>
+class Pose2
 {
 public:
-  constexpr Pose2d() : _position(0.0, 0.0), _orientation(0.0) { }
-  constexpr Pose2d(const Point2d& pos, const Angle angle) : _position(pos), _orientation(angle) { }
+  constexpr Pose2() : _position(0.0, 0.0), _orientation(0.0) { }
+  constexpr Pose2(const Point2<Type>& pos, const Angle angle) : _position(pos), _orientation(angle) { }
 
-  inline constexpr const Point2d& position() const noexcept { return _position; }
-  inline constexpr void setPosition(const Point2d& pos) noexcept { _position = pos; }
+  inline constexpr const Point2<Type>& position() const noexcept { return _position; }
+  inline constexpr void setPosition(const Point2<Type>& pos) noexcept { _position = pos; }
   inline constexpr Angle orientation() const noexcept { return _orientation; }
   inline constexpr void setOrientation(const Angle angle) noexcept { _orientation = angle; }
 
 private:
-  Point2d _position;
+  Point2<Type> _position;
   Angle _orientation;
 };
 
+} // end namespace impl
+
+using Pose2d = impl::Pose2<double>;
+using Pose2f = impl::Pose2<float>;
+
 } // end namespace base
 
 } // end namespace francor
@@ -38,7 +46,8 @@ private:
 
 namespace std {
 
-inline ostream& operator<<(ostream& os, const francor::base::Pose2d& pose)
+template <typename Type>
+inline ostream& operator<<(ostream& os, const francor::base::impl::Pose2<Type>& pose)
 {
   os << "pose: [" << pose.orientation() << ", " << pose.position() << "]";
   return os;
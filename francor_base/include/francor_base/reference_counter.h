@@ -7,12 +7,55 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+
 namespace francor {
 
 namespace base {
 
+/**
+ * \brief Thread safe counter of references to an object. It is intended to be embedded into objects that are shared
+ *        by handles. Each handle increases the counter on creation and decreases it on destruction. The handle that
+ *        decreases the counter to zero is responsible to release the object.
+ */
+class ReferenceCounter
+{
+public:
+  /**
+   * \brief Constructs a counter with given initial number of references.
+   * \param initial_count Initial number of references.
+   */
+  explicit ReferenceCounter(const std::size_t initial_count = 0u) : _count(initial_count) { }
+  // a counter belongs to exactly one object, so copying it makes no sense
+  ReferenceCounter(const ReferenceCounter&) = delete;
+  ReferenceCounter& operator=(const ReferenceCounter&) = delete;
+
+  /**
+   * \brief Adds a reference.
+   * \return The number of references after increasing.
+   */
+  inline std::size_t increase() noexcept { return _count.fetch_add(1u, std::memory_order_relaxed) + 1u; }
+  /**
+   * \brief Removes a reference. If zero is returned the caller held the last reference.
+   * \return The number of references after decreasing.
+   */
+  inline std::size_t decrease() noexcept { return _count.fetch_sub(1u, std::memory_order_acq_rel) - 1u; }
+  /**
+   * \brief Returns the current number of references.
+   * \return Current number of references.
+   */
+  inline std::size_t count() const noexcept { return _count.load(std::memory_order_acquire); }
+  /**
+   * \brief Checks if the object is referenced more than once.
+   * \return true if more than one reference exists.
+   */
+  inline bool isShared() const noexcept { return this->count() > 1u; }
 
+private:
+  std::atomic<std::size_t> _count;
+};
 
 } // end namespace base
 
-} // end namespace francor
\ No newline at end of file
+} // end namespace francor
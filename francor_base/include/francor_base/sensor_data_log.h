@@ -0,0 +1,377 @@
+/**
+ * Compact binary log format for sensor data streams. Includes a writer and a memory-mapped reader.
+ *
+ * A log consists of a file header followed by chunks. Each chunk starts with a chunk header, the sensor names
+ * used by the chunk and the data records. All records are aligned to 8 byte and stored in host byte order. A
+ * byte order mark in the file header lets the reader reject logs of a different byte order.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include "francor_base/laser_scan.h"
+#include "francor_base/ego_motion_sensor_data.h"
+#include "francor_base/pose_sensor_data.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <unordered_map>
+
+namespace francor {
+
+namespace base {
+
+namespace impl {
+
+constexpr std::uint32_t SENSOR_DATA_LOG_MAGIC   = 0x474f4c46; //> "FLOG"
+constexpr std::uint32_t SENSOR_DATA_LOG_CHUNK   = 0x4b4e4843; //> "CHNK"
+constexpr std::uint16_t SENSOR_DATA_LOG_VERSION = 1;
+constexpr std::uint16_t SENSOR_DATA_LOG_BOM     = 0x0102;
+
+struct FileHeader
+{
+  std::uint32_t magic;
+  std::uint16_t version;
+  std::uint16_t byte_order_mark;
+  std::uint64_t reserved;
+};
+
+struct ChunkHeader
+{
+  std::uint32_t magic;
+  std::uint32_t num_records;     //> number of data records, sensor name records are not counted
+  std::uint64_t size;            //> size of the chunk payload in byte
+  double time_stamp_first;
+  double time_stamp_last;
+};
+
+struct RecordHeader
+{
+  std::uint16_t type;
+  std::uint16_t sensor_id;
+  std::uint32_t size;            //> size of the record payload in byte including padding
+  double time_stamp;
+};
+
+struct LaserScanPayload
+{
+  double x;
+  double y;
+  double phi;
+  double phi_min;
+  double phi_max;
+  double phi_step;
+  double range;
+  double divergence;
+  std::uint32_t num_distances;
+  std::uint16_t encoding;
+  std::uint16_t reserved;
+  double resolution;             //> only used by quantized encoding
+};
+
+struct EgoMotionPayload
+{
+  double velocity;
+  double yaw_rate;
+  double covariances[4];         //> row major
+};
+
+struct PosePayload
+{
+  double x;
+  double y;
+  double phi;
+};
+
+struct PoseSensorDataPayload
+{
+  PosePayload pose;
+  double covariances[9];         //> row major
+};
+
+std::uint16_t convertToHalf(const float value);
+float convertFromHalf(const std::uint16_t value);
+
+} // end namespace impl
+
+/**
+ * \brief Type of a record in a sensor data log.
+ */
+enum class SensorDataLogRecordType : std::uint16_t {
+  SENSOR_NAME = 0,
+  LASER_SCAN,
+  EGO_MOTION,
+  POSE_SENSOR_DATA,
+  POSE,
+};
+
+/**
+ * \brief Encoding of the laser scan distances.
+ *
+ *        FLOAT64: lossless.
+ *        FLOAT32: ~7 significant digits.
+ *        FLOAT16: 11 bit precision, about 1.6 cm at 30 m, range up to 65504 m.
+ *        QUANTIZED16: distance as multiple of a fixed resolution. Range is 65534 times the resolution, distances
+ *                     out of range, negative distances and NaN are stored as invalid and read as NaN.
+ */
+enum class DistanceEncoding : std::uint16_t {
+  FLOAT64 = 0,
+  FLOAT32,
+  FLOAT16,
+  QUANTIZED16,
+};
+
+/**
+ * \brief Writes sensor data into a binary log. Records are collected in memory and written chunk wise.
+ */
+class SensorDataLogWriter
+{
+public:
+  struct Parameter
+  {
+    DistanceEncoding distance_encoding = DistanceEncoding::FLOAT32;
+    double quantization_resolution = 0.001; //> distance resolution in meter used by QUANTIZED16
+    std::size_t chunk_size = 1u << 20;      //> a chunk is written when its payload exceeds this size in byte
+  };
+
+  SensorDataLogWriter() = default;
+  SensorDataLogWriter(const SensorDataLogWriter&) = delete;
+  SensorDataLogWriter(SensorDataLogWriter&&) = delete;
+  ~SensorDataLogWriter() { this->close(); }
+
+  SensorDataLogWriter& operator=(const SensorDataLogWriter&) = delete;
+  SensorDataLogWriter& operator=(SensorDataLogWriter&&) = delete;
+
+  /**
+   * \brief Creates a new log file. An existing file will be overwritten.
+   * \param file_name Path to the log file.
+   * \param parameter Encoding parameter.
+   * \return true if the file was created.
+   */
+  bool open(const std::string& file_name, const Parameter& parameter);
+  bool open(const std::string& file_name) { return this->open(file_name, Parameter()); }
+  /**
+   * \brief Writes the pending chunk and closes the file.
+   * \return true if all data was written successfully.
+   */
+  bool close();
+  inline bool isOpen() const { return _file.is_open(); }
+
+  /**
+   * \brief Adds sensor data to the log. Supported types are LaserScan, EgoMotionSensorData and PoseSensorData.
+   * \return true if the data type is supported and the data was added.
+   */
+  bool write(const SensorData& data);
+  /**
+   * \brief Adds a pose, for example from a reference trajectory, to the log.
+   */
+  bool write(const Pose2d& pose, const double time_stamp, char const* const sensor_name = "unkown");
+  /**
+   * \brief Writes the collected records as one chunk to the file.
+   */
+  bool flush();
+
+private:
+  bool writeLaserScan(const LaserScan& scan);
+  bool writeEgoMotion(const EgoMotionSensorData& ego_motion);
+  bool writePoseSensorData(const PoseSensorData& pose_data);
+
+  std::uint8_t* addRecord(const SensorDataLogRecordType type, const double time_stamp,
+                          char const* const sensor_name, const std::size_t payload_size);
+  std::uint16_t registerSensorName(char const* const sensor_name);
+
+  std::ofstream _file;
+  Parameter _parameter;
+  std::unordered_map<std::string, std::uint16_t> _sensor_ids;
+  std::vector<bool> _sensor_in_chunk;     //> marks the sensor names already added to the current chunk
+  std::vector<std::uint8_t> _chunk_names; //> sensor name records of the current chunk
+  std::vector<std::uint8_t> _chunk_data;  //> data records of the current chunk
+  impl::ChunkHeader _chunk_header;
+};
+
+/**
+ * \brief View on a laser scan record inside a mapped log. No data is copied until requested.
+ */
+class LaserScanRecordView
+{
+public:
+  explicit LaserScanRecordView(std::uint8_t const* const payload);
+
+  inline Pose2d pose() const { return { { _payload.x, _payload.y }, _payload.phi }; }
+  inline Angle phiMin() const { return _payload.phi_min; }
+  inline Angle phiMax() const { return _payload.phi_max; }
+  inline Angle phiStep() const { return _payload.phi_step; }
+  inline double range() const { return _payload.range; }
+  inline Angle divergence() const { return _payload.divergence; }
+  inline std::size_t numOfDistances() const { return _payload.num_distances; }
+  inline DistanceEncoding encoding() const { return static_cast<DistanceEncoding>(_payload.encoding); }
+
+  /**
+   * \brief Decodes a single distance.
+   */
+  double distance(const std::size_t index) const;
+  /**
+   * \brief Decodes all distances into the given vector. The capacity of the vector is reused, so no allocation
+   *        happens if it is already large enough.
+   */
+  void copyDistances(std::vector<double>& distances) const;
+  void copyDistances(LaserScan::Distances& distances) const;
+  /**
+   * \brief Creates a laser scan of this record.
+   */
+  std::shared_ptr<LaserScan> createLaserScan(char const* const sensor_name, const double time_stamp) const;
+
+private:
+  template <typename Real>
+  void decodeDistances(Real* const distances) const;
+
+  impl::LaserScanPayload _payload;
+  std::uint8_t const* _distances;
+};
+
+/**
+ * \brief View on a single record inside a mapped log. Valid as long as the reader is open.
+ */
+class SensorDataLogRecord
+{
+public:
+  SensorDataLogRecord(std::uint8_t const* const record, char const* const sensor_name)
+    : _record(record), _sensor_name(sensor_name)
+  {
+    std::memcpy(&_header, record, sizeof(_header));
+  }
+
+  inline SensorDataLogRecordType type() const { return static_cast<SensorDataLogRecordType>(_header.type); }
+  inline double timeStamp() const { return _header.time_stamp; }
+  inline char const* sensorName() const { return _sensor_name; }
+
+  /**
+   * \brief Access the payload of the record. The payload size is only validated for the type of the record, so the
+   *        accessor must match type().
+   */
+  LaserScanRecordView laserScan() const;
+  EgoMotionSensorData egoMotion() const;
+  PoseSensorData poseSensorData() const;
+  Pose2d pose() const;
+  /**
+   * \brief Creates a sensor data object of this record. Pose records are returned as PoseSensorData with zero
+   *        covariances.
+   */
+  std::shared_ptr<SensorData> createSensorData() const;
+
+private:
+  inline std::uint8_t const* payload() const { return _record + sizeof(impl::RecordHeader); }
+
+  std::uint8_t const* _record;
+  char const* _sensor_name;
+  impl::RecordHeader _header;
+};
+
+/**
+ * \brief Reads a binary sensor data log. The file is mapped into memory and the records are accessed in place.
+ *        On open the record headers of all chunks are validated. An incomplete last chunk (e.g. after a crash
+ *        during recording) is ignored, a corrupted record ends its chunk.
+ */
+class SensorDataLogReader
+{
+public:
+  struct Chunk
+  {
+    std::size_t offset;        //> offset of the chunk payload in the file
+    impl::ChunkHeader header;
+  };
+
+  class Iterator
+  {
+  public:
+    Iterator(const SensorDataLogReader* reader, const std::size_t chunk, std::uint8_t const* record)
+      : _reader(reader), _chunk(chunk), _record(record)
+    {
+      this->skipSensorNames();
+    }
+
+    inline SensorDataLogRecord operator*() const
+    {
+      impl::RecordHeader header;
+      std::memcpy(&header, _record, sizeof(header));
+      return { _record, _reader->sensorName(header.sensor_id) };
+    }
+    inline Iterator& operator++()
+    {
+      this->advance();
+      this->skipSensorNames();
+      return *this;
+    }
+    inline bool operator==(const Iterator& other) const { return _record == other._record; }
+    inline bool operator!=(const Iterator& other) const { return _record != other._record; }
+
+  private:
+    void advance();
+    void skipSensorNames();
+
+    const SensorDataLogReader* _reader;
+    std::size_t _chunk;
+    std::uint8_t const* _record;
+  };
+
+  SensorDataLogReader() = default;
+  SensorDataLogReader(const SensorDataLogReader&) = delete;
+  SensorDataLogReader(SensorDataLogReader&&) = delete;
+  ~SensorDataLogReader() { this->close(); }
+
+  SensorDataLogReader& operator=(const SensorDataLogReader&) = delete;
+  SensorDataLogReader& operator=(SensorDataLogReader&&) = delete;
+
+  /**
+   * \brief Maps a log file into memory and indexes its chunks.
+   * \return true if the file is a valid sensor data log.
+   */
+  bool open(const std::string& file_name);
+  void close();
+  inline bool isOpen() const { return _data != nullptr; }
+
+  inline std::size_t numOfChunks() const { return _chunks.size(); }
+  inline std::size_t numOfRecords() const { return _num_records; }
+  inline const std::vector<Chunk>& chunks() const { return _chunks; }
+
+  Iterator begin() const { return { this, 0, this->chunkBegin(0) }; }
+  Iterator end() const { return { this, _chunks.size(), this->chunkBegin(_chunks.size()) }; }
+  /**
+   * \brief Returns an iterator to the first record with a time stamp not less than the given one. Records are
+   *        expected in time order.
+   */
+  Iterator lowerBound(const double time_stamp) const;
+
+  /**
+   * \brief Checks if a file is a sensor data log by its file header.
+   */
+  static bool isSensorDataLog(const std::string& file_name);
+
+private:
+  friend class Iterator;
+
+  std::uint8_t const* chunkBegin(const std::size_t chunk) const;
+  std::uint8_t const* chunkEnd(const std::size_t chunk) const;
+  char const* sensorName(const std::uint16_t id) const;
+  /**
+   * \brief Registers the sensor names of the chunk and validates all its records. The chunk is cut before the first
+   *        corrupted record and its number of records is set to the number of valid data records.
+   * \return false if the chunk contains a corrupted record.
+   */
+  bool indexChunk(Chunk& chunk);
+
+  std::uint8_t const* _data = nullptr;
+  std::size_t _size = 0;
+  std::vector<Chunk> _chunks;
+  std::vector<std::unique_ptr<std::string>> _sensor_names; //> index is the sensor id
+  std::size_t _num_records = 0;
+};
+
+} // end namespace base
+
+} // end namespace francor
@@ -0,0 +1,60 @@
+/**
+ * Non owning view on a contiguous sequence of elements.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace francor {
+
+namespace base {
+
+/**
+ * \brief Subset of C++20 std::span. The viewed memory must outlive the span.
+ */
+template <typename Type>
+class Span
+{
+public:
+  using element_type = Type;
+  using value_type = typename std::remove_cv<Type>::type;
+  using iterator = Type*;
+
+  constexpr Span() noexcept = default;
+  constexpr Span(Type* data, const std::size_t size) noexcept : _data(data), _size(size) { }
+  template <typename Allocator>
+  constexpr Span(const std::vector<value_type, Allocator>& vector) noexcept
+    : _data(vector.data()), _size(vector.size()) { }
+  template <typename Allocator>
+  constexpr Span(std::vector<value_type, Allocator>& vector) noexcept
+    : _data(vector.data()), _size(vector.size()) { }
+
+  inline constexpr Type* data() const noexcept { return _data; }
+  inline constexpr std::size_t size() const noexcept { return _size; }
+  inline constexpr bool empty() const noexcept { return _size == 0; }
+
+  inline constexpr Type& operator[](const std::size_t index) const noexcept { return _data[index]; }
+  inline constexpr Type& front() const noexcept { return _data[0]; }
+  inline constexpr Type& back() const noexcept { return _data[_size - 1]; }
+
+  inline constexpr iterator begin() const noexcept { return _data; }
+  inline constexpr iterator end() const noexcept { return _data + _size; }
+
+  inline constexpr Span subspan(const std::size_t offset, const std::size_t count) const noexcept
+  {
+    return { _data + offset, count };
+  }
+
+private:
+  Type* _data = nullptr;
+  std::size_t _size = 0;
+};
+
+} // end namespace base
+
+} // end namespace francor
@@ -0,0 +1,174 @@
+/**
+ * Lightweight trace event recording. Scopes are recorded per thread and can be written as Chrome trace JSON, which
+ * can be opened with chrome://tracing or https://ui.perfetto.dev.
+ *
+ * The instrumentation macros FRANCOR_TRACE_SCOPE and FRANCOR_TRACE_ARGUMENT are only compiled if
+ * FRANCOR_ENABLE_TRACING is defined (CMake option BUILD_WITH_TRACING), otherwise they and their arguments are
+ * removed completely. If compiled, recording still has to be started with startTracing().
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#define FRANCOR_TRACE_CONCAT_IMPL(a, b) a##b
+#define FRANCOR_TRACE_CONCAT(a, b) FRANCOR_TRACE_CONCAT_IMPL(a, b)
+
+#if defined(FRANCOR_ENABLE_TRACING)
+/**
+ * \brief Records the enclosing scope as trace event. The name must be a string literal or a std::string, optional
+ *        arguments are pairs of argument name (string literal) and numeric value.
+ *
+ *        Usage: FRANCOR_TRACE_SCOPE("Icp::estimateTransform", "points", points.size());
+ */
+#define FRANCOR_TRACE_SCOPE(...) \
+  ::francor::base::ScopedTrace FRANCOR_TRACE_CONCAT(_francor_trace_scope_, __LINE__)(__VA_ARGS__)
+/**
+ * \brief Adds or updates a numeric argument of the innermost trace scope of the current thread.
+ */
+#define FRANCOR_TRACE_ARGUMENT(name, value) ::francor::base::ScopedTrace::addArgumentToCurrent(name, value)
+#else
+#define FRANCOR_TRACE_SCOPE(...) static_cast<void>(0)
+#define FRANCOR_TRACE_ARGUMENT(name, value) static_cast<void>(0)
+#endif
+
+namespace francor {
+
+namespace base {
+
+/**
+ * \brief Starts recording of trace scopes. Already recorded events are kept.
+ *
+ * \param reserved_events Number of events reserved per thread buffer on its first use.
+ */
+void startTracing(const std::size_t reserved_events = 1u << 14);
+/**
+ * \brief Stops recording. Returns after all threads finished writing their current event.
+ */
+void stopTracing();
+/**
+ * \brief Removes all recorded events. Thread names are kept.
+ */
+void clearTrace();
+/**
+ * \brief Sets the name of the calling thread shown in the trace.
+ */
+void setTraceThreadName(const std::string& name);
+/**
+ * \brief Number of recorded events of all threads.
+ */
+std::size_t numOfTraceEvents();
+/**
+ * \brief Writes all recorded events as Chrome trace JSON. Recording is paused while writing.
+ * \return true if the trace was written successfully.
+ */
+bool writeChromeTrace(std::ostream& os);
+bool writeChromeTrace(const std::string& file_name);
+/**
+ * \brief Returns a pointer to a copy of the name that stays valid until the program ends. Used for trace names
+ *        that are not string literals.
+ */
+char const* internTraceName(const std::string& name);
+
+namespace impl {
+
+extern std::atomic<bool> tracing_enabled;
+
+constexpr std::size_t MAX_TRACE_ARGUMENTS = 4;
+
+struct TraceArgument
+{
+  char const* name;
+  double value;
+};
+
+/**
+ * \brief A complete scope with begin and end time stamp in nanoseconds of the steady clock.
+ */
+struct TraceEvent
+{
+  char const* name;
+  std::int64_t begin;
+  std::int64_t end;
+  std::size_t num_arguments;
+  TraceArgument arguments[MAX_TRACE_ARGUMENTS];
+};
+
+std::int64_t traceTimeStamp();
+void recordTraceEvent(const TraceEvent& event);
+
+} // end namespace impl
+
+inline bool isTracingEnabled() { return impl::tracing_enabled.load(std::memory_order_relaxed); }
+
+/**
+ * \brief Records the time between construction and destruction as one trace event if tracing is enabled on
+ *        construction. Normally used by the macro FRANCOR_TRACE_SCOPE.
+ */
+class ScopedTrace
+{
+public:
+  explicit ScopedTrace(char const* const name)
+  {
+    if (isTracingEnabled())
+      this->begin(name);
+  }
+  explicit ScopedTrace(const std::string& name)
+  {
+    if (isTracingEnabled())
+      this->begin(internTraceName(name));
+  }
+  template <typename Name, typename Value, typename... Arguments>
+  ScopedTrace(const Name& name, char const* const argument_name, const Value value, const Arguments&... arguments)
+    : ScopedTrace(name)
+  {
+    if (_active)
+      this->addArguments(argument_name, value, arguments...);
+  }
+  ScopedTrace(const ScopedTrace&) = delete;
+  ScopedTrace(ScopedTrace&&) = delete;
+  ~ScopedTrace()
+  {
+    if (_active)
+      this->end();
+  }
+
+  ScopedTrace& operator=(const ScopedTrace&) = delete;
+  ScopedTrace& operator=(ScopedTrace&&) = delete;
+
+  /**
+   * \brief Adds a numeric argument to the event. An argument with the same name is overwritten. If the maximum
+   *        number of arguments is reached, further arguments are dropped.
+   */
+  void addArgument(char const* const name, const double value);
+  /**
+   * \brief Adds the argument to the innermost active scope of the calling thread, if there is one.
+   */
+  static void addArgumentToCurrent(char const* const name, const double value);
+
+private:
+  void begin(char const* const name);
+  void end();
+
+  template <typename Value, typename... Arguments>
+  inline void addArguments(char const* const name, const Value value, const Arguments&... arguments)
+  {
+    this->addArgument(name, static_cast<double>(value));
+
+    if constexpr (sizeof...(Arguments) > 0)
+      this->addArguments(arguments...);
+  }
+
+  impl::TraceEvent _event;
+  ScopedTrace* _parent = nullptr; //> enclosing active scope of the same thread
+  bool _active = false;
+};
+
+} // end namespace base
+
+} // end namespace francor
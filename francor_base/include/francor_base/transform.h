@@ -18,99 +18,117 @@ namespace francor {
 
 namespace base {
 
-class Rotation2d
+namespace impl {
+
+template <typename Type>
+class Rotation2
 {
 public:
-  Rotation2d(const Angle& angle = 0.0)
+  using Matrix = Eigen::Matrix<Type, 2, 2>;
+
+  Rotation2(const Angle& angle = 0.0)
     : _phi(angle)
   {
     this->calculateMat(_phi, _mat);
   }
-  inline Point2d operator*(const Point2d& point) const
+  inline Point2<Type> operator*(const Point2<Type>& point) const
   {
     return { _mat(0, 0) * point.x() + _mat(0, 1) * point.y(),
              _mat(1, 0) * point.x() + _mat(1, 1) * point.y() };
   }
-  inline Vector2d operator*(const Vector2d& vector) const
+  inline Vector2<Type> operator*(const Vector2<Type>& vector) const
   {
     return _mat * vector;
   }
-  inline Rotation2d operator*(const Rotation2d& operant) const { return { _phi + operant._phi }; }
+  inline Rotation2 operator*(const Rotation2& operant) const { return { _phi + operant._phi }; }
   inline Angle operator*(const Angle& angle) const { return { _phi + angle }; }
-  inline Rotation2d& operator=(const Angle& angle) { _phi = angle; this->calculateMat(_phi, _mat); return *this; }
-  inline Rotation2d inverse() const { return { _phi * -1.0 }; }
-  inline const Matrix2d& mat() const noexcept { return _mat; }
+  inline Rotation2& operator=(const Angle& angle) { _phi = angle; this->calculateMat(_phi, _mat); return *this; }
+  inline Rotation2 inverse() const { return { _phi * -1.0 }; }
+  inline const Matrix& mat() const noexcept { return _mat; }
   inline Angle phi() const { return _phi; }
 
 private:
-  void calculateMat(const Angle& phi, Matrix2d& mat) const
+  void calculateMat(const Angle& phi, Matrix& mat) const
   {
-    mat << std::cos(_phi), -std::sin(_phi),
-           std::sin(_phi),  std::cos(_phi);
+    // angle stays double, only the matrix is stored in the target precision
+    const Type c = static_cast<Type>(std::cos(_phi));
+    const Type s = static_cast<Type>(std::sin(_phi));
+
+    mat << c, -s,
+           s,  c;
   }
 
   Angle _phi = 0.0;
-  Matrix2d _mat;
+  Matrix _mat;
 };
 
-class Transform2d
+template <typename Type>
+class Transform2
 {
 public:
-  Transform2d() = default;
-  Transform2d(const Rotation2d& rotation, const Vector2d& translation)
+  Transform2() = default;
+  Transform2(const Rotation2<Type>& rotation, const Vector2<Type>& translation)
     : _rotation(rotation),
       _translation(translation)
   { }
 
   inline void setRotation(const Angle angle) { _rotation = angle; }
-  inline void setRotation(const Rotation2d& rot) { _rotation = rot; }
-  inline void setTranslation(const Vector2d& trans) { _translation = trans; }
-  inline const Rotation2d& rotation() const noexcept { return _rotation; }
-  inline const Vector2d& translation() const noexcept { return _translation; }
+  inline void setRotation(const Rotation2<Type>& rot) { _rotation = rot; }
+  inline void setTranslation(const Vector2<Type>& trans) { _translation = trans; }
+  inline const Rotation2<Type>& rotation() const noexcept { return _rotation; }
+  inline const Vector2<Type>& translation() const noexcept { return _translation; }
 
-  inline Transform2d inverse() const
+  inline Transform2 inverse() const
   {
-    const Rotation2d inv = _rotation.inverse();
-    return { inv, (inv * _translation) * -1.0 };
+    const Rotation2<Type> inv = _rotation.inverse();
+    return { inv, (inv * _translation) * Type(-1.0) };
   }
-  inline Transform2d operator*(const Transform2d& operant) const
+  inline Transform2 operator*(const Transform2& operant) const
   {
     // \todo check if equation is correct
     return { _rotation * operant._rotation, _translation + _rotation * operant._translation };
   }
-  inline Point2d operator*(const Point2d& point) const 
+  inline Point2<Type> operator*(const Point2<Type>& point) const 
   {
     // first rotate then move (affine transformation)
     return _rotation * point + _translation;
   }
-  inline Pose2d operator*(const Pose2d& pose) const
+  inline Pose2<Type> operator*(const Pose2<Type>& pose) const
   {
     // \todo check if equation is correct
     return { pose.position() + _translation, _rotation * pose.orientation() };
   }
-  operator Matrix3d() const
+  operator Eigen::Matrix<Type, 3, 3>() const
   {
-    Matrix3d mat;
+    Eigen::Matrix<Type, 3, 3> mat;
 
     mat << _rotation.mat()(0, 0), _rotation.mat()(0, 1), _translation.x(), 
            _rotation.mat()(1, 0), _rotation.mat()(1, 1), _translation.y(),
-                             0.0,                   0.0,              1.0;
+                           Type(0),               Type(0),          Type(1);
 
     return mat;                              
   } 
 
 private:
-  Rotation2d _rotation;
-  Vector2d _translation;
+  Rotation2<Type> _rotation;
+  Vector2<Type> _translation;
 };
 
+} // end namespace impl
+
+using Rotation2d = impl::Rotation2<double>;
+using Rotation2f = impl::Rotation2<float>;
+using Transform2d = impl::Transform2<double>;
+using Transform2f = impl::Transform2<float>;
+
 } // end namespace base
 
 } // end namespace francor
 
 namespace std {
 
-inline ostream& operator<<(ostream& os, const francor::base::Transform2d& transform)
+template <typename Type>
+inline ostream& operator<<(ostream& os, const francor::base::impl::Transform2<Type>& transform)
 {
   os << "[ rot: " << transform.rotation().phi() << ", t: [ " << transform.translation().x() << ", "
      << transform.translation().y() << " ] ]";
@@ -19,6 +19,7 @@ namespace base
 using Vector2i = Eigen::Vector2i;
 using Vector2u = Eigen::Matrix<unsigned int, 2, 1>;
 using Vector2d = Eigen::Vector2d;
+using Vector2f = Eigen::Vector2f;
 using Vector3d = Eigen::Vector3d;
 template <typename Type>
 using Vector2 = Eigen::Matrix<Type, 2, 1>;
@@ -27,6 +28,7 @@ using VectorX = Eigen::Matrix<Type, Size, 1>;
 
 using VectorVector2i = std::vector<Vector2i, Eigen::aligned_allocator<Vector2i>>;
 using VectorVector2d = std::vector<Vector2d, Eigen::aligned_allocator<Vector2d>>;
+using VectorVector2f = std::vector<Vector2f, Eigen::aligned_allocator<Vector2f>>;
 using VectorVector3d = std::vector<Vector3d, Eigen::aligned_allocator<Vector3d>>;
 
 } // end namespace base
@@ -9,7 +9,9 @@
 #include "francor_base/transform.h"
 #include "francor_base/log.h"
 
-#include <iostream>
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
 
 namespace francor {
 
@@ -19,34 +21,196 @@ namespace algorithm {
 
 namespace point {
 
-bool convertLaserScanToPoints(const LaserScan& scan, const Pose2d& ego_pose, Point2dVector& points)
+namespace {
+
+// writes points into an interleaved x, y array (Point2dVector, Point2fVector)
+template <typename Type>
+class InterleavedOutput
 {
-  points.resize(0);
-  points.reserve(scan.distances().size());
-  const Transform2d transform( { ego_pose.orientation() }, { ego_pose.position().x(), ego_pose.position().y() } );
-  const Pose2d start(transform * scan.pose());
-  Angle current_phi = scan.phiMin() + start.orientation();
-  
-  std::cout << "start " << start << std::endl;
-  std::cout << "laser scan = " << scan << std::endl;
+public:
+  InterleavedOutput(Point2Vector<Type>& points) : _data(reinterpret_cast<Type*>(points.data())) { }
+
+  inline void store(const std::size_t index, const double x, const double y)
+  {
+    _data[index * 2]     = static_cast<Type>(x);
+    _data[index * 2 + 1] = static_cast<Type>(y);
+  }
+#if defined(__AVX2__) && defined(__FMA__)
+  inline void store(const std::size_t index, const __m256d x, const __m256d y)
+  {
+    this->storeInterleaved(_data + index * 2, x, y);
+  }
+#endif
 
-  for (const auto distance : scan.distances())
+private:
+#if defined(__AVX2__) && defined(__FMA__)
+  static inline void storeInterleaved(double* const data, const __m256d x, const __m256d y)
   {
-    if (!(std::isnan(distance) || std::isinf(distance))) {
-      const Point2d point(distance * std::cos(current_phi), distance * std::sin(current_phi));
-      points.push_back(point + start.position());
+    const __m256d low  = _mm256_unpacklo_pd(x, y); // x0 y0 x2 y2
+    const __m256d high = _mm256_unpackhi_pd(x, y); // x1 y1 x3 y3
+
+    _mm256_storeu_pd(data,     _mm256_permute2f128_pd(low, high, 0x20));
+    _mm256_storeu_pd(data + 4, _mm256_permute2f128_pd(low, high, 0x31));
+  }
+  static inline void storeInterleaved(float* const data, const __m256d x, const __m256d y)
+  {
+    const __m128 xs = _mm256_cvtpd_ps(x);
+    const __m128 ys = _mm256_cvtpd_ps(y);
+
+    _mm_storeu_ps(data,     _mm_unpacklo_ps(xs, ys)); // x0 y0 x1 y1
+    _mm_storeu_ps(data + 4, _mm_unpackhi_ps(xs, ys)); // x2 y2 x3 y3
+  }
+#endif
+
+  Type* _data;
+};
+
+// writes points into separate x and y arrays (Point2dSoA, Point2fSoA)
+template <typename Type>
+class SeparatedOutput
+{
+public:
+  SeparatedOutput(impl::Point2SoA<Type>& points) : _x(points.x().data()), _y(points.y().data()) { }
+
+  inline void store(const std::size_t index, const double x, const double y)
+  {
+    _x[index] = static_cast<Type>(x);
+    _y[index] = static_cast<Type>(y);
+  }
+#if defined(__AVX2__) && defined(__FMA__)
+  inline void store(const std::size_t index, const __m256d x, const __m256d y)
+  {
+    this->storeLanes(_x + index, x);
+    this->storeLanes(_y + index, y);
+  }
+#endif
+
+private:
+#if defined(__AVX2__) && defined(__FMA__)
+  static inline void storeLanes(double* const data, const __m256d value) { _mm256_storeu_pd(data, value); }
+  static inline void storeLanes(float* const data, const __m256d value) { _mm_storeu_ps(data, _mm256_cvtpd_ps(value)); }
+#endif
+
+  Type* _x;
+  Type* _y;
+};
+
+/**
+ * \brief Converts all valid beams using the cached beam trigonometry. Each beam in sensor frame is rotated by the
+ *        sensor orientation and moved to the sensor position. Output must provide space for all beams.
+ * \return Number of written points.
+ */
+template <typename Output>
+std::size_t convertBeams(const LaserScan& scan, const Pose2d& sensor_pose, Output output)
+{
+  const auto distances = scan.distances();
+  const auto& trigonometry = scan.trigonometry();
+  const double* const cos = trigonometry.cos().data();
+  const double* const sin = trigonometry.sin().data();
+  const double c = std::cos(sensor_pose.orientation());
+  const double s = std::sin(sensor_pose.orientation());
+  const double px = sensor_pose.position().x();
+  const double py = sensor_pose.position().y();
+  const std::size_t num_beams = distances.size();
+
+  std::size_t count = 0;
+  std::size_t i = 0;
+
+#if defined(__AVX2__) && defined(__FMA__)
+  const __m256d vc  = _mm256_set1_pd(c);
+  const __m256d vs  = _mm256_set1_pd(s);
+  const __m256d vpx = _mm256_set1_pd(px);
+  const __m256d vpy = _mm256_set1_pd(py);
+  const __m256d zero = _mm256_setzero_pd();
+  alignas(32) double xs[4];
+  alignas(32) double ys[4];
+
+  for (; i + 4 <= num_beams; i += 4) {
+    const __m256d d  = _mm256_cvtps_pd(_mm_loadu_ps(distances.data() + i));
+    const __m256d lx = _mm256_mul_pd(d, _mm256_loadu_pd(cos + i));
+    const __m256d ly = _mm256_mul_pd(d, _mm256_loadu_pd(sin + i));
+    const __m256d x  = _mm256_fnmadd_pd(vs, ly, _mm256_fmadd_pd(vc, lx, vpx));
+    const __m256d y  = _mm256_fmadd_pd(vc, ly, _mm256_fmadd_pd(vs, lx, vpy));
+    // d - d is zero for finite values and nan for nan and inf
+    const int valid = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_sub_pd(d, d), zero, _CMP_EQ_OQ));
+
+    if (valid == 0xf) {
+      output.store(count, x, y);
+      count += 4;
     }
+    else if (valid != 0) {
+      _mm256_store_pd(xs, x);
+      _mm256_store_pd(ys, y);
 
-    current_phi += scan.phiStep();
+      for (int lane = 0; lane < 4; ++lane) {
+        if (valid & (1 << lane)) {
+          output.store(count++, xs[lane], ys[lane]);
+        }
+      }
+    }
+  }
+#endif
+
+  for (; i < num_beams; ++i) {
+    const double distance = distances[i];
+
+    if (std::isfinite(distance)) {
+      const double lx = distance * cos[i];
+      const double ly = distance * sin[i];
+
+      output.store(count++, px + c * lx - s * ly, py + s * lx + c * ly);
+    }
+  }
+
+  return count;
+}
+
+inline Pose2d estimateSensorPose(const LaserScan& scan, const Pose2d& ego_pose)
+{
+  const Transform2d transform( { ego_pose.orientation() }, { ego_pose.position().x(), ego_pose.position().y() } );
+  return transform * scan.pose();
+}
+
+template <typename Points, typename Output>
+bool convertLaserScan(const LaserScan& scan, const Pose2d& ego_pose, Points& points)
+{
+  points.resize(scan.distances().size());
+
+  if (points.empty()) {
+    return true;
   }
 
+  points.resize(convertBeams(scan, estimateSensorPose(scan, ego_pose), Output(points)));
+
   return true;
 }
 
+} // end namespace
+
+bool convertLaserScanToPoints(const LaserScan& scan, const Pose2d& ego_pose, Point2dVector& points)
+{
+  return convertLaserScan<Point2dVector, InterleavedOutput<double>>(scan, ego_pose, points);
+}
+
+bool convertLaserScanToPoints(const LaserScan& scan, const Pose2d& ego_pose, Point2dSoA& points)
+{
+  return convertLaserScan<Point2dSoA, SeparatedOutput<double>>(scan, ego_pose, points);
+}
+
+bool convertLaserScanToPoints(const LaserScan& scan, const Pose2d& ego_pose, Point2fVector& points)
+{
+  return convertLaserScan<Point2fVector, InterleavedOutput<float>>(scan, ego_pose, points);
+}
+
+bool convertLaserScanToPoints(const LaserScan& scan, const Pose2d& ego_pose, Point2fSoA& points)
+{
+  return convertLaserScan<Point2fSoA, SeparatedOutput<float>>(scan, ego_pose, points);
+}
+
 } // end namespace point
 
 } // end namespace algorithm
 
 } // end namespace base
 
-} // end namespace francor
\ No newline at end of file
+} // end namespace francor
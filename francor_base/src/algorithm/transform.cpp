@@ -7,6 +7,12 @@
 #include "francor_base/algorithm/transform.h"
 #include "francor_base/transform.h"
 
+#include <cassert>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 namespace francor {
 
 namespace base {
@@ -15,10 +21,280 @@ namespace algorithm {
 
 namespace transform {
 
+namespace {
+
+// rotation and translation as plain values, taken once per batch
+template <typename Type>
+struct TransformCoefficients
+{
+  TransformCoefficients(const impl::Transform2<Type>& transform)
+    : c(transform.rotation().mat()(0, 0)),
+      s(transform.rotation().mat()(1, 0)),
+      tx(transform.translation().x()),
+      ty(transform.translation().y())
+  { }
+
+  inline void apply(const Type x, const Type y, Type& out_x, Type& out_y) const
+  {
+    out_x = c * x - s * y + tx;
+    out_y = s * x + c * y + ty;
+  }
+
+  Type c;
+  Type s;
+  Type tx;
+  Type ty;
+};
+
+#if defined(__AVX2__) && defined(__FMA__)
+// thin wrapper around the AVX2 intrinsics so the kernels below can be written once for double and float
+template <typename Type>
+struct Simd;
+
+template <>
+struct Simd<double>
+{
+  using Register = __m256d;
+  static constexpr std::size_t LANES = 4;
+
+  static inline Register load(const double* data) { return _mm256_loadu_pd(data); }
+  static inline void store(double* data, const Register value) { _mm256_storeu_pd(data, value); }
+  static inline Register set(const double value) { return _mm256_set1_pd(value); }
+  static inline Register setPairs(const double a, const double b) { return _mm256_setr_pd(a, b, a, b); }
+  static inline Register zero() { return _mm256_setzero_pd(); }
+  static inline Register sub(const Register a, const Register b) { return _mm256_sub_pd(a, b); }
+  static inline Register fmadd(const Register a, const Register b, const Register c) { return _mm256_fmadd_pd(a, b, c); }
+  static inline Register fnmadd(const Register a, const Register b, const Register c) { return _mm256_fnmadd_pd(a, b, c); }
+  // [x0 y0 x1 y1] -> [y0 x0 y1 x1]
+  static inline Register swapPairs(const Register value) { return _mm256_permute_pd(value, 0x5); }
+  static inline double sum(const Register value)
+  {
+    const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+  }
+};
+
+template <>
+struct Simd<float>
+{
+  using Register = __m256;
+  static constexpr std::size_t LANES = 8;
+
+  static inline Register load(const float* data) { return _mm256_loadu_ps(data); }
+  static inline void store(float* data, const Register value) { _mm256_storeu_ps(data, value); }
+  static inline Register set(const float value) { return _mm256_set1_ps(value); }
+  static inline Register setPairs(const float a, const float b) { return _mm256_setr_ps(a, b, a, b, a, b, a, b); }
+  static inline Register zero() { return _mm256_setzero_ps(); }
+  static inline Register sub(const Register a, const Register b) { return _mm256_sub_ps(a, b); }
+  static inline Register fmadd(const Register a, const Register b, const Register c) { return _mm256_fmadd_ps(a, b, c); }
+  static inline Register fnmadd(const Register a, const Register b, const Register c) { return _mm256_fnmadd_ps(a, b, c); }
+  // [x0 y0 x1 y1 ...] -> [y0 x0 y1 x1 ...]
+  static inline Register swapPairs(const Register value) { return _mm256_permute_ps(value, 0xb1); }
+  static inline double sum(const Register value)
+  {
+    // accumulate the lanes in double, the residual sum is returned as double anyway
+    const __m256d sum = _mm256_add_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(value)),
+                                      _mm256_cvtps_pd(_mm256_extractf128_ps(value, 1)));
+    return Simd<double>::sum(sum);
+  }
+};
+
+// applies the transform to interleaved points [x0 y0 x1 y1 ...]
+template <typename Type>
+class InterleavedKernel
+{
+public:
+  using Register = typename Simd<Type>::Register;
+
+  InterleavedKernel(const TransformCoefficients<Type>& coefficients)
+    : _cos(Simd<Type>::set(coefficients.c)),
+      _sin(Simd<Type>::setPairs(-coefficients.s, coefficients.s)),
+      _translation(Simd<Type>::setPairs(coefficients.tx, coefficients.ty))
+  { }
+
+  inline Register operator()(const Register points) const
+  {
+    return Simd<Type>::fmadd(points, _cos, Simd<Type>::fmadd(Simd<Type>::swapPairs(points), _sin, _translation));
+  }
+
+private:
+  Register _cos;
+  Register _sin;
+  Register _translation;
+};
+#endif
+
+template <typename Type>
+void transformInterleaved(const impl::Transform2<Type>& transform, const impl::Point2<Type>* input,
+                          impl::Point2<Type>* output, const std::size_t count)
+{
+  if (count == 0) {
+    return;
+  }
+
+  const TransformCoefficients<Type> coefficients(transform);
+  std::size_t i = 0;
+
+#if defined(__AVX2__) && defined(__FMA__)
+  using Ops = Simd<Type>;
+  constexpr std::size_t POINTS = Ops::LANES / 2;
+  const InterleavedKernel<Type> kernel(coefficients);
+  const Type* const in = reinterpret_cast<const Type*>(input);
+  Type* const out = reinterpret_cast<Type*>(output);
+
+  // two registers per step
+  for (; i + POINTS * 2 <= count; i += POINTS * 2) {
+    const auto first  = Ops::load(in + i * 2);
+    const auto second = Ops::load(in + i * 2 + Ops::LANES);
+
+    Ops::store(out + i * 2,              kernel(first));
+    Ops::store(out + i * 2 + Ops::LANES, kernel(second));
+  }
+#endif
+
+  for (; i < count; ++i) {
+    const Type x = input[i].x();
+    const Type y = input[i].y();
+
+    coefficients.apply(x, y, output[i].x(), output[i].y());
+  }
+}
+
+template <typename Type>
+void transformSeparated(const impl::Transform2<Type>& transform, impl::Point2SoA<Type>& points)
+{
+  const TransformCoefficients<Type> coefficients(transform);
+  Type* const xs = points.x().data();
+  Type* const ys = points.y().data();
+  const std::size_t count = points.size();
+  std::size_t i = 0;
+
+#if defined(__AVX2__) && defined(__FMA__)
+  using Ops = Simd<Type>;
+  const auto c  = Ops::set(coefficients.c);
+  const auto s  = Ops::set(coefficients.s);
+  const auto tx = Ops::set(coefficients.tx);
+  const auto ty = Ops::set(coefficients.ty);
+
+  for (; i + Ops::LANES <= count; i += Ops::LANES) {
+    const auto x = Ops::load(xs + i);
+    const auto y = Ops::load(ys + i);
+
+    Ops::store(xs + i, Ops::fnmadd(s, y, Ops::fmadd(c, x, tx)));
+    Ops::store(ys + i, Ops::fmadd(c, y, Ops::fmadd(s, x, ty)));
+  }
+#endif
+
+  for (; i < count; ++i) {
+    const Type x = xs[i];
+    const Type y = ys[i];
+
+    coefficients.apply(x, y, xs[i], ys[i]);
+  }
+}
+
+template <typename Type>
+double transformAndSumResiduals(const impl::Transform2<Type>& transform, Point2Vector<Type>& points,
+                                const Point2Vector<Type>& references)
+{
+  assert(points.size() == references.size());
+
+  if (points.empty()) {
+    return 0.0;
+  }
+
+  const TransformCoefficients<Type> coefficients(transform);
+  const std::size_t count = points.size();
+  double sum = 0.0;
+  std::size_t i = 0;
+
+#if defined(__AVX2__) && defined(__FMA__)
+  using Ops = Simd<Type>;
+  constexpr std::size_t POINTS = Ops::LANES / 2;
+  const InterleavedKernel<Type> kernel(coefficients);
+  Type* const data = reinterpret_cast<Type*>(points.data());
+  const Type* const reference = reinterpret_cast<const Type*>(references.data());
+  auto squared_sum = Ops::zero();
+
+  for (; i + POINTS <= count; i += POINTS) {
+    const auto moved = kernel(Ops::load(data + i * 2));
+    const auto difference = Ops::sub(moved, Ops::load(reference + i * 2));
+
+    Ops::store(data + i * 2, moved);
+    squared_sum = Ops::fmadd(difference, difference, squared_sum);
+  }
+
+  sum = Ops::sum(squared_sum);
+#endif
+
+  for (; i < count; ++i) {
+    const Type x = points[i].x();
+    const Type y = points[i].y();
+
+    coefficients.apply(x, y, points[i].x(), points[i].y());
+
+    const double dx = points[i].x() - references[i].x();
+    const double dy = points[i].y() - references[i].y();
+    sum += dx * dx + dy * dy;
+  }
+
+  return sum;
+}
+
+} // end namespace
+
+void transformPoints(const Transform2d& transform, const Point2d* input, Point2d* output, const std::size_t count)
+{
+  transformInterleaved(transform, input, output, count);
+}
+
+void transformPoints(const Transform2f& transform, const Point2f* input, Point2f* output, const std::size_t count)
+{
+  transformInterleaved(transform, input, output, count);
+}
+
 void transformPointVector(const Transform2d& transform, Point2dVector& points)
 {
-  for (auto& point : points)
-    point = transform * point;
+  transformInterleaved(transform, points.data(), points.data(), points.size());
+}
+
+void transformPointVector(const Transform2f& transform, Point2fVector& points)
+{
+  transformInterleaved(transform, points.data(), points.data(), points.size());
+}
+
+void transformPointVector(const Transform2d& transform, const Point2dVector& input, Point2dVector& output)
+{
+  output.resize(input.size());
+  transformInterleaved(transform, input.data(), output.data(), input.size());
+}
+
+void transformPointVector(const Transform2f& transform, const Point2fVector& input, Point2fVector& output)
+{
+  output.resize(input.size());
+  transformInterleaved(transform, input.data(), output.data(), input.size());
+}
+
+void transformPointVector(const Transform2d& transform, Point2dSoA& points)
+{
+  transformSeparated(transform, points);
+}
+
+void transformPointVector(const Transform2f& transform, Point2fSoA& points)
+{
+  transformSeparated(transform, points);
+}
+
+double transformAndSumSquaredResiduals(const Transform2d& transform, Point2dVector& points,
+                                       const Point2dVector& references)
+{
+  return transformAndSumResiduals(transform, points, references);
+}
+
+double transformAndSumSquaredResiduals(const Transform2f& transform, Point2fVector& points,
+                                       const Point2fVector& references)
+{
+  return transformAndSumResiduals(transform, points, references);
 }
 
 } // end namespace transform
@@ -27,4 +303,4 @@ void transformPointVector(const Transform2d& transform, Point2dVector& points)
 
 } // end namespace base
 
-} // end namespace francor
\ No newline at end of file
+} // end namespace francor
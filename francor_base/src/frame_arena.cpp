@@ -0,0 +1,86 @@
+/**
+ * Monotonic arena for short-lived temporaries of one frame.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_base/frame_arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace francor {
+
+namespace base {
+
+FrameArena& FrameArena::threadInstance()
+{
+  static thread_local FrameArena arena;
+  return arena;
+}
+
+void FrameArena::rewind(const Marker& marker)
+{
+  _current = marker.block;
+  _offset = marker.offset;
+
+  // nothing is allocated anymore, so the blocks can be merged and the next frames fit into one block
+  if (_current == 0 && _offset == 0 && _blocks.size() > 1) {
+    const std::size_t size = this->capacity();
+
+    _blocks.clear();
+    _blocks.push_back({ std::unique_ptr<std::byte[]>(new std::byte[size]), size });
+  }
+}
+
+std::size_t FrameArena::capacity() const noexcept
+{
+  std::size_t size = 0;
+
+  for (const auto& block : _blocks) {
+    size += block.size;
+  }
+
+  return size;
+}
+
+void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+  // try the current and all following blocks that were kept from previous frames
+  for (; _current < _blocks.size(); ++_current, _offset = 0) {
+    void* const memory = this->allocateFromCurrentBlock(bytes, alignment);
+
+    if (memory != nullptr) {
+      return memory;
+    }
+  }
+
+  // grow geometrically, so the number of blocks stays small until they are merged on reset
+  const std::size_t size = std::max({ _block_size, bytes + alignment, _blocks.empty() ? 0 : _blocks.back().size * 2 });
+
+  _blocks.push_back({ std::unique_ptr<std::byte[]>(new std::byte[size]), size });
+  _current = _blocks.size() - 1;
+  _offset = 0;
+
+  return this->allocateFromCurrentBlock(bytes, alignment);
+}
+
+void* FrameArena::allocateFromCurrentBlock(const std::size_t bytes, const std::size_t alignment)
+{
+  const Block& block = _blocks[_current];
+  const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(block.data.get());
+  const std::uintptr_t aligned = (begin + _offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+  const std::size_t offset = static_cast<std::size_t>(aligned - begin);
+
+  if (offset + bytes > block.size) {
+    return nullptr;
+  }
+
+  _offset = offset + bytes;
+
+  return block.data.get() + offset;
+}
+
+} // end namespace base
+
+} // end namespace francor
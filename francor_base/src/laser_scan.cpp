@@ -0,0 +1,130 @@
+/**
+ * Laser scan class that represents a scan from a 2d Lidar.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_base/laser_scan.h"
+
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <cmath>
+
+namespace francor {
+
+namespace base {
+
+BeamTrigonometry::BeamTrigonometry(const Angle phi_min, const Angle phi_step, const std::size_t num_beams)
+  : _phi_min(phi_min),
+    _phi_step(phi_step),
+    _cos(num_beams),
+    _sin(num_beams)
+{
+  for (std::size_t i = 0; i < num_beams; ++i) {
+    // multiply instead of accumulating the step to avoid drifting angles
+    const double phi = phi_min.radian() + static_cast<double>(i) * phi_step.radian();
+
+    _cos[i] = std::cos(phi);
+    _sin[i] = std::sin(phi);
+  }
+}
+
+std::shared_ptr<const BeamTrigonometry> BeamTrigonometry::get(const Angle phi_min, const Angle phi_step,
+                                                              const std::size_t num_beams)
+{
+  // usually a system has only a few lidars, so the cache is kept small
+  constexpr std::size_t max_cached_layouts = 32;
+
+  using Key = std::tuple<double, double, std::size_t>;
+  static std::mutex mutex;
+  static std::map<Key, std::shared_ptr<const BeamTrigonometry>> cache;
+
+  const Key key(phi_min.radian(), phi_step.radian(), num_beams);
+  std::lock_guard<std::mutex> lock(mutex);
+  const auto it = cache.find(key);
+
+  if (it != cache.end()) {
+    return it->second;
+  }
+  if (cache.size() >= max_cached_layouts) {
+    // tables still in use stay alive by their scans
+    cache.clear();
+  }
+
+  return cache.emplace(key, std::make_shared<const BeamTrigonometry>(phi_min, phi_step, num_beams)).first->second;
+}
+
+LaserScan::LaserScan(const LaserScan& origin)
+  : SensorData(origin),
+    _distances(origin._distances),
+    _phi_step(origin._phi_step),
+    _phi_min(origin._phi_min),
+    _phi_max(origin._phi_max),
+    _range(origin._range),
+    _divergence(origin._divergence),
+    _point_diameters(std::atomic_load(&origin._point_diameters)),
+    _trigonometry(std::atomic_load(&origin._trigonometry))
+{
+
+}
+
+LaserScan& LaserScan::operator=(const LaserScan& origin)
+{
+  if (this != &origin) {
+    *this = LaserScan(origin);
+  }
+
+  return *this;
+}
+
+Span<const float> LaserScan::pointExpansions() const
+{
+  auto point_diameters = std::atomic_load(&_point_diameters);
+
+  if (point_diameters == nullptr) {
+    const float factor = static_cast<float>(std::sin(_divergence / 2.0) * 2.0);
+    auto diameters = std::make_shared<Distances>(_distances.size());
+
+    for (std::size_t i = 0; i < _distances.size(); ++i) {
+      (*diameters)[i] = factor * _distances[i];
+    }
+
+    // concurrent callers calculate the same values, whichever is stored first wins
+    std::shared_ptr<const Distances> expected;
+    point_diameters = diameters;
+
+    if (!std::atomic_compare_exchange_strong(&_point_diameters, &expected, point_diameters)) {
+      point_diameters = expected;
+    }
+  }
+
+  return *point_diameters;
+}
+
+const BeamTrigonometry& LaserScan::trigonometry() const
+{
+  auto trigonometry = std::atomic_load(&_trigonometry);
+
+  if (trigonometry == nullptr) {
+    trigonometry = BeamTrigonometry::get(_phi_min, _phi_step, _distances.size());
+    std::atomic_store(&_trigonometry, trigonometry);
+  }
+
+  return *trigonometry;
+}
+
+LaserScan::Distances LaserScan::releaseDistances()
+{
+  Distances distances(std::move(_distances));
+
+  _distances.clear();
+  std::atomic_store(&_point_diameters, std::shared_ptr<const Distances>());
+  std::atomic_store(&_trigonometry, std::shared_ptr<const BeamTrigonometry>());
+
+  return distances;
+}
+
+} // end namespace base
+
+} // end namespace francor
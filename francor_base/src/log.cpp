@@ -1,5 +1,12 @@
 #include "francor_base/log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+
 namespace francor
 {
 
@@ -7,18 +14,448 @@ namespace base
 {
 
 // global log level default set to level error
-static LogLevel _log_level = LogLevel::ERROR;
+static std::atomic<LogLevel> _log_level(LogLevel::ERROR);
 
 void setLogLevel(const LogLevel level)
 {
-  _log_level = level;
+  _log_level.store(level, std::memory_order_relaxed);
 }
 
 LogLevel getLogLevel(void)
 {
-  return _log_level;
+  return _log_level.load(std::memory_order_relaxed);
+}
+
+namespace {
+
+/**
+ * \brief Lock-free single producer single consumer ring buffer for log messages. Each message is stored
+ *        contiguously as 4 byte size followed by the message, aligned to 8 byte. If a message doesn't fit at the
+ *        end, a wrap marker is written and the message starts at the begin of the buffer.
+ */
+class LogRingBuffer
+{
+public:
+  static constexpr std::uint32_t WRAP_MARKER = 0xffffffff;
+
+  explicit LogRingBuffer(const std::size_t capacity)
+    : _capacity(roundUpToPowerOfTwo(std::max<std::size_t>(capacity, 64))),
+      _data(new std::uint8_t[_capacity])
+  { }
+
+  inline std::size_t capacity() const noexcept { return _capacity; }
+  inline bool empty() const
+  {
+    return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Must be called only by the owning thread.
+   * \return false if the buffer hasn't enough space left.
+   */
+  bool write(const std::uint8_t* data, const std::size_t size)
+  {
+    const std::size_t total = align(sizeof(std::uint32_t) + size);
+    const std::size_t head = _head.load(std::memory_order_relaxed);
+    const std::size_t tail = _tail.load(std::memory_order_acquire);
+    const std::size_t offset = head & (_capacity - 1);
+    const std::size_t to_end = _capacity - offset;
+    const std::size_t padding = to_end < total ? to_end : 0;
+
+    if (total > _capacity / 2 || head + padding + total - tail > _capacity) {
+      return false;
+    }
+    if (padding > 0) {
+      std::memcpy(_data.get() + offset, &WRAP_MARKER, sizeof(WRAP_MARKER));
+    }
+
+    std::uint8_t* const record = _data.get() + ((head + padding) & (_capacity - 1));
+    const std::uint32_t record_size = static_cast<std::uint32_t>(size);
+
+    std::memcpy(record, &record_size, sizeof(record_size));
+    std::memcpy(record + sizeof(record_size), data, size);
+    _head.store(head + padding + total, std::memory_order_release);
+
+    return true;
+  }
+  /**
+   * \brief Passes all available messages to the consumer function. Must be called only by the consumer thread.
+   * \return Number of consumed messages.
+   */
+  template <typename Consumer>
+  std::size_t read(Consumer&& consumer)
+  {
+    const std::size_t head = _head.load(std::memory_order_acquire);
+    std::size_t tail = _tail.load(std::memory_order_relaxed);
+    std::size_t count = 0;
+
+    while (tail != head) {
+      const std::size_t offset = tail & (_capacity - 1);
+      std::uint32_t size;
+      std::memcpy(&size, _data.get() + offset, sizeof(size));
+
+      if (size == WRAP_MARKER) {
+        tail += _capacity - offset;
+        continue;
+      }
+
+      consumer(_data.get() + offset + sizeof(size), size);
+      tail += align(sizeof(size) + size);
+      ++count;
+    }
+
+    _tail.store(tail, std::memory_order_release);
+    return count;
+  }
+
+private:
+  static constexpr std::size_t align(const std::size_t size) { return (size + 7) & ~std::size_t(7); }
+  static std::size_t roundUpToPowerOfTwo(const std::size_t value)
+  {
+    std::size_t result = 1;
+    while (result < value) result <<= 1;
+    return result;
+  }
+
+  const std::size_t _capacity;
+  std::unique_ptr<std::uint8_t[]> _data;
+  alignas(64) std::atomic<std::size_t> _head{ 0 }; //> written by producer
+  alignas(64) std::atomic<std::size_t> _tail{ 0 }; //> written by consumer
+};
+
+class LogBackend
+{
+public:
+  static LogBackend& instance()
+  {
+    // never destroyed, so threads can log until the very end of the process
+    static LogBackend* backend = new LogBackend();
+    return *backend;
+  }
+
+  void write(const std::uint8_t* data, const std::size_t size)
+  {
+    // the writer counter lets disable() wait for producers that already decided to use the ring buffer
+    _writers.fetch_add(1);
+
+    if (_async.load()) {
+      LogRingBuffer* buffer = this->threadBuffer();
+
+      if (buffer->write(data, size)) {
+        _writers.fetch_sub(1);
+        return;
+      }
+
+      // the buffer is full or the message is too large for it, earlier messages of this thread must be written
+      // first, so wait until the worker drained the buffer. The worker keeps running as long as this writer is
+      // counted.
+      while (!buffer->empty()) {
+        _wake_up.notify_one();
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+      }
+
+      if (buffer->write(data, size)) {
+        _writers.fetch_sub(1);
+        return;
+      }
+    }
+
+    _writers.fetch_sub(1);
+
+    // synchronous mode or message is too large for the ring buffer
+    std::lock_guard<std::mutex> lock(_sink_mutex);
+    impl::writeLogMessage(*_sink, data, size);
+    _sink->flush();
+  }
+
+  void enable(const std::size_t buffer_size)
+  {
+    std::lock_guard<std::mutex> lock(_control_mutex);
+
+    if (_worker.joinable()) {
+      return;
+    }
+
+    // published to the producers by the store of _async below
+    _buffer_size.store(buffer_size, std::memory_order_relaxed);
+    _stop = false;
+    _worker = std::thread(&LogBackend::run, this);
+    _async.store(true);
+
+    static bool exit_handler_registered = false;
+
+    if (!exit_handler_registered) {
+      std::atexit([] { LogBackend::instance().disable(); });
+      exit_handler_registered = true;
+    }
+  }
+  void disable()
+  {
+    std::lock_guard<std::mutex> lock(_control_mutex);
+
+    if (!_worker.joinable()) {
+      return;
+    }
+
+    _async.store(false);
+
+    // no new messages enter the ring buffers as soon as all running writers are finished
+    while (_writers.load() > 0) {
+      std::this_thread::yield();
+    }
+    {
+      std::lock_guard<std::mutex> wait_lock(_wait_mutex);
+      _stop = true;
+    }
+
+    _wake_up.notify_one();
+    _worker.join();
+  }
+  inline bool isEnabled() const { return _async.load(); }
+
+  void flush()
+  {
+    if (!_async.load()) {
+      std::lock_guard<std::mutex> lock(_sink_mutex);
+      _sink->flush();
+      return;
+    }
+
+    // a message is consumed after it was written to the sink, so empty buffers mean everything was written
+    while (!this->allBuffersEmpty()) {
+      _wake_up.notify_one();
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+
+    std::lock_guard<std::mutex> lock(_sink_mutex);
+    _sink->flush();
+  }
+  void setSink(std::ostream& sink)
+  {
+    std::lock_guard<std::mutex> lock(_sink_mutex);
+    _sink = &sink;
+  }
+
+private:
+  LogBackend() = default;
+
+  LogRingBuffer* threadBuffer()
+  {
+    static thread_local std::shared_ptr<LogRingBuffer> buffer;
+
+    if (buffer == nullptr) {
+      buffer = std::make_shared<LogRingBuffer>(_buffer_size.load(std::memory_order_relaxed));
+
+      std::lock_guard<std::mutex> lock(_buffers_mutex);
+      _buffers.push_back(buffer);
+    }
+
+    return buffer.get();
+  }
+  bool allBuffersEmpty()
+  {
+    std::lock_guard<std::mutex> lock(_buffers_mutex);
+
+    for (const auto& buffer : _buffers) {
+      if (!buffer->empty()) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+  std::size_t drain()
+  {
+    std::lock_guard<std::mutex> buffers_lock(_buffers_mutex);
+    std::lock_guard<std::mutex> sink_lock(_sink_mutex);
+    std::size_t count = 0;
+
+    for (auto it = _buffers.begin(); it != _buffers.end();) {
+      count += (*it)->read([this](const std::uint8_t* data, const std::size_t size) {
+        impl::writeLogMessage(*_sink, data, size);
+      });
+
+      // buffers of finished threads are removed when they are empty
+      if (it->use_count() == 1 && (*it)->empty()) {
+        it = _buffers.erase(it);
+      }
+      else {
+        ++it;
+      }
+    }
+
+    if (count > 0) {
+      _sink->flush();
+    }
+
+    return count;
+  }
+  void run()
+  {
+    for (;;) {
+      if (this->drain() > 0) {
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(_wait_mutex);
+
+      if (_stop) {
+        break;
+      }
+
+      // producers don't notify to keep logging cheap, so poll with a short interval
+      _wake_up.wait_for(lock, std::chrono::milliseconds(1));
+    }
+
+    this->drain();
+  }
+
+  std::atomic<bool> _async{ false };
+  std::atomic<std::size_t> _writers{ 0 };
+  std::atomic<std::size_t> _buffer_size{ 1u << 16 }; //> written by enable(), read by producers
+
+  std::mutex _control_mutex;
+  std::mutex _wait_mutex;
+  std::condition_variable _wake_up;
+  bool _stop = false;
+  std::thread _worker;
+
+  std::mutex _buffers_mutex;
+  std::vector<std::shared_ptr<LogRingBuffer>> _buffers;
+
+  std::mutex _sink_mutex;
+  std::ostream* _sink = &std::clog;
+};
+
+} // end namespace
+
+void enableAsyncLogging(const std::size_t buffer_size)
+{
+  LogBackend::instance().enable(buffer_size);
+}
+
+void disableAsyncLogging()
+{
+  LogBackend::instance().disable();
+}
+
+bool isAsyncLoggingEnabled()
+{
+  return LogBackend::instance().isEnabled();
+}
+
+void flushLog()
+{
+  LogBackend::instance().flush();
+}
+
+void setLogSink(std::ostream& sink)
+{
+  LogBackend::instance().setSink(sink);
+}
+
+namespace impl {
+
+void LogMessage::commit()
+{
+  _open = false;
+  LogBackend::instance().write(_data.data(), _data.size());
 }
 
+void writeLogMessage(std::ostream& os, const std::uint8_t* data, const std::size_t size)
+{
+  if (size == 0) {
+    return;
+  }
+
+  switch (static_cast<LogLevel>(data[0]))
+  {
+  case LogLevel::DEBUG:
+    os << "[DEBUG] ";
+    break;
+
+  case LogLevel::INFO:
+    os << "[INFO] ";
+    break;
+
+  case LogLevel::WARNING:
+    os << "[WARNING] ";
+    break;
+
+  case LogLevel::ERROR:
+    os << "[ERROR] ";
+    break;
+
+  case LogLevel::FATAL:
+    os << "[FATAL] ";
+    break;
+
+  default:
+    os << "[UNKOWN] ";
+    break;
+  }
+
+  std::size_t position = 1;
+
+  auto read = [&](auto& value) {
+    std::memcpy(&value, data + position, sizeof(value));
+    position += sizeof(value);
+  };
+
+  while (position < size) {
+    const auto type = static_cast<LogArgument>(data[position++]);
+
+    switch (type)
+    {
+    case LogArgument::BOOL: {
+      std::uint8_t value;
+      read(value);
+      os << static_cast<bool>(value);
+      break;
+    }
+    case LogArgument::CHAR: {
+      char value;
+      read(value);
+      os << value;
+      break;
+    }
+    case LogArgument::INT: {
+      std::int64_t value;
+      read(value);
+      os << value;
+      break;
+    }
+    case LogArgument::UINT: {
+      std::uint64_t value;
+      read(value);
+      os << value;
+      break;
+    }
+    case LogArgument::REAL: {
+      double value;
+      read(value);
+      os << value;
+      break;
+    }
+    case LogArgument::STRING: {
+      std::uint32_t length;
+      read(length);
+      os.write(reinterpret_cast<const char*>(data + position), length);
+      position += length;
+      break;
+    }
+    default:
+      // corrupted message, stop decoding
+      position = size;
+      break;
+    }
+  }
+
+  os << '\n';
+}
+
+} // end namespace impl
+
 } // end namespace base
 
-} // end namespace francor
\ No newline at end of file
+} // end namespace francor
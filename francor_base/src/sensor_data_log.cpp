@@ -0,0 +1,828 @@
+/**
+ * Compact binary log format for sensor data streams. Includes a writer and a memory-mapped reader.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_base/sensor_data_log.h"
+#include "francor_base/log.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace francor {
+
+namespace base {
+
+namespace impl {
+
+std::uint16_t convertToHalf(const float value)
+{
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  const std::uint32_t sign = (bits >> 16) & 0x8000u;
+  const std::uint32_t exponent = (bits >> 23) & 0xffu;
+  std::uint32_t mantissa = bits & 0x7fffffu;
+
+  // nan and inf
+  if (exponent == 0xffu) {
+    return static_cast<std::uint16_t>(sign | 0x7c00u | (mantissa != 0u ? 0x200u : 0u));
+  }
+
+  const std::int32_t half_exponent = static_cast<std::int32_t>(exponent) - 127 + 15;
+
+  // overflow
+  if (half_exponent >= 0x1f) {
+    return static_cast<std::uint16_t>(sign | 0x7c00u);
+  }
+  // subnormal or zero
+  if (half_exponent <= 0) {
+    if (half_exponent < -10) {
+      return static_cast<std::uint16_t>(sign);
+    }
+
+    mantissa |= 0x800000u;
+    const std::uint32_t shift = static_cast<std::uint32_t>(14 - half_exponent);
+    const std::uint32_t remainder = mantissa & ((1u << shift) - 1u);
+    const std::uint32_t halfway = 1u << (shift - 1u);
+    std::uint32_t half_mantissa = mantissa >> shift;
+
+    if (remainder > halfway || (remainder == halfway && (half_mantissa & 1u))) {
+      ++half_mantissa;
+    }
+
+    return static_cast<std::uint16_t>(sign | half_mantissa);
+  }
+
+  // round to nearest even, a carry into the exponent is intended
+  std::uint32_t half = sign | (static_cast<std::uint32_t>(half_exponent) << 10) | (mantissa >> 13);
+  const std::uint32_t remainder = mantissa & 0x1fffu;
+
+  if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) {
+    ++half;
+  }
+
+  return static_cast<std::uint16_t>(half);
+}
+
+float convertFromHalf(const std::uint16_t value)
+{
+  const std::uint32_t sign = static_cast<std::uint32_t>(value & 0x8000u) << 16;
+  const std::uint32_t exponent = (value >> 10) & 0x1fu;
+  std::uint32_t mantissa = value & 0x3ffu;
+  std::uint32_t bits;
+
+  if (exponent == 0x1fu) {
+    bits = sign | 0x7f800000u | (mantissa << 13);
+  }
+  else if (exponent == 0u) {
+    if (mantissa == 0u) {
+      bits = sign;
+    }
+    else {
+      // normalize subnormal value
+      std::uint32_t shift = 0;
+
+      while ((mantissa & 0x400u) == 0u) {
+        mantissa <<= 1;
+        ++shift;
+      }
+
+      bits = sign | ((127u - 15u + 1u - shift) << 23) | ((mantissa & 0x3ffu) << 13);
+    }
+  }
+  else {
+    bits = sign | ((exponent + 127u - 15u) << 23) | (mantissa << 13);
+  }
+
+  float result;
+  std::memcpy(&result, &bits, sizeof(result));
+
+  return result;
+}
+
+} // end namespace impl
+
+namespace {
+
+constexpr std::uint16_t INVALID_QUANTIZED_DISTANCE = 0xffffu;
+
+inline std::size_t alignRecordSize(const std::size_t size)
+{
+  return (size + 7u) & ~std::size_t(7u);
+}
+
+inline std::size_t sizeOfDistance(const DistanceEncoding encoding)
+{
+  switch (encoding) {
+  case DistanceEncoding::FLOAT64:
+    return sizeof(double);
+  case DistanceEncoding::FLOAT32:
+    return sizeof(float);
+  case DistanceEncoding::FLOAT16:
+  case DistanceEncoding::QUANTIZED16:
+    return sizeof(std::uint16_t);
+  }
+
+  return 0;
+}
+
+template <typename Type>
+inline Type readValue(std::uint8_t const* const data)
+{
+  Type value;
+  std::memcpy(&value, data, sizeof(Type));
+  return value;
+}
+
+// checks if the record fits into the memory up to end and if its payload is large enough for its type
+bool isRecordValid(std::uint8_t const* const record, std::uint8_t const* const end)
+{
+  if (end - record < static_cast<std::ptrdiff_t>(sizeof(impl::RecordHeader))) {
+    return false;
+  }
+
+  const auto header = readValue<impl::RecordHeader>(record);
+
+  if (header.size > static_cast<std::size_t>(end - record) - sizeof(header)) {
+    return false;
+  }
+
+  switch (static_cast<SensorDataLogRecordType>(header.type)) {
+  case SensorDataLogRecordType::SENSOR_NAME:
+    return header.size >= sizeof(std::uint32_t)
+           &&
+           readValue<std::uint32_t>(record + sizeof(header)) <= header.size - sizeof(std::uint32_t);
+
+  case SensorDataLogRecordType::LASER_SCAN:
+    {
+      if (header.size < sizeof(impl::LaserScanPayload)) {
+        return false;
+      }
+
+      const auto payload = readValue<impl::LaserScanPayload>(record + sizeof(header));
+      const std::size_t size_of_distance = sizeOfDistance(static_cast<DistanceEncoding>(payload.encoding));
+
+      // division instead of multiplication, so a corrupted count can't overflow
+      return size_of_distance > 0
+             &&
+             payload.num_distances <= (header.size - sizeof(impl::LaserScanPayload)) / size_of_distance;
+    }
+
+  case SensorDataLogRecordType::EGO_MOTION:
+    return header.size >= sizeof(impl::EgoMotionPayload);
+
+  case SensorDataLogRecordType::POSE_SENSOR_DATA:
+    return header.size >= sizeof(impl::PoseSensorDataPayload);
+
+  case SensorDataLogRecordType::POSE:
+    return header.size >= sizeof(impl::PosePayload);
+  }
+
+  // unknown types are skipped by the user, only their size matters
+  return true;
+}
+
+template <typename Type>
+inline void writeValue(std::uint8_t* const data, const Type value)
+{
+  std::memcpy(data, &value, sizeof(Type));
+}
+
+template <typename Matrix>
+inline void copyMatrix(double* const destination, const Matrix& matrix)
+{
+  for (Eigen::Index row = 0; row < matrix.rows(); ++row) {
+    for (Eigen::Index col = 0; col < matrix.cols(); ++col) {
+      destination[row * matrix.cols() + col] = matrix(row, col);
+    }
+  }
+}
+
+template <typename Matrix>
+inline Matrix createMatrix(double const* const source)
+{
+  Matrix matrix;
+
+  for (Eigen::Index row = 0; row < matrix.rows(); ++row) {
+    for (Eigen::Index col = 0; col < matrix.cols(); ++col) {
+      matrix(row, col) = source[row * matrix.cols() + col];
+    }
+  }
+
+  return matrix;
+}
+
+} // end namespace
+
+// Writer
+
+bool SensorDataLogWriter::open(const std::string& file_name, const Parameter& parameter)
+{
+  this->close();
+
+  if (parameter.distance_encoding == DistanceEncoding::QUANTIZED16 && !(parameter.quantization_resolution > 0.0)) {
+    LogError() << "SensorDataLogWriter: quantization resolution must be greater than zero.";
+    return false;
+  }
+
+  _file.open(file_name, std::ios::binary | std::ios::trunc);
+
+  if (!_file.is_open()) {
+    LogError() << "SensorDataLogWriter: can't open file \"" << file_name << "\".";
+    return false;
+  }
+
+  _parameter = parameter;
+  _sensor_ids.clear();
+  _sensor_in_chunk.clear();
+  _chunk_names.clear();
+  _chunk_data.clear();
+  _chunk_header = { impl::SENSOR_DATA_LOG_CHUNK, 0, 0, 0.0, 0.0 };
+
+  const impl::FileHeader header = { impl::SENSOR_DATA_LOG_MAGIC, impl::SENSOR_DATA_LOG_VERSION,
+                                    impl::SENSOR_DATA_LOG_BOM, 0 };
+  _file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  return _file.good();
+}
+
+bool SensorDataLogWriter::close()
+{
+  if (!_file.is_open()) {
+    return true;
+  }
+
+  const bool ret = this->flush();
+  _file.close();
+
+  return ret && !_file.fail();
+}
+
+bool SensorDataLogWriter::write(const SensorData& data)
+{
+  if (!_file.is_open()) {
+    LogError() << "SensorDataLogWriter: log file is not open.";
+    return false;
+  }
+
+  bool ret = false;
+
+  if (const auto scan = dynamic_cast<const LaserScan*>(&data)) {
+    ret = this->writeLaserScan(*scan);
+  }
+  else if (const auto ego_motion = dynamic_cast<const EgoMotionSensorData*>(&data)) {
+    ret = this->writeEgoMotion(*ego_motion);
+  }
+  else if (const auto pose_data = dynamic_cast<const PoseSensorData*>(&data)) {
+    ret = this->writePoseSensorData(*pose_data);
+  }
+  else {
+    LogError() << "SensorDataLogWriter: sensor data type is not supported.";
+    return false;
+  }
+
+  if (ret && _chunk_names.size() + _chunk_data.size() >= _parameter.chunk_size) {
+    ret = this->flush();
+  }
+
+  return ret;
+}
+
+bool SensorDataLogWriter::write(const Pose2d& pose, const double time_stamp, char const* const sensor_name)
+{
+  if (!_file.is_open()) {
+    LogError() << "SensorDataLogWriter: log file is not open.";
+    return false;
+  }
+
+  const impl::PosePayload payload = { pose.position().x(), pose.position().y(), pose.orientation().radian() };
+  writeValue(this->addRecord(SensorDataLogRecordType::POSE, time_stamp, sensor_name, sizeof(payload)), payload);
+
+  if (_chunk_names.size() + _chunk_data.size() >= _parameter.chunk_size) {
+    return this->flush();
+  }
+
+  return true;
+}
+
+bool SensorDataLogWriter::flush()
+{
+  if (!_file.is_open()) {
+    return false;
+  }
+  if (_chunk_header.num_records == 0) {
+    return true;
+  }
+
+  _chunk_header.size = _chunk_names.size() + _chunk_data.size();
+
+  _file.write(reinterpret_cast<const char*>(&_chunk_header), sizeof(_chunk_header));
+  _file.write(reinterpret_cast<const char*>(_chunk_names.data()), _chunk_names.size());
+  _file.write(reinterpret_cast<const char*>(_chunk_data.data()), _chunk_data.size());
+  _file.flush();
+
+  _chunk_header = { impl::SENSOR_DATA_LOG_CHUNK, 0, 0, 0.0, 0.0 };
+  _chunk_names.clear();
+  _chunk_data.clear();
+  std::fill(_sensor_in_chunk.begin(), _sensor_in_chunk.end(), false);
+
+  return _file.good();
+}
+
+bool SensorDataLogWriter::writeLaserScan(const LaserScan& scan)
+{
+  const auto distances = scan.distances();
+
+  if (distances.size() > std::numeric_limits<std::uint32_t>::max()) {
+    LogError() << "SensorDataLogWriter: laser scan has too many distances.";
+    return false;
+  }
+
+  impl::LaserScanPayload payload;
+  payload.x             = scan.pose().position().x();
+  payload.y             = scan.pose().position().y();
+  payload.phi           = scan.pose().orientation().radian();
+  payload.phi_min       = scan.phiMin().radian();
+  payload.phi_max       = scan.phiMax().radian();
+  payload.phi_step      = scan.phiStep().radian();
+  payload.range         = scan.range();
+  payload.divergence    = scan.divergence().radian();
+  payload.num_distances = static_cast<std::uint32_t>(distances.size());
+  payload.encoding      = static_cast<std::uint16_t>(_parameter.distance_encoding);
+  payload.reserved      = 0;
+  payload.resolution    = _parameter.quantization_resolution;
+
+  const std::size_t size = sizeof(payload) + distances.size() * sizeOfDistance(_parameter.distance_encoding);
+  std::uint8_t* const record = this->addRecord(SensorDataLogRecordType::LASER_SCAN, scan.timeStamp(),
+                                               scan.sensorName(), size);
+  writeValue(record, payload);
+  std::uint8_t* const output = record + sizeof(payload);
+
+  switch (_parameter.distance_encoding) {
+  case DistanceEncoding::FLOAT64:
+    for (std::size_t i = 0; i < distances.size(); ++i) {
+      writeValue(output + i * sizeof(double), static_cast<double>(distances[i]));
+    }
+    break;
+
+  case DistanceEncoding::FLOAT32:
+    std::memcpy(output, distances.data(), distances.size() * sizeof(float));
+    break;
+
+  case DistanceEncoding::FLOAT16:
+    for (std::size_t i = 0; i < distances.size(); ++i) {
+      writeValue(output + i * sizeof(std::uint16_t), impl::convertToHalf(distances[i]));
+    }
+    break;
+
+  case DistanceEncoding::QUANTIZED16:
+    for (std::size_t i = 0; i < distances.size(); ++i) {
+      const double quantized = std::round(distances[i] / _parameter.quantization_resolution);
+      const std::uint16_t value = quantized >= 0.0 && quantized < INVALID_QUANTIZED_DISTANCE
+                                  ? static_cast<std::uint16_t>(quantized)
+                                  : INVALID_QUANTIZED_DISTANCE; // nan fails both comparisons
+
+      writeValue(output + i * sizeof(std::uint16_t), value);
+    }
+    break;
+  }
+
+  return true;
+}
+
+bool SensorDataLogWriter::writeEgoMotion(const EgoMotionSensorData& ego_motion)
+{
+  impl::EgoMotionPayload payload;
+  payload.velocity = ego_motion.velocity();
+  payload.yaw_rate = ego_motion.yawRate();
+  copyMatrix(payload.covariances, ego_motion.covariances());
+
+  writeValue(this->addRecord(SensorDataLogRecordType::EGO_MOTION, ego_motion.timeStamp(), ego_motion.sensorName(),
+                             sizeof(payload)),
+             payload);
+
+  return true;
+}
+
+bool SensorDataLogWriter::writePoseSensorData(const PoseSensorData& pose_data)
+{
+  impl::PoseSensorDataPayload payload;
+  payload.pose = { pose_data.pose().position().x(), pose_data.pose().position().y(),
+                   pose_data.pose().orientation().radian() };
+  copyMatrix(payload.covariances, pose_data.covariances());
+
+  writeValue(this->addRecord(SensorDataLogRecordType::POSE_SENSOR_DATA, pose_data.timeStamp(),
+                             pose_data.sensorName(), sizeof(payload)),
+             payload);
+
+  return true;
+}
+
+std::uint8_t* SensorDataLogWriter::addRecord(const SensorDataLogRecordType type, const double time_stamp,
+                                             char const* const sensor_name, const std::size_t payload_size)
+{
+  const std::uint16_t sensor_id = this->registerSensorName(sensor_name);
+  const impl::RecordHeader header = { static_cast<std::uint16_t>(type), sensor_id,
+                                      static_cast<std::uint32_t>(alignRecordSize(payload_size)), time_stamp };
+  const std::size_t offset = _chunk_data.size();
+
+  _chunk_data.resize(offset + sizeof(header) + header.size, 0u);
+  writeValue(_chunk_data.data() + offset, header);
+
+  if (_chunk_header.num_records == 0) {
+    _chunk_header.time_stamp_first = time_stamp;
+  }
+
+  _chunk_header.time_stamp_last = time_stamp;
+  ++_chunk_header.num_records;
+
+  return _chunk_data.data() + offset + sizeof(header);
+}
+
+std::uint16_t SensorDataLogWriter::registerSensorName(char const* const sensor_name)
+{
+  const std::string name(sensor_name != nullptr ? sensor_name : "unkown");
+  auto it = _sensor_ids.find(name);
+
+  if (it == _sensor_ids.end()) {
+    it = _sensor_ids.emplace(name, static_cast<std::uint16_t>(_sensor_ids.size())).first;
+    _sensor_in_chunk.push_back(false);
+  }
+
+  const std::uint16_t id = it->second;
+
+  // each chunk carries the names of its sensors, so it can be read without the previous chunks
+  if (!_sensor_in_chunk[id]) {
+    const std::size_t size = alignRecordSize(sizeof(std::uint32_t) + name.size());
+    const impl::RecordHeader header = { static_cast<std::uint16_t>(SensorDataLogRecordType::SENSOR_NAME), id,
+                                        static_cast<std::uint32_t>(size), 0.0 };
+    const std::size_t offset = _chunk_names.size();
+
+    _chunk_names.resize(offset + sizeof(header) + size, 0u);
+    writeValue(_chunk_names.data() + offset, header);
+    writeValue(_chunk_names.data() + offset + sizeof(header), static_cast<std::uint32_t>(name.size()));
+    std::memcpy(_chunk_names.data() + offset + sizeof(header) + sizeof(std::uint32_t), name.data(), name.size());
+    _sensor_in_chunk[id] = true;
+  }
+
+  return id;
+}
+
+// Record Views
+
+LaserScanRecordView::LaserScanRecordView(std::uint8_t const* const payload)
+  : _payload(readValue<impl::LaserScanPayload>(payload)),
+    _distances(payload + sizeof(impl::LaserScanPayload))
+{
+
+}
+
+double LaserScanRecordView::distance(const std::size_t index) const
+{
+  switch (this->encoding()) {
+  case DistanceEncoding::FLOAT64:
+    return readValue<double>(_distances + index * sizeof(double));
+
+  case DistanceEncoding::FLOAT32:
+    return readValue<float>(_distances + index * sizeof(float));
+
+  case DistanceEncoding::FLOAT16:
+    return impl::convertFromHalf(readValue<std::uint16_t>(_distances + index * sizeof(std::uint16_t)));
+
+  case DistanceEncoding::QUANTIZED16:
+    {
+      const auto value = readValue<std::uint16_t>(_distances + index * sizeof(std::uint16_t));
+      return value == INVALID_QUANTIZED_DISTANCE ? std::numeric_limits<double>::quiet_NaN()
+                                                 : static_cast<double>(value) * _payload.resolution;
+    }
+  }
+
+  return std::numeric_limits<double>::quiet_NaN();
+}
+
+void LaserScanRecordView::copyDistances(std::vector<double>& distances) const
+{
+  distances.resize(this->numOfDistances());
+  this->decodeDistances(distances.data());
+}
+
+void LaserScanRecordView::copyDistances(LaserScan::Distances& distances) const
+{
+  distances.resize(this->numOfDistances());
+  this->decodeDistances(distances.data());
+}
+
+template <typename Real>
+void LaserScanRecordView::decodeDistances(Real* const distances) const
+{
+  const std::size_t num_distances = this->numOfDistances();
+
+  // switch outside of the loops to keep them simple for the compiler
+  switch (this->encoding()) {
+  case DistanceEncoding::FLOAT64:
+    for (std::size_t i = 0; i < num_distances; ++i) {
+      distances[i] = static_cast<Real>(readValue<double>(_distances + i * sizeof(double)));
+    }
+    break;
+
+  case DistanceEncoding::FLOAT32:
+    for (std::size_t i = 0; i < num_distances; ++i) {
+      distances[i] = readValue<float>(_distances + i * sizeof(float));
+    }
+    break;
+
+  case DistanceEncoding::FLOAT16:
+    for (std::size_t i = 0; i < num_distances; ++i) {
+      distances[i] = impl::convertFromHalf(readValue<std::uint16_t>(_distances + i * sizeof(std::uint16_t)));
+    }
+    break;
+
+  case DistanceEncoding::QUANTIZED16:
+    for (std::size_t i = 0; i < num_distances; ++i) {
+      const auto value = readValue<std::uint16_t>(_distances + i * sizeof(std::uint16_t));
+      distances[i] = value == INVALID_QUANTIZED_DISTANCE ? std::numeric_limits<Real>::quiet_NaN()
+                                                         : static_cast<Real>(value * _payload.resolution);
+    }
+    break;
+  }
+}
+
+std::shared_ptr<LaserScan> LaserScanRecordView::createLaserScan(char const* const sensor_name,
+                                                                const double time_stamp) const
+{
+  LaserScan::Distances distances;
+  this->copyDistances(distances);
+
+  return std::make_shared<LaserScan>(std::move(distances), this->pose(), this->phiMin(), this->phiMax(), this->phiStep(),
+                                     this->range(), this->divergence(), sensor_name, time_stamp);
+}
+
+LaserScanRecordView SensorDataLogRecord::laserScan() const
+{
+  return LaserScanRecordView(this->payload());
+}
+
+EgoMotionSensorData SensorDataLogRecord::egoMotion() const
+{
+  const auto payload = readValue<impl::EgoMotionPayload>(this->payload());
+
+  return { this->timeStamp(), payload.velocity, payload.yaw_rate,
+           createMatrix<Matrix2d>(payload.covariances), _sensor_name };
+}
+
+PoseSensorData SensorDataLogRecord::poseSensorData() const
+{
+  const auto payload = readValue<impl::PoseSensorDataPayload>(this->payload());
+
+  return { this->timeStamp(), Pose2d({ payload.pose.x, payload.pose.y }, payload.pose.phi),
+           createMatrix<Matrix3d>(payload.covariances), _sensor_name };
+}
+
+Pose2d SensorDataLogRecord::pose() const
+{
+  const auto payload = readValue<impl::PosePayload>(this->payload());
+  return { { payload.x, payload.y }, payload.phi };
+}
+
+std::shared_ptr<SensorData> SensorDataLogRecord::createSensorData() const
+{
+  switch (this->type()) {
+  case SensorDataLogRecordType::LASER_SCAN:
+    return this->laserScan().createLaserScan(_sensor_name, this->timeStamp());
+
+  case SensorDataLogRecordType::EGO_MOTION:
+    return std::make_shared<EgoMotionSensorData>(this->egoMotion());
+
+  case SensorDataLogRecordType::POSE_SENSOR_DATA:
+    return std::make_shared<PoseSensorData>(this->poseSensorData());
+
+  case SensorDataLogRecordType::POSE:
+    return std::make_shared<PoseSensorData>(this->timeStamp(), this->pose(), Matrix3d::Zero(), _sensor_name);
+
+  default:
+    return nullptr;
+  }
+}
+
+// Reader
+
+void SensorDataLogReader::Iterator::advance()
+{
+  const auto header = readValue<impl::RecordHeader>(_record);
+  std::uint8_t const* const chunk_end = _reader->chunkEnd(_chunk);
+
+  _record += sizeof(header) + header.size;
+
+  // a corrupted record ends the chunk
+  if (_record > chunk_end || (_record < chunk_end && !isRecordValid(_record, chunk_end))) {
+    _record = chunk_end;
+  }
+}
+
+void SensorDataLogReader::Iterator::skipSensorNames()
+{
+  while (_chunk < _reader->numOfChunks()) {
+    const auto chunk_end = _reader->chunkEnd(_chunk);
+
+    if (_record == chunk_end || !isRecordValid(_record, chunk_end)) {
+      ++_chunk;
+      _record = _reader->chunkBegin(_chunk);
+      continue;
+    }
+    if (readValue<impl::RecordHeader>(_record).type
+        != static_cast<std::uint16_t>(SensorDataLogRecordType::SENSOR_NAME)) {
+      return;
+    }
+
+    this->advance();
+  }
+}
+
+bool SensorDataLogReader::open(const std::string& file_name)
+{
+  this->close();
+
+  const int fd = ::open(file_name.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    LogError() << "SensorDataLogReader: can't open file \"" << file_name << "\".";
+    return false;
+  }
+
+  struct stat file_status;
+
+  if (::fstat(fd, &file_status) != 0 || file_status.st_size < static_cast<off_t>(sizeof(impl::FileHeader))) {
+    LogError() << "SensorDataLogReader: file \"" << file_name << "\" is not a sensor data log.";
+    ::close(fd);
+    return false;
+  }
+
+  _size = static_cast<std::size_t>(file_status.st_size);
+  void* const data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+
+  if (data == MAP_FAILED) {
+    LogError() << "SensorDataLogReader: can't map file \"" << file_name << "\" into memory.";
+    _size = 0;
+    return false;
+  }
+
+  _data = static_cast<std::uint8_t const*>(data);
+  // records are read sequentially in most cases
+  ::madvise(data, _size, MADV_SEQUENTIAL);
+
+  const auto header = readValue<impl::FileHeader>(_data);
+
+  if (header.magic != impl::SENSOR_DATA_LOG_MAGIC || header.byte_order_mark != impl::SENSOR_DATA_LOG_BOM) {
+    LogError() << "SensorDataLogReader: file \"" << file_name << "\" is not a sensor data log or has a different"
+               << " byte order.";
+    this->close();
+    return false;
+  }
+  if (header.version == 0 || header.version > impl::SENSOR_DATA_LOG_VERSION) {
+    LogError() << "SensorDataLogReader: version " << header.version << " of file \"" << file_name
+               << "\" is not supported.";
+    this->close();
+    return false;
+  }
+
+  // index chunks, the record headers are validated, so the records can be accessed without further checks
+  std::size_t offset = sizeof(impl::FileHeader);
+
+  while (offset + sizeof(impl::ChunkHeader) <= _size) {
+    const auto chunk_header = readValue<impl::ChunkHeader>(_data + offset);
+
+    if (chunk_header.magic != impl::SENSOR_DATA_LOG_CHUNK
+        ||
+        chunk_header.size > _size - offset - sizeof(impl::ChunkHeader)) {
+      LogWarn() << "SensorDataLogReader: file \"" << file_name << "\" ends with an incomplete chunk. It is"
+                   << " ignored.";
+      break;
+    }
+
+    _chunks.push_back({ offset + sizeof(impl::ChunkHeader), chunk_header });
+    offset += sizeof(impl::ChunkHeader) + chunk_header.size;
+
+    if (!this->indexChunk(_chunks.back())) {
+      LogWarn() << "SensorDataLogReader: chunk " << _chunks.size() - 1 << " of file \"" << file_name
+                   << "\" contains a corrupted record. The rest of the chunk is ignored.";
+    }
+
+    _num_records += _chunks.back().header.num_records;
+  }
+
+  return true;
+}
+
+void SensorDataLogReader::close()
+{
+  if (_data != nullptr) {
+    ::munmap(const_cast<std::uint8_t*>(_data), _size);
+  }
+
+  _data = nullptr;
+  _size = 0;
+  _chunks.clear();
+  _sensor_names.clear();
+  _num_records = 0;
+}
+
+SensorDataLogReader::Iterator SensorDataLogReader::lowerBound(const double time_stamp) const
+{
+  const auto chunk = std::find_if(_chunks.begin(), _chunks.end(), [&] (const Chunk& chunk) {
+    return chunk.header.time_stamp_last >= time_stamp;
+  });
+  const std::size_t index = static_cast<std::size_t>(chunk - _chunks.begin());
+  Iterator it(this, index, this->chunkBegin(index));
+  const Iterator last = this->end();
+
+  for (; it != last && (*it).timeStamp() < time_stamp; ++it) { }
+
+  return it;
+}
+
+bool SensorDataLogReader::isSensorDataLog(const std::string& file_name)
+{
+  std::ifstream file(file_name, std::ios::binary);
+  impl::FileHeader header;
+
+  if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    return false;
+  }
+
+  return header.magic == impl::SENSOR_DATA_LOG_MAGIC && header.byte_order_mark == impl::SENSOR_DATA_LOG_BOM;
+}
+
+std::uint8_t const* SensorDataLogReader::chunkBegin(const std::size_t chunk) const
+{
+  if (chunk < _chunks.size()) {
+    return _data + _chunks[chunk].offset;
+  }
+  if (_chunks.empty()) {
+    return _data + (_data != nullptr ? sizeof(impl::FileHeader) : 0u);
+  }
+
+  return this->chunkEnd(_chunks.size() - 1);
+}
+
+std::uint8_t const* SensorDataLogReader::chunkEnd(const std::size_t chunk) const
+{
+  return _data + _chunks[chunk].offset + _chunks[chunk].header.size;
+}
+
+char const* SensorDataLogReader::sensorName(const std::uint16_t id) const
+{
+  return id < _sensor_names.size() && _sensor_names[id] != nullptr ? _sensor_names[id]->c_str() : "unkown";
+}
+
+bool SensorDataLogReader::indexChunk(Chunk& chunk)
+{
+  std::uint8_t const* record = _data + chunk.offset;
+  std::uint8_t const* const end = record + chunk.header.size;
+  std::uint32_t num_records = 0;
+  bool valid = true;
+
+  // sensor names are stored at the beginning of each chunk, the data records follow
+  while (record < end) {
+    if (!isRecordValid(record, end)) {
+      valid = false;
+      break;
+    }
+
+    const auto header = readValue<impl::RecordHeader>(record);
+
+    if (header.type == static_cast<std::uint16_t>(SensorDataLogRecordType::SENSOR_NAME)) {
+      if (header.sensor_id >= _sensor_names.size()) {
+        _sensor_names.resize(header.sensor_id + 1u);
+      }
+      if (_sensor_names[header.sensor_id] == nullptr) {
+        _sensor_names[header.sensor_id] = std::make_unique<std::string>(
+          reinterpret_cast<const char*>(record + sizeof(header) + sizeof(std::uint32_t)),
+          readValue<std::uint32_t>(record + sizeof(header)));
+      }
+    }
+    else {
+      ++num_records;
+    }
+
+    record += sizeof(header) + header.size;
+  }
+
+  // the chunk ends before the first corrupted record
+  chunk.header.size = static_cast<std::size_t>(record - (_data + chunk.offset));
+  chunk.header.num_records = num_records;
+
+  return valid;
+}
+
+} // end namespace base
+
+} // end namespace francor
@@ -0,0 +1,376 @@
+/**
+ * Lightweight trace event recording.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_base/trace.h"
+#include "francor_base/log.h"
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <unistd.h>
+
+namespace francor {
+
+namespace base {
+
+namespace impl {
+
+std::atomic<bool> tracing_enabled(false);
+
+} // end namespace impl
+
+namespace {
+
+/**
+ * \brief Events of one thread. Only the owning thread appends events, busy is set while it does, so the events
+ *        can be read safely by other threads after tracing was stopped.
+ */
+struct TraceBuffer
+{
+  std::vector<impl::TraceEvent> events;
+  std::atomic<bool> busy{ false };
+  std::string thread_name;
+  std::size_t thread_id = 0;
+};
+
+class TraceRegistry
+{
+public:
+  static TraceRegistry& instance()
+  {
+    // leaked on purpose, threads can record events during static destruction
+    static TraceRegistry* registry = new TraceRegistry();
+    return *registry;
+  }
+
+  TraceBuffer& threadBuffer()
+  {
+    static thread_local std::shared_ptr<TraceBuffer> buffer;
+
+    if (buffer == nullptr) {
+      buffer = std::make_shared<TraceBuffer>();
+      std::lock_guard<std::mutex> lock(_mutex);
+      buffer->thread_id = _buffers.size() + 1;
+      buffer->events.reserve(_reserved_events);
+      _buffers.push_back(buffer);
+    }
+
+    return *buffer;
+  }
+
+  void start(const std::size_t reserved_events)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _reserved_events = reserved_events;
+    impl::tracing_enabled.store(true, std::memory_order_seq_cst);
+  }
+  // returns true if tracing was enabled before
+  bool stop()
+  {
+    const bool was_enabled = impl::tracing_enabled.exchange(false, std::memory_order_seq_cst);
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (const auto& buffer : _buffers) {
+      while (buffer->busy.load(std::memory_order_seq_cst)) {
+        std::this_thread::yield();
+      }
+    }
+
+    return was_enabled;
+  }
+
+  void setThreadName(const std::string& name)
+  {
+    auto& buffer = this->threadBuffer();
+    std::lock_guard<std::mutex> lock(_mutex);
+    buffer.thread_name = name;
+  }
+
+  char const* intern(const std::string& name)
+  {
+    // the thread local cache avoids the lock for names that were interned by this thread before
+    static thread_local std::unordered_map<std::string_view, char const*> cache;
+    const auto entry = cache.find(std::string_view(name));
+
+    if (entry != cache.end()) {
+      return entry->second;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    // nodes of an unordered set are never moved, so the pointer stays valid
+    char const* const interned = _names.insert(name).first->c_str();
+    cache.emplace(std::string_view(interned), interned);
+
+    return interned;
+  }
+
+  // must only be called while tracing is stopped
+  template <typename Function>
+  void visitBuffers(Function function)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (const auto& buffer : _buffers) {
+      function(*buffer);
+    }
+  }
+
+private:
+  TraceRegistry() = default;
+
+  std::mutex _mutex;
+  std::vector<std::shared_ptr<TraceBuffer>> _buffers;
+  std::unordered_set<std::string> _names;
+  std::size_t _reserved_events = 0;
+};
+
+// pauses tracing for the lifetime of the object
+class TracePause
+{
+public:
+  TracePause() : _was_enabled(TraceRegistry::instance().stop()) { }
+  ~TracePause()
+  {
+    if (_was_enabled)
+      impl::tracing_enabled.store(true, std::memory_order_seq_cst);
+  }
+
+private:
+  bool _was_enabled;
+};
+
+ScopedTrace*& currentScope()
+{
+  static thread_local ScopedTrace* scope = nullptr;
+  return scope;
+}
+
+void writeJsonString(std::ostream& os, char const* const text)
+{
+  static constexpr char HEX[] = "0123456789abcdef";
+  os << '"';
+
+  for (char const* c = text; *c != '\0'; ++c) {
+    switch (*c) {
+    case '"':  os << "\\\""; break;
+    case '\\': os << "\\\\"; break;
+    case '\n': os << "\\n";  break;
+    case '\t': os << "\\t";  break;
+    default:
+      if (static_cast<unsigned char>(*c) < 0x20)
+        os << "\\u00" << HEX[(*c >> 4) & 0xf] << HEX[*c & 0xf];
+      else
+        os << *c;
+    }
+  }
+
+  os << '"';
+}
+
+// time stamps in Chrome traces are microseconds
+void writeMicroseconds(std::ostream& os, const std::int64_t nanoseconds)
+{
+  const std::int64_t sign = nanoseconds < 0 ? -1 : 1;
+  const std::int64_t magnitude = nanoseconds * sign;
+  const std::int64_t fraction = magnitude % 1000;
+
+  if (sign < 0)
+    os << '-';
+
+  os << magnitude / 1000 << '.' << static_cast<char>('0' + fraction / 100) << static_cast<char>('0' + fraction / 10 % 10)
+     << static_cast<char>('0' + fraction % 10);
+}
+
+void writeEvent(std::ostream& os, const impl::TraceEvent& event, const int process_id, const std::size_t thread_id)
+{
+  os << "{\"name\":";
+  writeJsonString(os, event.name);
+  os << ",\"cat\":\"francor\",\"ph\":\"X\",\"ts\":";
+  writeMicroseconds(os, event.begin);
+  os << ",\"dur\":";
+  writeMicroseconds(os, event.end - event.begin);
+  os << ",\"pid\":" << process_id << ",\"tid\":" << thread_id;
+
+  if (event.num_arguments > 0) {
+    os << ",\"args\":{";
+
+    for (std::size_t i = 0; i < event.num_arguments; ++i) {
+      if (i > 0)
+        os << ',';
+
+      writeJsonString(os, event.arguments[i].name);
+      os << ':';
+
+      // JSON has no representation of nan and inf
+      if (std::isfinite(event.arguments[i].value))
+        os << event.arguments[i].value;
+      else
+        os << "null";
+    }
+
+    os << '}';
+  }
+
+  os << '}';
+}
+
+} // end namespace
+
+namespace impl {
+
+std::int64_t traceTimeStamp()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void recordTraceEvent(const TraceEvent& event)
+{
+  auto& buffer = TraceRegistry::instance().threadBuffer();
+
+  // stopTracing() first clears the flag and then waits for busy, so either it sees the event being written or this
+  // thread sees the cleared flag
+  buffer.busy.store(true, std::memory_order_seq_cst);
+
+  if (tracing_enabled.load(std::memory_order_seq_cst))
+    buffer.events.push_back(event);
+
+  buffer.busy.store(false, std::memory_order_release);
+}
+
+} // end namespace impl
+
+void startTracing(const std::size_t reserved_events)
+{
+  TraceRegistry::instance().start(reserved_events);
+}
+
+void stopTracing()
+{
+  TraceRegistry::instance().stop();
+}
+
+void clearTrace()
+{
+  TracePause pause;
+  TraceRegistry::instance().visitBuffers([] (TraceBuffer& buffer) { buffer.events.clear(); });
+}
+
+void setTraceThreadName(const std::string& name)
+{
+  TraceRegistry::instance().setThreadName(name);
+}
+
+std::size_t numOfTraceEvents()
+{
+  TracePause pause;
+  std::size_t count = 0;
+
+  TraceRegistry::instance().visitBuffers([&] (const TraceBuffer& buffer) { count += buffer.events.size(); });
+
+  return count;
+}
+
+bool writeChromeTrace(std::ostream& os)
+{
+  TracePause pause;
+  const int process_id = static_cast<int>(::getpid());
+  bool first = true;
+
+  os << "{\"traceEvents\":[";
+
+  TraceRegistry::instance().visitBuffers([&] (const TraceBuffer& buffer) {
+    if (!buffer.thread_name.empty()) {
+      os << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << process_id
+         << ",\"tid\":" << buffer.thread_id << ",\"args\":{\"name\":";
+      writeJsonString(os, buffer.thread_name.c_str());
+      os << "}}";
+      first = false;
+    }
+    for (const auto& event : buffer.events) {
+      os << (first ? "\n" : ",\n");
+      writeEvent(os, event, process_id, buffer.thread_id);
+      first = false;
+    }
+  });
+
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+  return static_cast<bool>(os);
+}
+
+bool writeChromeTrace(const std::string& file_name)
+{
+  std::ofstream file(file_name, std::ios::trunc);
+
+  if (!file.is_open()) {
+    LogError() << "writeChromeTrace(): can't open file \"" << file_name << "\".";
+    return false;
+  }
+  if (!writeChromeTrace(file)) {
+    LogError() << "writeChromeTrace(): error while writing file \"" << file_name << "\".";
+    return false;
+  }
+
+  return true;
+}
+
+char const* internTraceName(const std::string& name)
+{
+  return TraceRegistry::instance().intern(name);
+}
+
+void ScopedTrace::addArgument(char const* const name, const double value)
+{
+  if (!_active) {
+    return;
+  }
+
+  for (std::size_t i = 0; i < _event.num_arguments; ++i) {
+    if (std::string_view(_event.arguments[i].name) == name) {
+      _event.arguments[i].value = value;
+      return;
+    }
+  }
+  if (_event.num_arguments < impl::MAX_TRACE_ARGUMENTS) {
+    _event.arguments[_event.num_arguments++] = { name, value };
+  }
+}
+
+void ScopedTrace::addArgumentToCurrent(char const* const name, const double value)
+{
+  if (currentScope() != nullptr)
+    currentScope()->addArgument(name, value);
+}
+
+void ScopedTrace::begin(char const* const name)
+{
+  _event.name = name;
+  _event.num_arguments = 0;
+  _active = true;
+  _parent = currentScope();
+  currentScope() = this;
+  _event.begin = impl::traceTimeStamp();
+}
+
+void ScopedTrace::end()
+{
+  _event.end = impl::traceTimeStamp();
+  currentScope() = _parent;
+  impl::recordTraceEvent(_event);
+}
+
+} // end namespace base
+
+} // end namespace francor
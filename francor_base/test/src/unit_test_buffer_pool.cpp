@@ -0,0 +1,143 @@
+/**
+ * Unit test for the classes BufferPool and BufferHandle.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_base/buffer_pool.h"
+
+#include <thread>
+
+using BufferPool = francor::base::BufferPool<std::vector<int>>;
+using BufferHandle = francor::base::BufferHandle<std::vector<int>>;
+
+TEST(BufferPool, AcquireBuffer)
+{
+  BufferPool pool;
+
+  EXPECT_EQ(0u, pool.size());
+
+  BufferHandle buffer = pool.acquire();
+
+  ASSERT_TRUE(buffer.isValid());
+  EXPECT_EQ(1u, buffer.useCount());
+  EXPECT_EQ(1u, pool.size());
+  EXPECT_EQ(0u, pool.numOfAvailable());
+
+  // default constructed handle references no buffer
+  BufferHandle empty;
+
+  EXPECT_FALSE(empty.isValid());
+  EXPECT_EQ(0u, empty.useCount());
+  EXPECT_THROW(empty.get(), std::runtime_error);
+}
+
+TEST(BufferPool, ReuseReleasedBuffer)
+{
+  constexpr std::size_t size = 100;
+  BufferPool pool;
+  int const* address = nullptr;
+
+  {
+    BufferHandle buffer = pool.acquire();
+    buffer->resize(size, 1);
+    address = buffer->data();
+  }
+
+  // buffer went back to pool and its memory is kept
+  EXPECT_EQ(1u, pool.numOfAvailable());
+
+  BufferHandle buffer = pool.acquire();
+
+  EXPECT_EQ(1u, pool.size());
+  EXPECT_EQ(size, buffer->size());
+  EXPECT_EQ(address, buffer->data());
+}
+
+TEST(BufferPool, SharedBuffer)
+{
+  BufferPool pool;
+  BufferHandle buffer = pool.acquire();
+  buffer->push_back(47);
+
+  // copies share the buffer
+  BufferHandle shared(buffer);
+
+  EXPECT_EQ(2u, buffer.useCount());
+  EXPECT_EQ(&buffer.get(), &shared.get());
+
+  // buffer must not be returned while a handle references it
+  buffer.reset();
+
+  EXPECT_FALSE(buffer.isValid());
+  EXPECT_EQ(0u, pool.numOfAvailable());
+  EXPECT_EQ(1u, shared.useCount());
+  EXPECT_EQ(47, shared->front());
+
+  // a busy buffer forces the pool to allocate a new one
+  BufferHandle other = pool.acquire();
+
+  EXPECT_EQ(2u, pool.size());
+  EXPECT_NE(&other.get(), &shared.get());
+
+  // moving takes over the reference
+  BufferHandle moved(std::move(shared));
+
+  EXPECT_FALSE(shared.isValid());
+  EXPECT_EQ(1u, moved.useCount());
+
+  moved.reset();
+  EXPECT_EQ(1u, pool.numOfAvailable());
+}
+
+TEST(BufferPool, OutlivePool)
+{
+  BufferHandle buffer;
+
+  {
+    BufferPool pool(2u);
+
+    EXPECT_EQ(2u, pool.size());
+    EXPECT_EQ(2u, pool.numOfAvailable());
+
+    buffer = pool.acquire();
+  }
+
+  // pool is destroyed, but buffer must still be accessible
+  ASSERT_TRUE(buffer.isValid());
+  buffer->push_back(1);
+  EXPECT_EQ(1u, buffer->size());
+}
+
+TEST(BufferPool, ReleaseFromMultipleThreads)
+{
+  constexpr std::size_t num_threads = 4;
+  constexpr std::size_t num_iterations = 1000;
+  BufferPool pool;
+
+  for (std::size_t i = 0; i < num_iterations; ++i) {
+    BufferHandle buffer = pool.acquire();
+    std::vector<std::thread> consumers;
+
+    for (std::size_t t = 0; t < num_threads; ++t) {
+      consumers.emplace_back([copy = buffer] () mutable { copy.reset(); });
+    }
+
+    buffer.reset();
+
+    for (auto& consumer : consumers) {
+      consumer.join();
+    }
+  }
+
+  // every buffer must be returned to pool
+  EXPECT_EQ(pool.size(), pool.numOfAvailable());
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,103 @@
+/**
+ * Unit test for the classes FrameArena and FrameArenaScope.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_base/frame_arena.h"
+
+#include <cstdint>
+#include <thread>
+
+using francor::base::FrameArena;
+using francor::base::FrameArenaScope;
+
+TEST(FrameArena, AllocateAligned)
+{
+  FrameArena arena(1024);
+  std::uintptr_t last_end = 0;
+
+  for (const std::size_t alignment : { 1u, 8u, 4u, 32u, 2u, 64u }) {
+    const std::size_t size = 3 * alignment + 1;
+    const std::uintptr_t memory = reinterpret_cast<std::uintptr_t>(arena.allocate(size, alignment));
+
+    EXPECT_EQ(0u, memory % alignment);
+    EXPECT_LE(last_end, memory);
+    last_end = memory + size;
+  }
+
+  EXPECT_EQ(1u, arena.numOfBlocks());
+}
+
+TEST(FrameArena, RewindReusesMemory)
+{
+  FrameArena arena(1024);
+  void* const first = arena.allocate(100);
+  const auto marker = arena.marker();
+  void* const second = arena.allocate(200);
+
+  arena.rewind(marker);
+  EXPECT_EQ(second, arena.allocate(200));
+
+  arena.reset();
+  EXPECT_EQ(first, arena.allocate(100));
+}
+
+TEST(FrameArena, GrowAndMergeBlocksOnReset)
+{
+  FrameArena arena(64);
+
+  for (std::size_t i = 0; i < 20; ++i) {
+    ASSERT_NE(nullptr, arena.allocate(48));
+  }
+
+  EXPECT_LT(1u, arena.numOfBlocks());
+  const std::size_t capacity = arena.capacity();
+
+  arena.reset();
+  EXPECT_EQ(1u, arena.numOfBlocks());
+  EXPECT_EQ(capacity, arena.capacity());
+
+  // the next frame with the same allocations fits into the merged block
+  for (std::size_t i = 0; i < 20; ++i) {
+    ASSERT_NE(nullptr, arena.allocate(48));
+  }
+
+  EXPECT_EQ(1u, arena.numOfBlocks());
+}
+
+TEST(FrameArenaScope, RewindOnScopeEnd)
+{
+  FrameArena arena(1024);
+  void* const before = arena.allocate(16);
+  void* inside = nullptr;
+  {
+    FrameArenaScope frame(arena);
+    std::pmr::vector<int> values(frame.resource(nullptr));
+
+    values.resize(100, 1);
+    inside = values.data();
+    EXPECT_EQ(&arena, frame.resource(nullptr));
+    EXPECT_EQ(std::pmr::new_delete_resource(), frame.resource(std::pmr::new_delete_resource()));
+  }
+
+  // the vector was released, the allocation made before the scope is still valid
+  EXPECT_EQ(inside, arena.allocate(100 * sizeof(int), alignof(int)));
+  EXPECT_NE(before, inside);
+}
+
+TEST(FrameArenaScope, ThreadArena)
+{
+  FrameArena* main_arena = &FrameArena::threadInstance();
+  FrameArena* thread_arena = nullptr;
+
+  std::thread([&] { thread_arena = &FrameArena::threadInstance(); }).join();
+
+  EXPECT_NE(main_arena, thread_arena);
+  {
+    FrameArenaScope frame;
+    EXPECT_EQ(main_arena, &frame.arena());
+  }
+}
@@ -0,0 +1,98 @@
+/**
+ * Unit test for the laser scan class.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_base/laser_scan.h"
+
+#include <cmath>
+#include <thread>
+
+using francor::base::LaserScan;
+using francor::base::BeamTrigonometry;
+using francor::base::Pose2d;
+using francor::base::Angle;
+
+TEST(LaserScan, Construct)
+{
+  const std::vector<double> distances = { 1.0, 2.0, std::nan(""), 4.0 };
+  const LaserScan scan(distances, Pose2d(), -0.3, 0.3, 0.2, 10.0, 0.1, "lidar", 1.5);
+
+  ASSERT_EQ(distances.size(), scan.distances().size());
+  EXPECT_EQ(1.0f, scan.distances()[0]);
+  EXPECT_TRUE(std::isnan(scan.distances()[2]));
+  EXPECT_STREQ("lidar", scan.sensorName());
+  EXPECT_EQ(1.5, scan.timeStamp());
+
+  // distance buffer is adopted without copy
+  LaserScan::Distances buffer = { 1.0f, 2.0f, 3.0f };
+  const float* const data = buffer.data();
+  LaserScan adopted(std::move(buffer), Pose2d(), -0.1, 0.1, 0.1, 10.0);
+
+  EXPECT_EQ(data, adopted.distances().data());
+
+  // and can be released for reuse
+  LaserScan::Distances released = adopted.releaseDistances();
+
+  EXPECT_EQ(data, released.data());
+  EXPECT_TRUE(adopted.distances().empty());
+  EXPECT_TRUE(adopted.pointExpansions().empty());
+}
+
+TEST(LaserScan, PointExpansions)
+{
+  const LaserScan scan(std::vector<double>{ 1.0, 2.0, 10.0 }, Pose2d(), -0.1, 0.1, 0.1, 20.0, 0.01);
+  const auto expansions = scan.pointExpansions();
+
+  ASSERT_EQ(scan.distances().size(), expansions.size());
+
+  for (std::size_t i = 0; i < expansions.size(); ++i) {
+    EXPECT_NEAR(std::sin(0.005) * scan.distances()[i] * 2.0, expansions[i], 1e-6);
+  }
+
+  // copies share the calculated data
+  const LaserScan copy(scan);
+
+  EXPECT_EQ(expansions.data(), copy.pointExpansions().data());
+}
+
+TEST(LaserScan, Trigonometry)
+{
+  const Angle phi_min = Angle::createFromDegree(-90.0);
+  const Angle phi_step = Angle::createFromDegree(1.0);
+  std::vector<double> distances(181, 1.0);
+  const LaserScan scan_a(distances, Pose2d(), phi_min, Angle::createFromDegree(90.0), phi_step, 10.0);
+  const LaserScan scan_b(distances, Pose2d(), phi_min, Angle::createFromDegree(90.0), phi_step, 10.0);
+
+  const auto& trigonometry = scan_a.trigonometry();
+
+  ASSERT_EQ(distances.size(), trigonometry.size());
+  EXPECT_NEAR(0.0, trigonometry.cos()[0], 1e-12);
+  EXPECT_NEAR(-1.0, trigonometry.sin()[0], 1e-12);
+  EXPECT_NEAR(1.0, trigonometry.cos()[90], 1e-12);
+  EXPECT_NEAR(1.0, trigonometry.sin()[180], 1e-12);
+
+  // scans with the same layout share the tables
+  EXPECT_EQ(&trigonometry, &scan_b.trigonometry());
+  EXPECT_NE(&trigonometry, BeamTrigonometry::get(phi_min, phi_step, 10).get());
+}
+
+TEST(LaserScan, ConcurrentLazyAccess)
+{
+  const LaserScan scan(std::vector<double>(1000, 2.0), Pose2d(), -1.0, 1.0, 0.002, 20.0, 0.01);
+  std::vector<std::thread> threads;
+  std::vector<float const*> results(4, nullptr);
+
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    threads.emplace_back([&, i] { results[i] = scan.pointExpansions().data(); scan.trigonometry(); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto result : results) {
+    EXPECT_EQ(scan.pointExpansions().data(), result);
+  }
+}
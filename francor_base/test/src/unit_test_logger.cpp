@@ -8,6 +8,11 @@
 
 #include "francor_base/log.h"
 
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 using francor::base::LogLevel;
 using francor::base::LogDebug;
 using francor::base::LogInfo;
@@ -28,6 +33,146 @@ TEST(Log, LogOnEachLevel)
   LogFatal() << value;
 }
 
+namespace {
+
+struct Streamable
+{
+  int value;
+};
+
+std::ostream& operator<<(std::ostream& os, const Streamable& streamable)
+{
+  return os << "streamable(" << streamable.value << ")";
+}
+
+std::vector<std::string> splitLines(const std::string& text)
+{
+  std::vector<std::string> lines;
+  std::istringstream is(text);
+  std::string line;
+
+  while (std::getline(is, line))
+    lines.push_back(line);
+
+  return lines;
+}
+
+} // end namespace
+
+TEST(Log, FormatsArguments)
+{
+  std::ostringstream sink;
+  francor::base::setLogSink(sink);
+  francor::base::setLogLevel(LogLevel::DEBUG);
+
+  const std::string text("text");
+  // fatal is never removed at compile time
+  LogFatal() << 23 << " " << -4 << " " << 2.5 << " " << 'c' << " " << true << " " << text << " " << Streamable{ 7 }
+            << " " << 42u << " " << 1.5f;
+
+  francor::base::setLogSink(std::clog);
+  EXPECT_EQ("[FATAL] 23 -4 2.5 c 1 text streamable(7) 42 1.5\n", sink.str());
+}
+
+TEST(Log, FilterByLevel)
+{
+  std::ostringstream sink;
+  francor::base::setLogSink(sink);
+  francor::base::setLogLevel(LogLevel::WARNING);
+
+  int evaluated = 0;
+  auto count = [&] { return ++evaluated; };
+
+  LogInfo() << "filtered";
+  LogWarn() << "written";
+  FRANCOR_LOG(LogDebug) << "filtered " << count();
+  FRANCOR_LOG(LogError) << "written " << count();
+
+  francor::base::setLogSink(std::clog);
+  EXPECT_EQ(1, evaluated);
+  EXPECT_EQ("[WARNING] written\n[ERROR] written 1\n", sink.str());
+  EXPECT_FALSE(LogInfo::isEnabled());
+  EXPECT_TRUE(LogFatal::isEnabled());
+  EXPECT_EQ(FRANCOR_LOG_MIN_LEVEL <= 0, LogDebug::COMPILED);
+}
+
+TEST(Log, AsyncFromMultipleThreads)
+{
+  constexpr std::size_t num_threads = 4;
+  constexpr std::size_t num_messages = 2000;
+  std::ostringstream sink;
+
+  francor::base::setLogSink(sink);
+  francor::base::setLogLevel(LogLevel::DEBUG);
+  francor::base::enableAsyncLogging(1u << 20);
+  ASSERT_TRUE(francor::base::isAsyncLoggingEnabled());
+
+  std::vector<std::thread> threads;
+
+  for (std::size_t t = 0; t < num_threads; ++t) {
+    threads.emplace_back([t] {
+      for (std::size_t i = 0; i < num_messages; ++i)
+        LogFatal() << "thread " << t << " message " << i;
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  francor::base::flushLog();
+  const auto lines = splitLines(sink.str());
+  ASSERT_EQ(num_threads * num_messages, lines.size());
+
+  // messages of one thread keep their order
+  std::vector<std::size_t> next(num_threads, 0);
+
+  for (const auto& line : lines) {
+    std::size_t thread = 0;
+    std::size_t message = 0;
+    ASSERT_EQ(2, std::sscanf(line.c_str(), "[FATAL] thread %zu message %zu", &thread, &message)) << line;
+    ASSERT_LT(thread, num_threads);
+    EXPECT_EQ(next[thread]++, message);
+  }
+
+  francor::base::disableAsyncLogging();
+  EXPECT_FALSE(francor::base::isAsyncLoggingEnabled());
+  francor::base::setLogSink(std::clog);
+}
+
+TEST(Log, AsyncOverflowKeepsOrder)
+{
+  constexpr std::size_t num_messages = 5000;
+  std::ostringstream sink;
+
+  francor::base::setLogSink(sink);
+  francor::base::setLogLevel(LogLevel::DEBUG);
+  // tiny buffers, so the buffer runs full and some messages are too large for it
+  francor::base::enableAsyncLogging(256);
+
+  std::thread producer([] {
+    const std::string padding(200, 'x');
+
+    for (std::size_t i = 0; i < num_messages; ++i) {
+      if (i % 100 == 0)
+        LogFatal() << "message " << i << " " << padding;
+      else
+        LogFatal() << "message " << i;
+    }
+  });
+  producer.join();
+
+  francor::base::disableAsyncLogging();
+  francor::base::setLogSink(std::clog);
+
+  const auto lines = splitLines(sink.str());
+  ASSERT_EQ(num_messages, lines.size());
+
+  for (std::size_t i = 0; i < lines.size(); ++i) {
+    std::size_t message = 0;
+    ASSERT_EQ(1, std::sscanf(lines[i].c_str(), "[FATAL] message %zu", &message)) << lines[i];
+    EXPECT_EQ(i, message);
+  }
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,99 @@
+/**
+ * Unit test for the class MpscQueue.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_base/mpsc_queue.h"
+
+#include <thread>
+#include <vector>
+#include <memory>
+
+using francor::base::MpscQueue;
+
+TEST(MpscQueue, PushAndPop)
+{
+  MpscQueue<int> queue;
+  int value = 0;
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.pop(value));
+
+  // elements are taken in push order
+  for (int i = 0; i < 10; ++i) {
+    queue.push(i);
+  }
+
+  EXPECT_FALSE(queue.empty());
+
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(i, value);
+  }
+
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpscQueue, ReleaseElementsOnDestruction)
+{
+  auto element = std::make_shared<int>(47);
+
+  {
+    MpscQueue<std::shared_ptr<int>> queue;
+    queue.push(element);
+    queue.push(element);
+
+    EXPECT_EQ(3, element.use_count());
+  }
+
+  EXPECT_EQ(1, element.use_count());
+}
+
+TEST(MpscQueue, MultipleProducers)
+{
+  constexpr std::size_t num_producers = 4;
+  constexpr std::size_t num_elements = 10000;
+  MpscQueue<std::size_t> queue;
+  std::vector<std::thread> producers;
+
+  for (std::size_t p = 0; p < num_producers; ++p) {
+    producers.emplace_back([&queue, p] () {
+      for (std::size_t i = 0; i < num_elements; ++i) {
+        queue.push(p * num_elements + i);
+      }
+    });
+  }
+
+  // consume concurrently, elements of each producer must keep their order
+  std::vector<std::size_t> next_expected(num_producers, 0);
+  std::size_t num_received = 0;
+  std::size_t value = 0;
+
+  while (num_received < num_producers * num_elements) {
+    if (!queue.pop(value)) {
+      continue;
+    }
+
+    const std::size_t producer = value / num_elements;
+
+    ASSERT_LT(producer, num_producers);
+    EXPECT_EQ(next_expected[producer], value % num_elements);
+    next_expected[producer] = value % num_elements + 1;
+    ++num_received;
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  EXPECT_TRUE(queue.empty());
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,78 @@
+/**
+ * Unit test for the parallel loop.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_base/parallel.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using francor::base::parallelFor;
+using francor::base::setMaxParallelThreads;
+using francor::base::maxParallelThreads;
+
+TEST(ParallelFor, VisitEachIndexOnce)
+{
+  const std::size_t num_threads = maxParallelThreads();
+  setMaxParallelThreads(4);
+
+  std::vector<int> visits(1003, 0);
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+
+  parallelFor(3, visits.size(), 10, [&] (const std::size_t begin, const std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      ++visits[i];
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    threads.insert(std::this_thread::get_id());
+  });
+
+  for (std::size_t i = 0; i < visits.size(); ++i) {
+    EXPECT_EQ(i < 3 ? 0 : 1, visits[i]);
+  }
+
+  EXPECT_EQ(4u, threads.size());
+  EXPECT_EQ(1u, threads.count(std::this_thread::get_id()));
+  setMaxParallelThreads(num_threads);
+}
+
+TEST(ParallelFor, SmallRangeOnCallingThread)
+{
+  std::atomic<std::size_t> num_calls(0);
+  std::thread::id thread;
+
+  parallelFor(0, 15, 10, [&] (const std::size_t begin, const std::size_t end) {
+    EXPECT_EQ(0u, begin);
+    EXPECT_EQ(15u, end);
+    thread = std::this_thread::get_id();
+    ++num_calls;
+  });
+
+  EXPECT_EQ(1u, num_calls);
+  EXPECT_EQ(std::this_thread::get_id(), thread);
+
+  // empty range
+  parallelFor(5, 5, 1, [&] (const std::size_t, const std::size_t) { ++num_calls; });
+  EXPECT_EQ(1u, num_calls);
+}
+
+TEST(ParallelFor, SingleThread)
+{
+  const std::size_t num_threads = maxParallelThreads();
+  setMaxParallelThreads(0);
+  EXPECT_EQ(1u, maxParallelThreads());
+
+  std::size_t num_calls = 0;
+  parallelFor(0, 1000, 1, [&] (const std::size_t, const std::size_t) { ++num_calls; });
+  EXPECT_EQ(1u, num_calls);
+
+  setMaxParallelThreads(num_threads);
+}
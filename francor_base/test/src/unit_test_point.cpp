@@ -7,8 +7,22 @@
 #include <gtest/gtest.h>
 
 #include "francor_base/point.h"
+#include "francor_base/laser_scan.h"
+#include "francor_base/algorithm/point.h"
+
+#include <cmath>
+#include <limits>
 
 using francor::base::Point2d;
+using francor::base::Point2dVector;
+using francor::base::Point2dSoA;
+using francor::base::Point2f;
+using francor::base::Point2fVector;
+using francor::base::Point2fSoA;
+using francor::base::LaserScan;
+using francor::base::Pose2d;
+using francor::base::Angle;
+using francor::base::algorithm::point::convertLaserScanToPoints;
 
 TEST(Point2d, Instantiate)
 {
@@ -17,6 +31,105 @@ TEST(Point2d, Instantiate)
   // point.x();
 }
 
+TEST(Point2f, ConvertFromPoint2d)
+{
+  const Point2dVector points = { { 1.25, -2.5 }, { 1e-3, 3.0 } };
+  const Point2fVector points_f(points.begin(), points.end());
+
+  ASSERT_EQ(points.size(), points_f.size());
+  EXPECT_EQ(Point2f(1.25f, -2.5f), points_f[0]);
+  EXPECT_FLOAT_EQ(1e-3f, points_f[1].x());
+  EXPECT_EQ(points[0], Point2d(points_f[0]));
+}
+
+TEST(Point2dSoA, Access)
+{
+  Point2dSoA points;
+
+  points.push_back({ 1.0, 2.0 });
+  points.push_back({ 3.0, 4.0 });
+
+  ASSERT_EQ(2u, points.size());
+  EXPECT_EQ(Point2d(3.0, 4.0), points[1]);
+  EXPECT_EQ(1.0, points.x()[0]);
+  EXPECT_EQ(4.0, points.y()[1]);
+
+  points.clear();
+  EXPECT_TRUE(points.empty());
+}
+
+TEST(ConvertLaserScanToPoints, AgainstReference)
+{
+  // odd number of beams so the batch kernel has to handle a tail
+  constexpr std::size_t num_beams = 1081;
+  const Angle phi_min = Angle::createFromDegree(-135.0);
+  const Angle phi_step = Angle::createFromDegree(0.25);
+  std::vector<double> distances(num_beams);
+
+  for (std::size_t i = 0; i < num_beams; ++i) {
+    distances[i] = 1.0 + static_cast<double>(i % 37) * 0.25;
+  }
+
+  distances[0] = std::numeric_limits<double>::quiet_NaN();
+  distances[5] = std::numeric_limits<double>::infinity();
+  distances[6] = std::numeric_limits<double>::quiet_NaN();
+  distances[num_beams - 1] = std::numeric_limits<double>::quiet_NaN();
+
+  const Pose2d sensor_pose({ 0.3, -0.1 }, Angle::createFromDegree(10.0));
+  const Pose2d ego_pose({ 2.0, 5.0 }, Angle::createFromDegree(-30.0));
+  const LaserScan scan(distances, sensor_pose, phi_min, phi_min + phi_step * static_cast<double>(num_beams - 1),
+                       phi_step, 30.0);
+
+  // reference: sensor position is ego position plus scan position, orientations are added
+  Point2dVector expected;
+  const Point2d origin(ego_pose.position() + sensor_pose.position());
+  const double orientation = ego_pose.orientation() + sensor_pose.orientation();
+
+  for (std::size_t i = 0; i < num_beams; ++i) {
+    const double distance = scan.distances()[i];
+
+    if (std::isfinite(distance)) {
+      const double phi = orientation + phi_min + phi_step * static_cast<double>(i);
+      expected.push_back({ origin.x() + distance * std::cos(phi), origin.y() + distance * std::sin(phi) });
+    }
+  }
+
+  Point2dVector points;
+  Point2dSoA points_soa;
+
+  ASSERT_TRUE(convertLaserScanToPoints(scan, ego_pose, points));
+  ASSERT_TRUE(convertLaserScanToPoints(scan, ego_pose, points_soa));
+  ASSERT_EQ(expected.size(), points.size());
+  ASSERT_EQ(expected.size(), points_soa.size());
+
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(expected[i].x(), points[i].x(), 1e-9);
+    EXPECT_NEAR(expected[i].y(), points[i].y(), 1e-9);
+    EXPECT_NEAR(expected[i].x(), points_soa[i].x(), 1e-9);
+    EXPECT_NEAR(expected[i].y(), points_soa[i].y(), 1e-9);
+  }
+
+  // float versions are rounded on store
+  Point2fVector points_f;
+  Point2fSoA points_f_soa;
+
+  ASSERT_TRUE(convertLaserScanToPoints(scan, ego_pose, points_f));
+  ASSERT_TRUE(convertLaserScanToPoints(scan, ego_pose, points_f_soa));
+  ASSERT_EQ(expected.size(), points_f.size());
+  ASSERT_EQ(expected.size(), points_f_soa.size());
+
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_FLOAT_EQ(static_cast<float>(points[i].x()), points_f[i].x());
+    EXPECT_FLOAT_EQ(static_cast<float>(points[i].y()), points_f[i].y());
+    EXPECT_FLOAT_EQ(static_cast<float>(points[i].x()), points_f_soa[i].x());
+    EXPECT_FLOAT_EQ(static_cast<float>(points[i].y()), points_f_soa[i].y());
+  }
+
+  // an empty scan results in no points
+  EXPECT_TRUE(convertLaserScanToPoints(LaserScan(), ego_pose, points));
+  EXPECT_TRUE(points.empty());
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
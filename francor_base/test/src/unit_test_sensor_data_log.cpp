@@ -0,0 +1,414 @@
+/**
+ * Unit test for the binary sensor data log.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_base/sensor_data_log.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <fstream>
+#include <vector>
+
+using francor::base::SensorDataLogWriter;
+using francor::base::SensorDataLogReader;
+using francor::base::SensorDataLogRecordType;
+using francor::base::DistanceEncoding;
+using francor::base::LaserScan;
+using francor::base::EgoMotionSensorData;
+using francor::base::PoseSensorData;
+using francor::base::Pose2d;
+using francor::base::Matrix2d;
+using francor::base::Matrix3d;
+
+namespace {
+
+constexpr char const* const FILE_NAME = "/tmp/francor_unit_test_sensor_data_log.bin";
+
+LaserScan createLaserScan(const double time_stamp)
+{
+  std::vector<double> distances;
+
+  for (std::size_t i = 0; i < 100; ++i) {
+    distances.push_back(i % 10 == 0 ? std::numeric_limits<double>::quiet_NaN() : 0.5 + static_cast<double>(i) * 0.1);
+  }
+
+  return LaserScan(distances, Pose2d({ 0.1, -0.2 }, 0.3), -1.0, 1.0, 2.0 / 99.0, 20.0, 0.01, "lidar", time_stamp);
+}
+
+template <typename Type>
+Type readFromContent(const std::vector<char>& content, const std::size_t offset)
+{
+  Type value;
+  std::memcpy(&value, content.data() + offset, sizeof(value));
+  return value;
+}
+
+template <typename Type>
+void writeToContent(std::vector<char>& content, const std::size_t offset, const Type& value)
+{
+  std::memcpy(content.data() + offset, &value, sizeof(value));
+}
+
+// returns the offset of the first data record in the given chunk
+std::size_t findDataRecord(const std::vector<char>& content, const std::size_t chunk)
+{
+  using namespace francor::base::impl;
+  std::size_t offset = sizeof(FileHeader);
+
+  for (std::size_t i = 0; i < chunk; ++i) {
+    offset += sizeof(ChunkHeader) + readFromContent<ChunkHeader>(content, offset).size;
+  }
+
+  offset += sizeof(ChunkHeader);
+
+  while (readFromContent<RecordHeader>(content, offset).type
+         == static_cast<std::uint16_t>(SensorDataLogRecordType::SENSOR_NAME)) {
+    offset += sizeof(RecordHeader) + readFromContent<RecordHeader>(content, offset).size;
+  }
+
+  return offset;
+}
+
+std::vector<char> readFile(const char* file_name)
+{
+  std::ifstream input(file_name, std::ios::binary);
+  return { std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>() };
+}
+
+void writeFile(const char* file_name, const std::vector<char>& content)
+{
+  std::ofstream(file_name, std::ios::binary | std::ios::trunc).write(content.data(), content.size());
+}
+
+} // end namespace
+
+TEST(SensorDataLog, HalfConversion)
+{
+  using francor::base::impl::convertToHalf;
+  using francor::base::impl::convertFromHalf;
+
+  for (const float value : { 0.0f, 1.0f, -2.5f, 0.125f, 1024.0f, 65504.0f, 6.103515625e-05f, 5.9604645e-08f }) {
+    EXPECT_EQ(value, convertFromHalf(convertToHalf(value)));
+  }
+
+  EXPECT_TRUE(std::isnan(convertFromHalf(convertToHalf(std::numeric_limits<float>::quiet_NaN()))));
+  EXPECT_TRUE(std::isinf(convertFromHalf(convertToHalf(std::numeric_limits<float>::infinity()))));
+  EXPECT_TRUE(std::isinf(convertFromHalf(convertToHalf(1e6f))));
+  EXPECT_NEAR(12.345f, convertFromHalf(convertToHalf(12.345f)), 12.345f / 2048.0f);
+}
+
+TEST(SensorDataLog, WriteAndRead)
+{
+  const LaserScan scan = createLaserScan(1.0);
+  Matrix2d ego_covariances;
+  ego_covariances << 0.1, 0.2, 0.3, 0.4;
+  const EgoMotionSensorData ego_motion(1.5, 2.0, 0.25, ego_covariances, "odometry");
+  const PoseSensorData pose_data(2.0, Pose2d({ 3.0, 4.0 }, -0.5), Matrix3d::Identity() * 0.5, "gnss");
+  {
+    SensorDataLogWriter writer;
+    SensorDataLogWriter::Parameter parameter;
+    parameter.distance_encoding = DistanceEncoding::FLOAT64;
+
+    ASSERT_TRUE(writer.open(FILE_NAME, parameter));
+    EXPECT_TRUE(writer.write(scan));
+    EXPECT_TRUE(writer.write(ego_motion));
+    EXPECT_TRUE(writer.write(pose_data));
+    EXPECT_TRUE(writer.write(Pose2d({ 5.0, 6.0 }, 1.0), 2.5, "reference"));
+    EXPECT_TRUE(writer.close());
+  }
+
+  ASSERT_TRUE(SensorDataLogReader::isSensorDataLog(FILE_NAME));
+
+  SensorDataLogReader reader;
+  ASSERT_TRUE(reader.open(FILE_NAME));
+  EXPECT_EQ(1u, reader.numOfChunks());
+  EXPECT_EQ(4u, reader.numOfRecords());
+
+  auto it = reader.begin();
+  ASSERT_NE(reader.end(), it);
+  ASSERT_EQ(SensorDataLogRecordType::LASER_SCAN, (*it).type());
+  EXPECT_EQ(1.0, (*it).timeStamp());
+  EXPECT_STREQ("lidar", (*it).sensorName());
+  {
+    const auto view = (*it).laserScan();
+    EXPECT_EQ(scan.pose().position(), view.pose().position());
+    EXPECT_EQ(scan.pose().orientation(), view.pose().orientation());
+    EXPECT_EQ(scan.phiMin(), view.phiMin());
+    EXPECT_EQ(scan.phiMax(), view.phiMax());
+    EXPECT_EQ(scan.phiStep(), view.phiStep());
+    EXPECT_EQ(scan.range(), view.range());
+    EXPECT_EQ(scan.divergence(), view.divergence());
+    ASSERT_EQ(scan.distances().size(), view.numOfDistances());
+
+    std::vector<double> distances;
+    view.copyDistances(distances);
+
+    for (std::size_t i = 0; i < distances.size(); ++i) {
+      if (std::isnan(scan.distances()[i])) {
+        EXPECT_TRUE(std::isnan(distances[i]));
+        EXPECT_TRUE(std::isnan(view.distance(i)));
+      }
+      else {
+        EXPECT_EQ(scan.distances()[i], distances[i]);
+        EXPECT_EQ(scan.distances()[i], view.distance(i));
+      }
+    }
+  }
+
+  ++it;
+  ASSERT_EQ(SensorDataLogRecordType::EGO_MOTION, (*it).type());
+  EXPECT_STREQ("odometry", (*it).sensorName());
+  EXPECT_EQ(1.5, (*it).egoMotion().timeStamp());
+  EXPECT_EQ(2.0, (*it).egoMotion().velocity());
+  EXPECT_EQ(0.25, (*it).egoMotion().yawRate());
+  EXPECT_EQ(ego_covariances, (*it).egoMotion().covariances());
+
+  ++it;
+  ASSERT_EQ(SensorDataLogRecordType::POSE_SENSOR_DATA, (*it).type());
+  EXPECT_STREQ("gnss", (*it).sensorName());
+  EXPECT_EQ(pose_data.pose().position(), (*it).poseSensorData().pose().position());
+  EXPECT_EQ(pose_data.pose().orientation(), (*it).poseSensorData().pose().orientation());
+  EXPECT_EQ(pose_data.covariances(), (*it).poseSensorData().covariances());
+
+  ++it;
+  ASSERT_EQ(SensorDataLogRecordType::POSE, (*it).type());
+  EXPECT_STREQ("reference", (*it).sensorName());
+  EXPECT_EQ(2.5, (*it).timeStamp());
+  EXPECT_EQ(Pose2d({ 5.0, 6.0 }, 1.0).position(), (*it).pose().position());
+
+  const auto data = (*it).createSensorData();
+  ASSERT_NE(nullptr, std::dynamic_pointer_cast<PoseSensorData>(data));
+
+  ++it;
+  EXPECT_EQ(reader.end(), it);
+}
+
+TEST(SensorDataLog, DistanceEncodings)
+{
+  const LaserScan scan = createLaserScan(0.0);
+  const std::vector<std::pair<DistanceEncoding, double>> encodings = {
+    { DistanceEncoding::FLOAT32, 1e-6 },
+    { DistanceEncoding::FLOAT16, 10.5 / 2048.0 },
+    { DistanceEncoding::QUANTIZED16, 0.0005 },
+  };
+
+  for (const auto& encoding : encodings) {
+    {
+      SensorDataLogWriter writer;
+      SensorDataLogWriter::Parameter parameter;
+      parameter.distance_encoding = encoding.first;
+      parameter.quantization_resolution = 0.001;
+
+      ASSERT_TRUE(writer.open(FILE_NAME, parameter));
+      ASSERT_TRUE(writer.write(scan));
+    }
+
+    SensorDataLogReader reader;
+    ASSERT_TRUE(reader.open(FILE_NAME));
+    ASSERT_EQ(1u, reader.numOfRecords());
+
+    const auto view = (*reader.begin()).laserScan();
+    EXPECT_EQ(encoding.first, view.encoding());
+
+    const auto loaded_scan = (*reader.begin()).laserScan().createLaserScan("lidar", 0.0);
+    ASSERT_EQ(scan.distances().size(), loaded_scan->distances().size());
+
+    for (std::size_t i = 0; i < scan.distances().size(); ++i) {
+      if (std::isnan(scan.distances()[i])) {
+        EXPECT_TRUE(std::isnan(loaded_scan->distances()[i]));
+      }
+      else {
+        EXPECT_NEAR(scan.distances()[i], loaded_scan->distances()[i], encoding.second);
+      }
+    }
+  }
+
+  // quantized distances out of range are invalid
+  {
+    SensorDataLogWriter writer;
+    SensorDataLogWriter::Parameter parameter;
+    parameter.distance_encoding = DistanceEncoding::QUANTIZED16;
+    parameter.quantization_resolution = 0.001;
+
+    ASSERT_TRUE(writer.open(FILE_NAME, parameter));
+    ASSERT_TRUE(writer.write(LaserScan(std::vector<double>{ 65.0, 70.0, -1.0 }, Pose2d(), -0.1, 0.1, 0.1, 80.0)));
+  }
+
+  SensorDataLogReader reader;
+  ASSERT_TRUE(reader.open(FILE_NAME));
+
+  const auto view = (*reader.begin()).laserScan();
+  EXPECT_NEAR(65.0, view.distance(0), 0.0005);
+  EXPECT_TRUE(std::isnan(view.distance(1)));
+  EXPECT_TRUE(std::isnan(view.distance(2)));
+}
+
+TEST(SensorDataLog, ChunksAndLowerBound)
+{
+  constexpr std::size_t num_scans = 50;
+  {
+    SensorDataLogWriter writer;
+    SensorDataLogWriter::Parameter parameter;
+    parameter.distance_encoding = DistanceEncoding::FLOAT16;
+    parameter.chunk_size = 1000;
+
+    ASSERT_TRUE(writer.open(FILE_NAME, parameter));
+
+    for (std::size_t i = 0; i < num_scans; ++i) {
+      ASSERT_TRUE(writer.write(createLaserScan(static_cast<double>(i) * 0.1)));
+    }
+  }
+
+  SensorDataLogReader reader;
+  ASSERT_TRUE(reader.open(FILE_NAME));
+  EXPECT_LT(1u, reader.numOfChunks());
+  EXPECT_EQ(num_scans, reader.numOfRecords());
+
+  std::size_t count = 0;
+  std::vector<double> distances;
+
+  for (const auto record : reader) {
+    EXPECT_STREQ("lidar", record.sensorName());
+    EXPECT_NEAR(static_cast<double>(count) * 0.1, record.timeStamp(), 1e-9);
+    record.laserScan().copyDistances(distances);
+    EXPECT_EQ(100u, distances.size());
+    ++count;
+  }
+
+  EXPECT_EQ(num_scans, count);
+
+  auto it = reader.lowerBound(2.05);
+  ASSERT_NE(reader.end(), it);
+  EXPECT_NEAR(2.1, (*it).timeStamp(), 1e-9);
+  EXPECT_STREQ("lidar", (*it).sensorName());
+  EXPECT_EQ(reader.end(), reader.lowerBound(100.0));
+  EXPECT_EQ(reader.begin(), reader.lowerBound(-1.0));
+}
+
+TEST(SensorDataLog, IncompleteChunk)
+{
+  {
+    SensorDataLogWriter writer;
+    SensorDataLogWriter::Parameter parameter;
+    parameter.chunk_size = 1;
+
+    ASSERT_TRUE(writer.open(FILE_NAME, parameter));
+    ASSERT_TRUE(writer.write(createLaserScan(0.0)));
+    ASSERT_TRUE(writer.write(createLaserScan(1.0)));
+  }
+
+  // cut the last chunk like a crash during recording would do
+  std::ifstream input(FILE_NAME, std::ios::binary);
+  std::vector<char> content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+  input.close();
+  content.resize(content.size() - 10);
+  std::ofstream(FILE_NAME, std::ios::binary | std::ios::trunc).write(content.data(), content.size());
+
+  SensorDataLogReader reader;
+  ASSERT_TRUE(reader.open(FILE_NAME));
+  EXPECT_EQ(1u, reader.numOfChunks());
+  EXPECT_EQ(1u, reader.numOfRecords());
+
+  // not a sensor data log
+  std::ofstream(FILE_NAME, std::ios::trunc) << "laser_scan lidar 0.0 and some more text";
+  EXPECT_FALSE(SensorDataLogReader::isSensorDataLog(FILE_NAME));
+  EXPECT_FALSE(reader.open(FILE_NAME));
+  EXPECT_FALSE(reader.isOpen());
+}
+
+TEST(SensorDataLog, CorruptedRecord)
+{
+  using francor::base::impl::FileHeader;
+  using francor::base::impl::RecordHeader;
+  using francor::base::impl::LaserScanPayload;
+
+  {
+    SensorDataLogWriter writer;
+    SensorDataLogWriter::Parameter parameter;
+    parameter.chunk_size = 1;
+
+    ASSERT_TRUE(writer.open(FILE_NAME, parameter));
+    ASSERT_TRUE(writer.write(createLaserScan(0.0)));
+    ASSERT_TRUE(writer.write(createLaserScan(1.0)));
+    ASSERT_TRUE(writer.write(createLaserScan(2.0)));
+  }
+
+  const std::vector<char> original = readFile(FILE_NAME);
+  const std::size_t record = findDataRecord(original, 1);
+  const std::size_t payload = record + sizeof(RecordHeader);
+
+  // the second chunk is cut before the corrupted record, the others are still readable
+  const auto expectSecondRecordIgnored = [] {
+    SensorDataLogReader reader;
+    ASSERT_TRUE(reader.open(FILE_NAME));
+    EXPECT_EQ(3u, reader.numOfChunks());
+    EXPECT_EQ(2u, reader.numOfRecords());
+
+    std::vector<double> time_stamps;
+
+    for (const auto record : reader) {
+      ASSERT_EQ(SensorDataLogRecordType::LASER_SCAN, record.type());
+      EXPECT_EQ(100u, record.laserScan().createLaserScan("lidar", record.timeStamp())->distances().size());
+      time_stamps.push_back(record.timeStamp());
+    }
+
+    EXPECT_EQ(std::vector<double>({ 0.0, 2.0 }), time_stamps);
+  };
+
+  // number of distances exceeds the record
+  {
+    std::vector<char> content(original);
+    auto scan = readFromContent<LaserScanPayload>(content, payload);
+    scan.num_distances = std::numeric_limits<std::uint32_t>::max();
+    writeToContent(content, payload, scan);
+    writeFile(FILE_NAME, content);
+
+    expectSecondRecordIgnored();
+  }
+  // unknown distance encoding
+  {
+    std::vector<char> content(original);
+    auto scan = readFromContent<LaserScanPayload>(content, payload);
+    scan.encoding = 0xffu;
+    writeToContent(content, payload, scan);
+    writeFile(FILE_NAME, content);
+
+    expectSecondRecordIgnored();
+  }
+  // record too small for its type
+  {
+    std::vector<char> content(original);
+    auto header = readFromContent<RecordHeader>(content, record);
+    header.size = sizeof(LaserScanPayload) - 8u;
+    writeToContent(content, record, header);
+    writeFile(FILE_NAME, content);
+
+    expectSecondRecordIgnored();
+  }
+  // record larger than its chunk
+  {
+    std::vector<char> content(original);
+    auto header = readFromContent<RecordHeader>(content, record);
+    header.size = std::numeric_limits<std::uint32_t>::max();
+    writeToContent(content, record, header);
+    writeFile(FILE_NAME, content);
+
+    expectSecondRecordIgnored();
+  }
+  // version 0 was never written
+  {
+    std::vector<char> content(original);
+    auto header = readFromContent<FileHeader>(content, 0);
+    header.version = 0;
+    writeToContent(content, 0, header);
+    writeFile(FILE_NAME, content);
+
+    SensorDataLogReader reader;
+    EXPECT_FALSE(reader.open(FILE_NAME));
+  }
+}
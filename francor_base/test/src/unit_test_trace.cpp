@@ -0,0 +1,144 @@
+/**
+ * Unit test for the trace event recording.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_base/trace.h"
+
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using francor::base::ScopedTrace;
+using francor::base::startTracing;
+using francor::base::stopTracing;
+using francor::base::clearTrace;
+using francor::base::numOfTraceEvents;
+using francor::base::writeChromeTrace;
+
+namespace {
+
+std::string writeTrace()
+{
+  std::ostringstream os;
+  EXPECT_TRUE(writeChromeTrace(os));
+  return os.str();
+}
+
+bool contains(const std::string& text, const std::string& pattern)
+{
+  return text.find(pattern) != std::string::npos;
+}
+
+} // end namespace
+
+TEST(Trace, RecordsOnlyIfStarted)
+{
+  stopTracing();
+  clearTrace();
+  {
+    ScopedTrace trace("not recorded");
+  }
+  EXPECT_EQ(0u, numOfTraceEvents());
+
+  startTracing();
+  {
+    ScopedTrace trace("recorded");
+  }
+  stopTracing();
+  EXPECT_EQ(1u, numOfTraceEvents());
+
+  clearTrace();
+  EXPECT_EQ(0u, numOfTraceEvents());
+}
+
+TEST(Trace, NestedScopesWithArguments)
+{
+  clearTrace();
+  startTracing();
+  {
+    ScopedTrace outer("outer", "points", 42u);
+    {
+      ScopedTrace inner(std::string("inner \"stage\""));
+      ScopedTrace::addArgumentToCurrent("rms", 0.5);
+      ScopedTrace::addArgumentToCurrent("rms", 0.25);
+      ScopedTrace::addArgumentToCurrent("invalid", std::numeric_limits<double>::quiet_NaN());
+    }
+    ScopedTrace::addArgumentToCurrent("iterations", 3);
+  }
+  stopTracing();
+
+  ASSERT_EQ(2u, numOfTraceEvents());
+  const std::string trace = writeTrace();
+
+  EXPECT_TRUE(contains(trace, "{\"traceEvents\":["));
+  EXPECT_TRUE(contains(trace, "\"name\":\"outer\""));
+  EXPECT_TRUE(contains(trace, "\"args\":{\"points\":42,\"iterations\":3}"));
+  EXPECT_TRUE(contains(trace, "\"name\":\"inner \\\"stage\\\"\""));
+  EXPECT_TRUE(contains(trace, "\"args\":{\"rms\":0.25,\"invalid\":null}"));
+  EXPECT_TRUE(contains(trace, "\"ph\":\"X\""));
+
+  // no active scope left, the argument is dropped
+  ScopedTrace::addArgumentToCurrent("dropped", 1.0);
+  EXPECT_FALSE(contains(writeTrace(), "dropped"));
+  clearTrace();
+}
+
+TEST(Trace, MultipleThreads)
+{
+  constexpr std::size_t num_threads = 4;
+  constexpr std::size_t num_scopes = 1000;
+  std::vector<std::thread> threads;
+
+  clearTrace();
+  startTracing();
+
+  for (std::size_t t = 0; t < num_threads; ++t) {
+    threads.emplace_back([t] {
+      francor::base::setTraceThreadName("worker " + std::to_string(t));
+
+      for (std::size_t i = 0; i < num_scopes; ++i) {
+        ScopedTrace trace("work", "index", i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  stopTracing();
+  EXPECT_EQ(num_threads * num_scopes, numOfTraceEvents());
+
+  const std::string trace = writeTrace();
+
+  for (std::size_t t = 0; t < num_threads; ++t) {
+    EXPECT_TRUE(contains(trace, "\"args\":{\"name\":\"worker " + std::to_string(t) + "\"}"));
+  }
+
+  clearTrace();
+}
+
+TEST(Trace, Macros)
+{
+  clearTrace();
+  startTracing();
+  {
+    FRANCOR_TRACE_SCOPE("macro", "value", 1);
+    FRANCOR_TRACE_ARGUMENT("other", 2);
+  }
+  stopTracing();
+
+#if defined(FRANCOR_ENABLE_TRACING)
+  EXPECT_EQ(1u, numOfTraceEvents());
+  EXPECT_TRUE(contains(writeTrace(), "\"args\":{\"value\":1,\"other\":2}"));
+#else
+  EXPECT_EQ(0u, numOfTraceEvents());
+#endif
+
+  clearTrace();
+}
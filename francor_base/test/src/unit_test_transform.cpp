@@ -7,8 +7,15 @@
 #include <gtest/gtest.h>
 
 #include "francor_base/transform.h"
+#include "francor_base/algorithm/transform.h"
 
 using francor::base::Transform2d;
+using francor::base::Point2dVector;
+using francor::base::Point2dSoA;
+using francor::base::Transform2f;
+using francor::base::Point2f;
+using francor::base::Point2fVector;
+using francor::base::Point2fSoA;
 using francor::base::Vector2d;
 using francor::base::Point2d;
 using francor::base::Angle;
@@ -61,6 +68,105 @@ TEST(Transform, TransformTransform)
   EXPECT_NEAR(p2_transformed.y(), p_0.y(), 1e-6);
 }
 
+TEST(Transform, TransformPointVector)
+{
+  using francor::base::algorithm::transform::transformPointVector;
+
+  // odd size so the batch kernels have to handle a tail
+  Point2dVector points;
+  Point2dSoA points_soa;
+
+  for (std::size_t i = 0; i < 11; ++i) {
+    points.push_back({ static_cast<double>(i) * 0.7 - 3.0, 5.0 - static_cast<double>(i) * 1.3 });
+    points_soa.push_back(points.back());
+  }
+
+  Point2dVector output;
+  transformPointVector(t_01, points, output);
+  ASSERT_EQ(points.size(), output.size());
+
+  Point2dVector in_place(points);
+  transformPointVector(t_01, in_place);
+  transformPointVector(t_01, points_soa);
+
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const Point2d expected = t_01 * points[i];
+
+    EXPECT_NEAR(expected.x(), output[i].x(), 1e-12);
+    EXPECT_NEAR(expected.y(), output[i].y(), 1e-12);
+    EXPECT_NEAR(expected.x(), in_place[i].x(), 1e-12);
+    EXPECT_NEAR(expected.y(), in_place[i].y(), 1e-12);
+    EXPECT_NEAR(expected.x(), points_soa[i].x(), 1e-12);
+    EXPECT_NEAR(expected.y(), points_soa[i].y(), 1e-12);
+  }
+
+  // empty sets must be handled
+  Point2dVector empty;
+  transformPointVector(t_01, empty);
+  EXPECT_TRUE(empty.empty());
+}
+
+TEST(Transform, TransformAndSumSquaredResiduals)
+{
+  using francor::base::algorithm::transform::transformAndSumSquaredResiduals;
+
+  Point2dVector points;
+  Point2dVector references;
+  double expected_sum = 0.0;
+
+  for (std::size_t i = 0; i < 7; ++i) {
+    points.push_back({ static_cast<double>(i), -static_cast<double>(i) * 0.5 });
+    references.push_back(t_02 * points.back() + Point2d(0.1 * static_cast<double>(i), -0.2));
+    expected_sum += 0.01 * static_cast<double>(i * i) + 0.04;
+  }
+
+  const Point2dVector origin(points);
+
+  EXPECT_NEAR(expected_sum, transformAndSumSquaredResiduals(t_02, points, references), 1e-9);
+
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    EXPECT_NEAR((t_02 * origin[i]).x(), points[i].x(), 1e-12);
+    EXPECT_NEAR((t_02 * origin[i]).y(), points[i].y(), 1e-12);
+  }
+}
+
+TEST(Transform, TransformFloatPointVector)
+{
+  using francor::base::algorithm::transform::transformPointVector;
+  using francor::base::algorithm::transform::transformAndSumSquaredResiduals;
+
+  const Transform2f transform( { t_01.rotation().phi() }, t_01.translation().cast<float>() );
+  Point2fVector points;
+  Point2fSoA points_soa;
+
+  // odd size so the batch kernels have to handle a tail
+  for (std::size_t i = 0; i < 19; ++i) {
+    points.push_back({ static_cast<float>(i) * 0.7f - 3.0f, 5.0f - static_cast<float>(i) * 1.3f });
+    points_soa.push_back(points.back());
+  }
+
+  Point2fVector output;
+  transformPointVector(transform, points, output);
+  transformPointVector(transform, points_soa);
+  ASSERT_EQ(points.size(), output.size());
+
+  Point2fVector moved(points);
+  const double sum = transformAndSumSquaredResiduals(transform, moved, output);
+
+  EXPECT_NEAR(0.0, sum, 1e-9);
+
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const Point2d expected = t_01 * Point2d(points[i]);
+
+    EXPECT_NEAR(expected.x(), output[i].x(), 1e-5);
+    EXPECT_NEAR(expected.y(), output[i].y(), 1e-5);
+    EXPECT_NEAR(expected.x(), points_soa[i].x(), 1e-5);
+    EXPECT_NEAR(expected.y(), points_soa[i].y(), 1e-5);
+    EXPECT_FLOAT_EQ(output[i].x(), moved[i].x());
+    EXPECT_FLOAT_EQ(output[i].y(), moved[i].y());
+  }
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
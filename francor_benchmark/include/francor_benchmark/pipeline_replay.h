@@ -0,0 +1,159 @@
+/**
+ * Replays recorded sensor logs at maximum speed through processing pipelines and measures the performance.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include "francor_benchmark/sensor_log.h"
+
+#include <vector>
+#include <chrono>
+#include <ostream>
+#include <type_traits>
+
+namespace francor {
+
+namespace benchmark {
+
+/**
+ * \brief Performance measured during a replay. All times are in seconds.
+ */
+struct ReplayStatistics
+{
+  std::size_t num_frames = 0;        //> number of processed records
+  std::size_t num_failed = 0;        //> number of records the processing failed
+  std::size_t num_skipped = 0;       //> number of records that didn't run a pipeline, e.g. pose updates
+  double duration        = 0.0;      //> wall time of the complete replay
+  double throughput      = 0.0;      //> processed frames per second
+  double latency_mean    = 0.0;
+  double latency_p50     = 0.0;
+  double latency_p90     = 0.0;
+  double latency_p99     = 0.0;
+  double latency_max     = 0.0;
+  std::size_t peak_rss   = 0;        //> peak resident set size of this process in byte
+};
+
+/**
+ * \brief Calculates statistics from the latencies of single frames.
+ * \param latencies Processing time of each frame. Will be sorted.
+ * \param duration Wall time of the complete replay.
+ * \param num_failed Number of frames the processing failed.
+ * \return The calculated statistics.
+ */
+ReplayStatistics createReplayStatistics(std::vector<double>& latencies, const double duration,
+                                        const std::size_t num_failed);
+/**
+ * \brief Returns the peak resident set size of this process.
+ * \return Peak resident set size in byte. Zero if not available.
+ */
+std::size_t peakResidentSetSize();
+
+/**
+ * \brief Result of processing a single record during a replay.
+ */
+enum class FrameResult {
+  PROCESSED, //> a frame was processed, its latency is measured
+  FAILED,    //> a frame was processed, but the processing failed
+  SKIPPED    //> the record didn't run a pipeline (e.g. only updated a pose) and isn't counted as frame
+};
+
+/**
+ * \brief Replays all records of a log and calls process_frame for each. The time spent in process_frame is
+ *        measured per frame. Skipped records are neither counted as frame nor is their latency recorded.
+ * \param log The recorded sensor log.
+ * \param process_frame Callable with signature FrameResult(const SensorLog::Record&) or
+ *                      bool(const SensorLog::Record&). A bool result counts each record as frame and false as failed.
+ * \return Measured statistics.
+ */
+template <typename FrameProcessor>
+ReplayStatistics replaySensorLog(const SensorLog& log, FrameProcessor&& process_frame)
+{
+  using Clock = std::chrono::steady_clock;
+
+  std::vector<double> latencies;
+  std::size_t num_failed = 0;
+  std::size_t num_skipped = 0;
+  latencies.reserve(log.size());
+
+  const auto start = Clock::now();
+
+  for (const auto& record : log) {
+    const auto frame_start = Clock::now();
+    FrameResult result;
+
+    if constexpr (std::is_same_v<decltype(process_frame(record)), bool>) {
+      result = process_frame(record) ? FrameResult::PROCESSED : FrameResult::FAILED;
+    }
+    else {
+      result = process_frame(record);
+    }
+
+    const auto frame_end = Clock::now();
+
+    if (result == FrameResult::SKIPPED) {
+      ++num_skipped;
+      continue;
+    }
+    if (result == FrameResult::FAILED) {
+      ++num_failed;
+    }
+
+    latencies.push_back(std::chrono::duration<double>(frame_end - frame_start).count());
+  }
+
+  const double duration = std::chrono::duration<double>(Clock::now() - start).count();
+  ReplayStatistics statistics = createReplayStatistics(latencies, duration, num_failed);
+  statistics.num_skipped = num_skipped;
+
+  return statistics;
+}
+
+/**
+ * \brief Replays all records of a log through a processing pipeline. Each record is assigned to the given pipeline
+ *        input that must be of type std::shared_ptr<base::SensorData>.
+ * \param log The recorded sensor log.
+ * \param pipeline An initialized processing pipeline.
+ * \param model The data structure the pipeline is processing.
+ * \param input_index Index of the pipeline input the records are assigned to.
+ * \return Measured statistics.
+ */
+template <typename Pipeline, typename DataStructureType>
+ReplayStatistics replaySensorLog(const SensorLog& log, Pipeline& pipeline, DataStructureType& model,
+                                 const std::size_t input_index = 0)
+{
+  SensorLog::Record current;
+
+  return replaySensorLog(log, [&] (const SensorLog::Record& record) {
+    current = record;
+    pipeline.input(input_index).assign(&current);
+    return pipeline.process(model);
+  });
+}
+
+} // end namespace benchmark
+
+} // end namespace francor
+
+
+namespace std {
+
+inline ostream& operator<<(ostream& os, const francor::benchmark::ReplayStatistics& statistics)
+{
+  os << "### replay statistics ###" << std::endl;
+  os << "frames       : " << statistics.num_frames << " (failed: " << statistics.num_failed
+     << ", skipped records: " << statistics.num_skipped << ")" << std::endl;
+  os << "duration     : " << statistics.duration << " s" << std::endl;
+  os << "throughput   : " << statistics.throughput << " frames/s" << std::endl;
+  os << "latency mean : " << statistics.latency_mean * 1e6 << " us" << std::endl;
+  os << "latency p50  : " << statistics.latency_p50 * 1e6 << " us" << std::endl;
+  os << "latency p90  : " << statistics.latency_p90 * 1e6 << " us" << std::endl;
+  os << "latency p99  : " << statistics.latency_p99 * 1e6 << " us" << std::endl;
+  os << "latency max  : " << statistics.latency_max * 1e6 << " us" << std::endl;
+  os << "peak rss     : " << statistics.peak_rss / (1024.0 * 1024.0) << " MiB";
+
+  return os;
+}
+
+} // end namespace std
@@ -0,0 +1,92 @@
+/**
+ * Recorded sensor data that can be replayed through processing pipelines.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include <francor_base/sensor_data.h>
+
+#include <memory>
+#include <vector>
+#include <set>
+#include <string>
+
+namespace francor {
+
+namespace benchmark {
+
+/**
+ * \brief A time ordered sequence of sensor data. Supported are laser scans and ego motion data. The log is stored as
+ *        text, one record per line:
+ *
+ *          laser_scan <sensor> <time> <x> <y> <phi> <phi min> <phi max> <phi step> <range> <divergence> <n> <d_0> .. <d_n-1>
+ *          ego_motion <sensor> <time> <velocity> <yaw rate> <c00> <c01> <c10> <c11>
+ *
+ *        Lines starting with '#' are ignored. The sensor data references the sensor names stored in this class, so
+ *        the log must outlive all records taken from it.
+ */
+class SensorLog
+{
+public:
+  using Record = std::shared_ptr<base::SensorData>;
+  using const_iterator = std::vector<Record>::const_iterator;
+
+  SensorLog() = default;
+  SensorLog(const SensorLog&) = delete;
+  SensorLog(SensorLog&&) = default;
+
+  SensorLog& operator=(const SensorLog&) = delete;
+  SensorLog& operator=(SensorLog&&) = default;
+
+  /**
+   * \brief Loads a log from a text file or a binary sensor data log (see francor_base/sensor_data_log.h). Current
+   *        content is replaced. Records of the binary log that are no laser scan or ego motion data are skipped.
+   * \param file_name Path to the log file.
+   * \return true if the complete file could be parsed. On a malformed line the log is left empty.
+   */
+  bool load(const std::string& file_name);
+  /**
+   * \brief Saves this log as text file.
+   * \param file_name Path to the log file.
+   * \return true if the file was written successfully.
+   */
+  bool save(const std::string& file_name) const;
+  /**
+   * \brief Appends a laser scan or ego motion record. Records are expected in time stamp order.
+   * \param record Sensor data to append.
+   * \return false if the record type isn't supported.
+   */
+  bool add(const Record& record);
+  /**
+   * \brief Removes all records.
+   */
+  void clear();
+
+  inline std::size_t size() const noexcept { return _records.size(); }
+  inline bool empty() const noexcept { return _records.empty(); }
+  inline const Record& operator[](const std::size_t index) const { return _records[index]; }
+  inline const_iterator begin() const { return _records.begin(); }
+  inline const_iterator end() const { return _records.end(); }
+
+  /**
+   * \brief Creates a log of a lidar with 40 Hz and an odometry with 100 Hz driving a circle. Useful to replay if no
+   *        recording is available.
+   * \param duration Recorded time in seconds.
+   * \param num_beams Number of laser beams per scan.
+   * \return The created log.
+   */
+  static SensorLog createSynthetic(const double duration, const std::size_t num_beams = 1080);
+
+private:
+  bool loadSensorDataLog(const std::string& file_name);
+  char const* registerSensorName(const std::string& name);
+
+  std::vector<Record> _records;
+  std::set<std::string> _sensor_names; //> storage of sensor names, referenced by records
+};
+
+} // end namespace benchmark
+
+} // end namespace francor
@@ -0,0 +1,90 @@
+/**
+ * Benchmark of the particle filter scoring kernel. The target is 5000 particles x 100 beams in 10 ms on 4 cores.
+ *
+ * Usage: benchmark-particle-filter [google benchmark options]
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <francor_mapping/occupancy_grid.h>
+#include <francor_mapping/likelihood_field.h>
+#include <francor_mapping/particle_filter.h>
+#include <francor_mapping/algorithm/occupancy_grid.h>
+
+#include <francor_base/laser_scan.h>
+#include <francor_base/parallel.h>
+
+#include <benchmark/benchmark.h>
+
+using francor::mapping::OccupancyGrid;
+using francor::mapping::OccupancyCell;
+using francor::mapping::LikelihoodField;
+using francor::mapping::ParticleFilter;
+using francor::mapping::algorithm::occupancy::reconstructLaserScan;
+using francor::base::LaserScan;
+using francor::base::Pose2d;
+using francor::base::Angle;
+
+namespace {
+
+// 20 m x 20 m room with walls at the border and a few pillars
+OccupancyGrid createRoom()
+{
+  OccupancyGrid room;
+  room.init({ 400u, 400u }, 0.05, OccupancyCell{ 0.0f });
+
+  for (std::size_t i = 0; i < 400; ++i) {
+    room(i, 0).value = room(i, 399).value = room(0, i).value = room(399, i).value = 1.0f;
+  }
+  for (std::size_t x = 50; x < 400; x += 100) {
+    for (std::size_t y = 50; y < 400; y += 100) {
+      for (std::size_t i = 0; i < 10; ++i) {
+        room(x + i, y).value = room(x, y + i).value = 1.0f;
+      }
+    }
+  }
+
+  return room;
+}
+
+// range(0): number of particles, range(1): number of threads
+void BM_ParticleFilterScore(::benchmark::State& state)
+{
+  const OccupancyGrid room(createRoom());
+  LikelihoodField field;
+  field.build(room);
+
+  ParticleFilter::Parameter parameter;
+  parameter.min_particles = parameter.max_particles = static_cast<std::size_t>(state.range(0));
+  ParticleFilter filter(parameter);
+  filter.seed(42);
+  filter.initialize(Pose2d({ 10.0, 10.0 }, 0.3), 1.0, 0.5);
+
+  // 100 beam end points of a scan taken in the room
+  const LaserScan scan(reconstructLaserScan(room, Pose2d({ 10.0, 10.0 }, 0.3), Pose2d(), Angle::createFromDegree(-135.0),
+                                            Angle::createFromDegree(2.7), 100, 30.0, 0.0, 0.0));
+  std::vector<float> points_x;
+  std::vector<float> points_y;
+
+  for (std::size_t beam = 0; beam < scan.distances().size(); ++beam) {
+    points_x.push_back(scan.distances()[beam] * scan.trigonometry().cos()[beam]);
+    points_y.push_back(scan.distances()[beam] * scan.trigonometry().sin()[beam]);
+  }
+
+  const std::size_t max_threads = francor::base::maxParallelThreads();
+  francor::base::setMaxParallelThreads(static_cast<std::size_t>(state.range(1)));
+
+  for (auto _ : state) {
+    filter.score(field, points_x, points_y);
+    ::benchmark::DoNotOptimize(filter.scores().data());
+  }
+
+  francor::base::setMaxParallelThreads(max_threads);
+  state.SetItemsProcessed(state.iterations() * state.range(0) * points_x.size());
+}
+
+} // end namespace
+
+BENCHMARK(BM_ParticleFilterScore)->Args({ 5000, 1 })->Args({ 5000, 4 })->Unit(::benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
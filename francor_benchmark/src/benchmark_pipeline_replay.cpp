@@ -0,0 +1,168 @@
+/**
+ * Benchmark that replays a recorded sensor log at maximum speed through processing pipelines.
+ *
+ * Usage: benchmark-pipeline-replay [--log=<sensor log file>] [google benchmark options]
+ *        Without a log a synthetic one is used.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_benchmark/pipeline_replay.h"
+
+#include <francor_processing/data_processing_pipeline.h>
+#include <francor_algorithm/pipeline_stage_estimate_transform.h>
+
+#include <francor_base/laser_scan.h>
+#include <francor_base/ego_motion_sensor_data.h>
+#include <francor_base/log.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <iostream>
+
+using francor::benchmark::SensorLog;
+using francor::benchmark::ReplayStatistics;
+using francor::benchmark::replaySensorLog;
+using francor::benchmark::FrameResult;
+using francor::processing::ProcessingPipeline;
+using francor::processing::NoDataType;
+using francor::algorithm::StageConvertLaserScanToPoints;
+using francor::algorithm::StageEstimateNormalsFromOrderedPoints;
+using francor::base::SensorData;
+using francor::base::EgoMotionSensorData;
+using francor::base::LaserScan;
+using francor::base::Pose2d;
+using francor::base::Point2d;
+using francor::base::Angle;
+
+namespace {
+
+SensorLog _log;
+
+using PipeConvertScanParent = ProcessingPipeline<NoDataType,
+                                                 StageConvertLaserScanToPoints,
+                                                 StageEstimateNormalsFromOrderedPoints>;
+
+class PipeConvertScan final : public PipeConvertScanParent
+{
+public:
+  enum Inputs {
+    IN_SCAN = 0,
+    IN_EGO_POSE,
+    COUNT_INPUTS
+  };
+  enum Outputs {
+    OUT_NORMALS = 0,
+    COUNT_OUTPUTS
+  };
+
+  PipeConvertScan() : PipeConvertScanParent("benchmark convert scan", COUNT_INPUTS, COUNT_OUTPUTS) { }
+
+private:
+  bool configureStages() final
+  {
+    bool ret = true;
+
+    ret &= std::get<0>(_stages).input(StageConvertLaserScanToPoints::IN_SCAN).connect(this->input(IN_SCAN));
+    ret &= std::get<0>(_stages).input(StageConvertLaserScanToPoints::IN_EGO_POSE).connect(this->input(IN_EGO_POSE));
+    ret &= std::get<1>(_stages).input(StageEstimateNormalsFromOrderedPoints::IN_POINTS)
+                               .connect(std::get<0>(_stages).output(StageConvertLaserScanToPoints::OUT_POINTS));
+    ret &= std::get<1>(_stages).output(StageEstimateNormalsFromOrderedPoints::OUT_NORMALS)
+                               .connect(this->output(OUT_NORMALS));
+
+    return ret;
+  }
+  bool initializePorts() final
+  {
+    this->initializeInputPort<std::shared_ptr<SensorData>>(IN_SCAN, "laser scan");
+    this->initializeInputPort<Pose2d>(IN_EGO_POSE, "ego pose");
+
+    this->initializeOutputPort<std::vector<francor::base::AnglePiToPi>>(OUT_NORMALS, "normals");
+
+    return true;
+  }
+};
+
+void setCounters(::benchmark::State& state, const ReplayStatistics& statistics)
+{
+  state.SetItemsProcessed(state.iterations() * statistics.num_frames);
+  state.counters["failed"]         = static_cast<double>(statistics.num_failed);
+  state.counters["skipped"]        = static_cast<double>(statistics.num_skipped);
+  state.counters["latency_p50_us"] = statistics.latency_p50 * 1e6;
+  state.counters["latency_p90_us"] = statistics.latency_p90 * 1e6;
+  state.counters["latency_p99_us"] = statistics.latency_p99 * 1e6;
+  state.counters["latency_max_us"] = statistics.latency_max * 1e6;
+  state.counters["peak_rss_MiB"]   = static_cast<double>(statistics.peak_rss) / (1024.0 * 1024.0);
+}
+
+// laser scans are converted to points using the ego pose integrated from the ego motion records
+void BM_ReplayConvertLaserScanToPoints(::benchmark::State& state)
+{
+  PipeConvertScan pipeline;
+
+  if (!pipeline.initialize()) {
+    state.SkipWithError("pipeline initialization failed");
+    return;
+  }
+
+  ReplayStatistics statistics;
+
+  for (auto _ : state) {
+    Pose2d ego_pose;
+    double ego_time_stamp = 0.0;
+    std::shared_ptr<SensorData> scan;
+
+    pipeline.input(PipeConvertScan::IN_EGO_POSE).assign(&ego_pose);
+
+    statistics = replaySensorLog(_log, [&] (const SensorLog::Record& record) {
+      if (const auto ego_motion = std::dynamic_pointer_cast<EgoMotionSensorData>(record)) {
+        const double dt = ego_motion->timeStamp() - ego_time_stamp;
+        const Angle orientation = ego_pose.orientation() + ego_motion->yawRate() * dt;
+        const double distance = ego_motion->velocity() * dt;
+
+        ego_pose = Pose2d(ego_pose.position() + Point2d(distance * std::cos(orientation),
+                                                        distance * std::sin(orientation)), orientation);
+        ego_time_stamp = ego_motion->timeStamp();
+        pipeline.input(PipeConvertScan::IN_EGO_POSE).assign(&ego_pose);
+
+        // only a pose update, it must not dilute the scan latencies
+        return FrameResult::SKIPPED;
+      }
+
+      scan = record;
+      pipeline.input(PipeConvertScan::IN_SCAN).assign(&scan);
+      return pipeline.process() ? FrameResult::PROCESSED : FrameResult::FAILED;
+    });
+  }
+
+  setCounters(state, statistics);
+}
+
+} // end namespace
+
+BENCHMARK(BM_ReplayConvertLaserScanToPoints)->Unit(::benchmark::kMillisecond);
+
+int main(int argc, char** argv)
+{
+  constexpr char const* const log_option = "--log=";
+
+  for (int i = 1; i < argc; ++i) {
+    if (std::strncmp(argv[i], log_option, std::strlen(log_option)) == 0) {
+      if (!_log.load(argv[i] + std::strlen(log_option))) {
+        return 1;
+      }
+    }
+  }
+  if (_log.empty()) {
+    std::cout << "no sensor log is given, use synthetic one" << std::endl;
+    _log = SensorLog::createSynthetic(10.0);
+  }
+
+  std::cout << "replay sensor log with " << _log.size() << " records" << std::endl;
+
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * Replays recorded sensor logs at maximum speed through processing pipelines and measures the performance.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_benchmark/pipeline_replay.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+namespace francor {
+
+namespace benchmark {
+
+namespace {
+
+// nearest rank percentile, latencies must be sorted
+double percentile(const std::vector<double>& latencies, const double p)
+{
+  const auto rank = static_cast<std::size_t>(std::ceil(p / 100.0 * static_cast<double>(latencies.size())));
+  return latencies[std::max<std::size_t>(rank, 1u) - 1u];
+}
+
+} // end namespace
+
+ReplayStatistics createReplayStatistics(std::vector<double>& latencies, const double duration,
+                                        const std::size_t num_failed)
+{
+  ReplayStatistics statistics;
+
+  statistics.num_frames = latencies.size();
+  statistics.num_failed = num_failed;
+  statistics.duration   = duration;
+  statistics.peak_rss   = peakResidentSetSize();
+
+  if (latencies.empty()) {
+    return statistics;
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+
+  statistics.throughput   = duration > 0.0 ? static_cast<double>(latencies.size()) / duration : 0.0;
+  statistics.latency_mean = std::accumulate(latencies.begin(), latencies.end(), 0.0)
+                            / static_cast<double>(latencies.size());
+  statistics.latency_p50  = percentile(latencies, 50.0);
+  statistics.latency_p90  = percentile(latencies, 90.0);
+  statistics.latency_p99  = percentile(latencies, 99.0);
+  statistics.latency_max  = latencies.back();
+
+  return statistics;
+}
+
+std::size_t peakResidentSetSize()
+{
+  struct rusage usage;
+
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+
+  // linux reports kilobytes
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024u;
+}
+
+} // end namespace benchmark
+
+} // end namespace francor
@@ -0,0 +1,283 @@
+/**
+ * Recorded sensor data that can be replayed through processing pipelines.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_benchmark/sensor_log.h"
+
+#include <francor_base/laser_scan.h>
+#include <francor_base/ego_motion_sensor_data.h>
+#include <francor_base/log.h>
+#include <francor_base/sensor_data_log.h>
+
+#include <fstream>
+#include <sstream>
+#include <limits>
+#include <cmath>
+#include <cstdlib>
+
+namespace francor {
+
+namespace benchmark {
+
+using francor::base::LogError;
+using francor::base::LaserScan;
+using francor::base::EgoMotionSensorData;
+
+namespace {
+
+constexpr char const* const TAG_LASER_SCAN = "laser_scan";
+constexpr char const* const TAG_EGO_MOTION = "ego_motion";
+
+// wraps a floating point value for reading, unlike operator>> of double it also accepts nan and inf
+struct Real
+{
+  double& value;
+};
+
+std::istream& operator>>(std::istream& stream, Real&& real)
+{
+  std::string token;
+
+  if (stream >> token) {
+    char* end = nullptr;
+    real.value = std::strtod(token.c_str(), &end);
+
+    if (end != token.c_str() + token.size()) {
+      stream.setstate(std::ios::failbit);
+    }
+  }
+
+  return stream;
+}
+
+// true if all values were read and nothing but white spaces is left in the line
+bool isCompletelyParsed(std::istream& stream)
+{
+  if (stream.fail()) {
+    return false;
+  }
+
+  stream >> std::ws;
+  return stream.eof();
+}
+
+} // end namespace
+
+bool SensorLog::load(const std::string& file_name)
+{
+  if (base::SensorDataLogReader::isSensorDataLog(file_name)) {
+    return this->loadSensorDataLog(file_name);
+  }
+
+  std::ifstream file(file_name);
+
+  if (!file.is_open()) {
+    LogError() << "SensorLog: can't open file \"" << file_name << "\".";
+    return false;
+  }
+
+  this->clear();
+  std::string line;
+  std::size_t line_number = 0;
+
+  while (std::getline(file, line)) {
+    ++line_number;
+
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    std::istringstream stream(line);
+    std::string tag, sensor_name;
+    double time_stamp = 0.0;
+
+    stream >> tag >> sensor_name >> Real{ time_stamp };
+
+    if (tag == TAG_LASER_SCAN) {
+      double x, y, phi, phi_min, phi_max, phi_step, range, divergence;
+      std::size_t num_distances = 0;
+
+      stream >> Real{ x } >> Real{ y } >> Real{ phi } >> Real{ phi_min } >> Real{ phi_max } >> Real{ phi_step }
+             >> Real{ range } >> Real{ divergence } >> num_distances;
+
+      // each distance takes at least two characters, a larger count can't be satisfied by this line
+      if (!stream.fail() && num_distances <= line.size() / 2) {
+        std::vector<double> distances(num_distances);
+
+        for (auto& distance : distances) {
+          stream >> Real{ distance };
+        }
+        if (isCompletelyParsed(stream)) {
+          _records.push_back(std::make_shared<LaserScan>(distances, base::Pose2d({ x, y }, phi), phi_min, phi_max,
+                                                         phi_step, range, divergence,
+                                                         this->registerSensorName(sensor_name), time_stamp));
+          continue;
+        }
+      }
+    }
+    else if (tag == TAG_EGO_MOTION) {
+      double velocity, yaw_rate;
+      base::Matrix2d covariances;
+
+      stream >> Real{ velocity } >> Real{ yaw_rate } >> Real{ covariances(0, 0) } >> Real{ covariances(0, 1) }
+             >> Real{ covariances(1, 0) } >> Real{ covariances(1, 1) };
+
+      if (isCompletelyParsed(stream)) {
+        _records.push_back(std::make_shared<EgoMotionSensorData>(time_stamp, velocity, yaw_rate, covariances,
+                                                                 this->registerSensorName(sensor_name)));
+        continue;
+      }
+    }
+
+    LogError() << "SensorLog: can't parse line " << line_number << " of file \"" << file_name << "\".";
+    // don't leave a partially loaded log behind
+    this->clear();
+    return false;
+  }
+
+  return true;
+}
+
+bool SensorLog::loadSensorDataLog(const std::string& file_name)
+{
+  base::SensorDataLogReader reader;
+
+  if (!reader.open(file_name)) {
+    return false;
+  }
+
+  this->clear();
+  _records.reserve(reader.numOfRecords());
+
+  for (const auto record : reader) {
+    const auto type = record.type();
+
+    if (type == base::SensorDataLogRecordType::LASER_SCAN) {
+      _records.push_back(record.laserScan().createLaserScan(this->registerSensorName(record.sensorName()),
+                                                            record.timeStamp()));
+    }
+    else if (type == base::SensorDataLogRecordType::EGO_MOTION) {
+      const auto ego_motion = record.egoMotion();
+
+      _records.push_back(std::make_shared<EgoMotionSensorData>(ego_motion.timeStamp(), ego_motion.velocity(),
+                                                               ego_motion.yawRate(), ego_motion.covariances(),
+                                                               this->registerSensorName(record.sensorName())));
+    }
+  }
+
+  return true;
+}
+
+bool SensorLog::save(const std::string& file_name) const
+{
+  std::ofstream file(file_name);
+
+  if (!file.is_open()) {
+    LogError() << "SensorLog: can't open file \"" << file_name << "\".";
+    return false;
+  }
+
+  file.precision(std::numeric_limits<double>::max_digits10);
+  file << "# francor sensor log" << std::endl;
+
+  for (const auto& record : _records) {
+    if (const auto scan = std::dynamic_pointer_cast<LaserScan>(record)) {
+      file << TAG_LASER_SCAN << " " << scan->sensorName() << " " << scan->timeStamp() << " "
+           << scan->pose().position().x() << " " << scan->pose().position().y() << " "
+           << scan->pose().orientation().radian() << " " << scan->phiMin().radian() << " "
+           << scan->phiMax().radian() << " " << scan->phiStep().radian() << " " << scan->range() << " "
+           << scan->divergence().radian() << " " << scan->distances().size();
+
+      for (const auto distance : scan->distances()) {
+        file << " " << distance;
+      }
+    }
+    else if (const auto ego_motion = std::dynamic_pointer_cast<EgoMotionSensorData>(record)) {
+      const auto& covariances = ego_motion->covariances();
+
+      file << TAG_EGO_MOTION << " " << ego_motion->sensorName() << " " << ego_motion->timeStamp() << " "
+           << ego_motion->velocity() << " " << ego_motion->yawRate() << " "
+           << covariances(0, 0) << " " << covariances(0, 1) << " " << covariances(1, 0) << " " << covariances(1, 1);
+    }
+
+    file << std::endl;
+  }
+
+  return file.good();
+}
+
+bool SensorLog::add(const Record& record)
+{
+  if (nullptr == std::dynamic_pointer_cast<LaserScan>(record)
+      &&
+      nullptr == std::dynamic_pointer_cast<EgoMotionSensorData>(record)) {
+    LogError() << "SensorLog: only laser scan and ego motion records are supported.";
+    return false;
+  }
+
+  _records.push_back(record);
+  return true;
+}
+
+void SensorLog::clear()
+{
+  _records.clear();
+  _sensor_names.clear();
+}
+
+char const* SensorLog::registerSensorName(const std::string& name)
+{
+  return _sensor_names.insert(name).first->c_str();
+}
+
+SensorLog SensorLog::createSynthetic(const double duration, const std::size_t num_beams)
+{
+  constexpr double scan_period     = 1.0 / 40.0;
+  constexpr double odometry_period = 1.0 / 100.0;
+  constexpr double velocity        = 1.0;
+  constexpr double yaw_rate        = 0.2;
+  const base::Angle phi_min  = base::Angle::createFromDegree(-135.0);
+  const base::Angle phi_max  = base::Angle::createFromDegree( 135.0);
+  const base::Angle phi_step = (phi_max - phi_min) / static_cast<double>(num_beams - 1);
+
+  SensorLog log;
+  char const* const lidar    = log.registerSensorName("lidar");
+  char const* const odometry = log.registerSensorName("odometry");
+  std::size_t num_scans = 0;
+  std::size_t num_odometry = 0;
+
+  while (true) {
+    const double time_scan     = static_cast<double>(num_scans) * scan_period;
+    const double time_odometry = static_cast<double>(num_odometry) * odometry_period;
+
+    if (time_scan > duration && time_odometry > duration) {
+      break;
+    }
+    if (time_odometry <= time_scan) {
+      log._records.push_back(std::make_shared<EgoMotionSensorData>(time_odometry, velocity, yaw_rate,
+                                                                   base::Matrix2d::Identity() * 0.01, odometry));
+      ++num_odometry;
+      continue;
+    }
+
+    // a wavy wall in front of the sensor, every 100th beam without reflection
+    std::vector<double> distances(num_beams);
+
+    for (std::size_t i = 0; i < num_beams; ++i) {
+      distances[i] = i % 100 == 0 ? std::numeric_limits<double>::quiet_NaN()
+                                  : 5.0 + 0.5 * std::sin(static_cast<double>(i) * 0.05 + time_scan);
+    }
+
+    log._records.push_back(std::make_shared<LaserScan>(distances, base::Pose2d({ 0.2, 0.0 }, 0.0), phi_min,
+                                                       phi_max, phi_step, 30.0, 0.0, lidar, time_scan));
+    ++num_scans;
+  }
+
+  return log;
+}
+
+} // end namespace benchmark
+
+} // end namespace francor
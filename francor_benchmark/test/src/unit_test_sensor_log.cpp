@@ -0,0 +1,238 @@
+/**
+ * Unit test for the sensor log and the replay statistics.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_benchmark/sensor_log.h"
+#include "francor_benchmark/pipeline_replay.h"
+
+#include <francor_base/laser_scan.h>
+#include <francor_base/ego_motion_sensor_data.h>
+#include <francor_base/sensor_data_log.h>
+
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using francor::benchmark::SensorLog;
+using francor::benchmark::replaySensorLog;
+using francor::benchmark::FrameResult;
+using francor::benchmark::createReplayStatistics;
+using francor::base::LaserScan;
+using francor::base::EgoMotionSensorData;
+using francor::base::SensorData;
+
+TEST(SensorLog, CreateSynthetic)
+{
+  const SensorLog log = SensorLog::createSynthetic(1.0, 100);
+
+  std::size_t num_scans = 0;
+  std::size_t num_ego_motions = 0;
+  double time_stamp = 0.0;
+
+  for (const auto& record : log) {
+    // records must be in time order
+    EXPECT_LE(time_stamp, record->timeStamp());
+    time_stamp = record->timeStamp();
+
+    if (const auto scan = std::dynamic_pointer_cast<LaserScan>(record)) {
+      EXPECT_EQ(100u, scan->distances().size());
+      ++num_scans;
+    }
+    else if (std::dynamic_pointer_cast<EgoMotionSensorData>(record)) {
+      ++num_ego_motions;
+    }
+  }
+
+  EXPECT_EQ(41u, num_scans);
+  EXPECT_EQ(101u, num_ego_motions);
+}
+
+TEST(SensorLog, SaveAndLoad)
+{
+  constexpr char const* const file_name = "/tmp/francor_unit_test_sensor_log.txt";
+  const SensorLog log = SensorLog::createSynthetic(0.1, 10);
+
+  ASSERT_TRUE(log.save(file_name));
+
+  SensorLog loaded;
+
+  ASSERT_TRUE(loaded.load(file_name));
+  ASSERT_EQ(log.size(), loaded.size());
+
+  for (std::size_t i = 0; i < log.size(); ++i) {
+    EXPECT_EQ(log[i]->timeStamp(), loaded[i]->timeStamp());
+    EXPECT_STREQ(log[i]->sensorName(), loaded[i]->sensorName());
+
+    if (const auto scan = std::dynamic_pointer_cast<LaserScan>(log[i])) {
+      const auto loaded_scan = std::dynamic_pointer_cast<LaserScan>(loaded[i]);
+
+      ASSERT_NE(nullptr, loaded_scan);
+      EXPECT_EQ(scan->phiMin(), loaded_scan->phiMin());
+      EXPECT_EQ(scan->phiStep(), loaded_scan->phiStep());
+      EXPECT_EQ(scan->pose().position(), loaded_scan->pose().position());
+      ASSERT_EQ(scan->distances().size(), loaded_scan->distances().size());
+
+      for (std::size_t d = 0; d < scan->distances().size(); ++d) {
+        if (std::isnan(scan->distances()[d])) {
+          EXPECT_TRUE(std::isnan(loaded_scan->distances()[d]));
+        }
+        else {
+          EXPECT_EQ(scan->distances()[d], loaded_scan->distances()[d]);
+        }
+      }
+    }
+    else {
+      const auto ego_motion = std::dynamic_pointer_cast<EgoMotionSensorData>(log[i]);
+      const auto loaded_ego_motion = std::dynamic_pointer_cast<EgoMotionSensorData>(loaded[i]);
+
+      ASSERT_NE(nullptr, loaded_ego_motion);
+      EXPECT_EQ(ego_motion->velocity(), loaded_ego_motion->velocity());
+      EXPECT_EQ(ego_motion->yawRate(), loaded_ego_motion->yawRate());
+      EXPECT_EQ(ego_motion->covariances(), loaded_ego_motion->covariances());
+    }
+  }
+
+  // loading a not existing file must fail
+  EXPECT_FALSE(loaded.load("/tmp/francor_not_existing_sensor_log.txt"));
+}
+
+TEST(SensorLog, RejectMalformedLines)
+{
+  constexpr char const* const file_name = "/tmp/francor_unit_test_sensor_log_malformed.txt";
+  const std::string valid_line = "ego_motion odometry 0.0 1.0 0.2 0.01 0 0 0.01";
+  const std::vector<std::string> malformed_lines = {
+    // distance count way larger than the line
+    "laser_scan lidar 0.1 0 0 0 -1 1 0.5 30 0 18446744073709551615 1.0 2.0",
+    // distance count that wraps around
+    "laser_scan lidar 0.1 0 0 0 -1 1 0.5 30 0 -1 1.0",
+    // fewer distances than announced
+    "laser_scan lidar 0.1 0 0 0 -1 1 0.5 30 0 5 1.0 2.0",
+    // more distances than announced
+    "laser_scan lidar 0.1 0 0 0 -1 1 0.5 30 0 1 1.0 2.0",
+    // truncated ego motion
+    "ego_motion odometry 0.1 1.0 0.2",
+    "unknown_tag sensor 0.1"
+  };
+
+  for (const auto& malformed_line : malformed_lines) {
+    {
+      std::ofstream file(file_name);
+      file << valid_line << std::endl << malformed_line << std::endl;
+    }
+
+    SensorLog loaded;
+
+    EXPECT_FALSE(loaded.load(file_name)) << malformed_line;
+    EXPECT_TRUE(loaded.empty());
+  }
+
+  // a correct scan line is accepted, trailing white spaces are ignored
+  {
+    std::ofstream file(file_name);
+    file << valid_line << std::endl << "laser_scan lidar 0.1 0 0 0 -1 1 1 30 0 3 1.0 2.0 nan  " << std::endl;
+  }
+
+  SensorLog loaded;
+
+  ASSERT_TRUE(loaded.load(file_name));
+  ASSERT_EQ(2u, loaded.size());
+  EXPECT_EQ(3u, std::dynamic_pointer_cast<LaserScan>(loaded[1])->distances().size());
+}
+
+TEST(SensorLog, LoadSensorDataLog)
+{
+  constexpr char const* const file_name = "/tmp/francor_unit_test_sensor_log.bin";
+  const SensorLog log = SensorLog::createSynthetic(0.1, 10);
+  {
+    francor::base::SensorDataLogWriter writer;
+    francor::base::SensorDataLogWriter::Parameter parameter;
+    parameter.distance_encoding = francor::base::DistanceEncoding::FLOAT64;
+
+    ASSERT_TRUE(writer.open(file_name, parameter));
+
+    for (const auto& record : log) {
+      ASSERT_TRUE(writer.write(*record));
+    }
+  }
+
+  SensorLog loaded;
+
+  ASSERT_TRUE(loaded.load(file_name));
+  ASSERT_EQ(log.size(), loaded.size());
+
+  for (std::size_t i = 0; i < log.size(); ++i) {
+    EXPECT_EQ(log[i]->timeStamp(), loaded[i]->timeStamp());
+    EXPECT_STREQ(log[i]->sensorName(), loaded[i]->sensorName());
+    EXPECT_EQ(nullptr != std::dynamic_pointer_cast<LaserScan>(log[i]),
+              nullptr != std::dynamic_pointer_cast<LaserScan>(loaded[i]));
+  }
+}
+
+TEST(ReplayStatistics, Percentiles)
+{
+  std::vector<double> latencies;
+
+  for (int i = 100; i > 0; --i) {
+    latencies.push_back(static_cast<double>(i));
+  }
+
+  const auto statistics = createReplayStatistics(latencies, 10.0, 2);
+
+  EXPECT_EQ(100u, statistics.num_frames);
+  EXPECT_EQ(2u, statistics.num_failed);
+  EXPECT_DOUBLE_EQ(10.0, statistics.throughput);
+  EXPECT_DOUBLE_EQ(50.5, statistics.latency_mean);
+  EXPECT_DOUBLE_EQ(50.0, statistics.latency_p50);
+  EXPECT_DOUBLE_EQ(90.0, statistics.latency_p90);
+  EXPECT_DOUBLE_EQ(99.0, statistics.latency_p99);
+  EXPECT_DOUBLE_EQ(100.0, statistics.latency_max);
+  EXPECT_LT(0u, statistics.peak_rss);
+}
+
+TEST(ReplayStatistics, ReplayLog)
+{
+  const SensorLog log = SensorLog::createSynthetic(0.5, 10);
+  std::size_t num_calls = 0;
+
+  const auto statistics = replaySensorLog(log, [&] (const SensorLog::Record& record) {
+    ++num_calls;
+    return nullptr != std::dynamic_pointer_cast<LaserScan>(record);
+  });
+
+  EXPECT_EQ(log.size(), num_calls);
+  EXPECT_EQ(log.size(), statistics.num_frames);
+  EXPECT_EQ(51u, statistics.num_failed); // ego motion records
+  EXPECT_LE(statistics.latency_p50, statistics.latency_max);
+}
+
+TEST(ReplayStatistics, SkipRecords)
+{
+  const SensorLog log = SensorLog::createSynthetic(0.5, 10);
+  std::size_t num_scans = 0;
+
+  // only laser scans are frames, ego motion records are skipped
+  const auto statistics = replaySensorLog(log, [&] (const SensorLog::Record& record) {
+    if (nullptr == std::dynamic_pointer_cast<LaserScan>(record)) {
+      return FrameResult::SKIPPED;
+    }
+
+    ++num_scans;
+    return FrameResult::PROCESSED;
+  });
+
+  EXPECT_EQ(log.size() - 51u, num_scans);
+  EXPECT_EQ(num_scans, statistics.num_frames);
+  EXPECT_EQ(0u, statistics.num_failed);
+  EXPECT_EQ(51u, statistics.num_skipped);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -6,15 +6,19 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 
 #include <francor_base/point.h>
 #include <francor_base/angle.h>
+#include <francor_base/pose.h>
+#include <francor_base/rect.h>
+
+#include <francor_vision/colour_space.h>
 
 #include "francor_mapping/occupancy_grid.h"
 namespace francor {
 
 namespace base {
-class Pose2d;
 class Angle;
 class LaserScan;
 }
@@ -33,16 +37,32 @@ namespace algorithm {
 namespace occupancy {
 
 /**
- * \brief Converts an occupancy grid to an image. The resulting image is an gray scaled with following colour mapping:
+ * \brief Converts an occupancy grid to an image. A gray scaled image has following colour mapping:
  *          0% ->   0 (black)
  *        100% -> 100 (lite gray)
  *        nan  -> 200 (dark gray)
+ *        A BGR image is a visualization for operators: free cells are white, unknown cells are gray and occupied
+ *        cells go from yellow to dark red with increasing probability. The grid is converted row by row, for gray
+ *        images vectorized.
  * 
  * \param grid The input occupancy grid.
- * \param image The resulting gray scaled image.
+ * \param image The resulting image.
+ * \param space Colour space of the resulting image, GRAY or BGR.
  * \return true if convertion was successful.
  */
-bool convertGridToImage(const OccupancyGrid& grid, vision::Image& image);
+bool convertGridToImage(const OccupancyGrid& grid, vision::Image& image,
+                        const vision::ColourSpace space = vision::ColourSpace::GRAY);
+
+/**
+ * \brief Converts only a region of the grid into an image that was created by convertGridToImage(). Used to update the
+ *        image after the grid was changed locally, e.g. by pushing a laser scan.
+ * 
+ * \param grid The input occupancy grid.
+ * \param region The changed cells. It is clipped to the grid.
+ * \param image Image of the grid. It keeps its colour space.
+ * \return true if the image was updated; false if its size or colour space doesn't match.
+ */
+bool updateImageFromGrid(const OccupancyGrid& grid, const base::Rectu& region, vision::Image& image);
 
 /**
  * \brief Creates an occupancy grid from an image. The image type must be gray sacled. A pixel will represents a
@@ -91,14 +111,38 @@ bool reconstructLaserScanFromGrid(const OccupancyGrid& grid, const base::Pose2d&
                                   const base::Angle phi_min, const base::Angle phi_step, const std::size_t num_beams,
                                   const double range, base::LaserScan& scan, const double time_stamp = 0.0);
 
+/**
+ * \brief Reconstructs the distance of a single laser beam by casting several rays over the beam divergence. The hits
+ *        of the rays are reduced on the fly, so no memory is allocated.
+ *
+ * \return Mean distance of all rays that hit an occupied cell or infinity if no ray hit one.
+ */
 double reconstructLaserBeam(const OccupancyGrid& grid, const base::Point2d& origin, const base::Vector2i& origin_idx,
                             const base::AnglePiToPi phi, const double range, const base::Angle divergence,
                             const double beam_width_max_range);
 
+/**
+ * \brief Reconstructs a laser scan from grid at given pose taking the beam divergence into account. The beams are
+ *        processed in parallel (see base::parallelFor()).
+ */
 base::LaserScan reconstructLaserScan(const OccupancyGrid& grid, const base::Pose2d& pose_ego, const base::Pose2d& pose_sensor,
                                      const base::Angle phi_min, const base::Angle phi_step, const std::size_t num_beams,
                                      const double range, const double time_stamp, const base::Angle divergence);
 
+/**
+ * \brief Reconstructs the laser scans seen from several ego poses at once, e.g. for all particles of a particle
+ *        filter. The beams of all poses are processed in parallel.
+ *
+ * \param poses_ego Poses of the ego object.
+ * \param pose_sensor Pose of the sensor in ego frame.
+ * \param distances Reconstructed distances, one row of num_beams distances per ego pose. Beams without hit are
+ *                  infinity. The capacity is reused, so no allocation happens if it is large enough.
+ */
+void reconstructLaserScans(const OccupancyGrid& grid, const std::vector<base::Pose2d>& poses_ego,
+                           const base::Pose2d& pose_sensor, const base::Angle phi_min, const base::Angle phi_step,
+                           const std::size_t num_beams, const double range, const base::Angle divergence,
+                           std::vector<float>& distances);
+
 /**
  * \brief Updates a occupancy grid cell using formula cell = (value / (1 - value)) * old.value. NOTE: POC!
  * 
@@ -0,0 +1,99 @@
+/**
+ * Projects bit masks of a camera into a grid layer that is aligned to the ego object. The ground position of each pixel
+ * is computed once and stored as pixel to cell lookup table, so a frame is projected in one gather pass over the mask.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include "francor_mapping/occupancy_grid.h"
+
+#include <francor_algorithm/estimate_3d_coordinate.h>
+
+#include <francor_base/point.h>
+#include <francor_base/pose.h>
+#include <francor_base/size.h>
+
+#include <francor_vision/image_view.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace francor {
+
+namespace mapping {
+
+class CameraGridProjection
+{
+public:
+  struct Parameter
+  {
+    Parameter() { }
+
+    float probability_free     = 0.35f; //> probability of a cell that is seen, but no pixel of it is in the mask
+    float probability_occupied = 0.75f; //> probability of a cell whose pixels are all in the mask
+    std::size_t min_pixels     = 1;     //> cells covered by fewer pixels aren't observed
+  };
+
+  CameraGridProjection(const Parameter& parameter = Parameter()) : _parameter(parameter) { }
+
+  /**
+   * \brief Builds the pixel to cell lookup table. The pixels are projected onto the ground plane row by row in batches.
+   *        Each pixel is assigned to the cell hit by the projection of its integer coordinate, which is the center of
+   *        the pixel in the convention of GroundPlaneProjector (and OpenCV).
+   *
+   * \param projector Initialized projector of the camera. Its extrinsic is the pose of the camera in the ego frame.
+   * \param num_cells Number of cells of the layer.
+   * \param cell_size Cell size of the layer in meter.
+   * \param origin Position of the corner of cell (0, 0) in the ego frame.
+   * \return true if the lookup table was successfully built.
+   */
+  bool initialize(const francor::algorithm::GroundPlaneProjector& projector, const base::Size2u& num_cells,
+                  const double cell_size, const base::Point2d& origin);
+  inline bool isInitialized() const noexcept { return !_observed.empty(); }
+
+  /**
+   * \brief Projects a bit mask into the layer. Each observed cell gets a probability between probability_free and
+   *        probability_occupied depending on the share of its pixels that are set in the mask. Cells that aren't seen
+   *        by the camera are NaN.
+   *
+   * \param mask Bit mask of the camera image.
+   * \param layer Resulting layer. It is initialized if its size doesn't match.
+   * \return true if the mask was successfully projected.
+   */
+  bool project(const vision::ConstImageView& mask, OccupancyGrid& layer);
+
+  /**
+   * \brief Fuses an observed layer into a grid using updateGridCell(). Each layer cell updates the grid cell that
+   *        contains its center, so layer and grid must have the same cell size.
+   *
+   * \param layer Layer created by project().
+   * \param pose_ego Pose of the ego object in the grid.
+   * \param grid Grid the layer is fused into.
+   * \return false if the cell sizes of layer and grid differ.
+   */
+  bool pushLayerToGrid(const OccupancyGrid& layer, const base::Pose2d& pose_ego, OccupancyGrid& grid) const;
+
+  inline const base::Point2d& origin() const noexcept { return _origin; }
+
+private:
+  const Parameter _parameter;
+
+  std::size_t _image_cols = 0;
+  std::size_t _image_rows = 0;
+  base::Size2u _num_cells;
+  double _cell_size = 0.0;
+  base::Point2d _origin;
+
+  // pixels that hit the layer, stored row by row: the entries of row r are in [_row_begin[r], _row_begin[r + 1])
+  std::vector<std::uint32_t> _row_begin;
+  std::vector<std::uint32_t> _pixel_col;
+  std::vector<std::uint32_t> _pixel_cell;
+  std::vector<std::uint32_t> _observed; //> number of pixels that hit each cell, doesn't depend on the mask
+  std::vector<std::uint32_t> _hits;     //> number of mask pixels of each cell, reused each frame
+};
+
+} // end namespace mapping
+
+} // end namespace francor
@@ -10,6 +10,8 @@
 
 #include "francor_mapping/kalman_filter_model.h"
 
+#include <array>
+
 namespace francor {
 
 namespace mapping {
@@ -59,6 +61,54 @@ public:
     return true;
   }               
 
+  /**
+   * \brief Predicts to the given time stamp and updates with a measurement of state attributes. The observation
+   *        matrix is the selection of the measured attributes (see ObservationMatrix), so it is applied by picking
+   *        rows and columns instead of multiplying with it. The kalman gain is solved using LDLT instead of
+   *        inverting the innovation covariances and the covariances are updated in Joseph form, so they stay
+   *        symmetric and positive definite. All matrices have fixed size, nothing is allocated.
+   *
+   * \param time_stamp Time stamp of the measurement.
+   * \param measurements Measured attributes. Each of them must be a state attribute.
+   * \param measurement_covariances Covariances of the measurement.
+   * \return true if prediction and update were successful.
+   */
+  template <KinematicAttribute... SensorAttributes>
+  bool process(const double time_stamp,
+               const KinematicStateVector<KinematicAttributePack<SensorAttributes...>>& measurements,
+               const base::Matrix<typename FilterModel::data_type,
+                                  sizeof...(SensorAttributes),
+                                  sizeof...(SensorAttributes)>& measurement_covariances)
+  {
+    static_assert((StateVector::template hasAttribute<SensorAttributes>() && ...),
+                  "Each measured attribute must be an attribute of the filter state.");
+
+    using SensorStateVector = KinematicStateVector<KinematicAttributePack<SensorAttributes...>>;
+    using SensorVector = typename SensorStateVector::Vector;
+    constexpr std::array<std::size_t, sizeof...(SensorAttributes)> state_indices = {
+      StateVector::template getAttributeIndex<SensorAttributes>()...
+    };
+
+    StateVector predicted_state;
+    Matrix predicted_covariances;
+
+    // predict internal states and covariances to given time stamp
+    if (false == this->predictToTime(time_stamp, predicted_state, predicted_covariances)) {
+      base::LogWarn() << "KalmanFilter::process(): cancel prediction and keep previous state.";
+      return false;
+    }
+
+    // the innovation is calculated using the attribute types, so angles are wrapped like in the dense update
+    SensorStateVector predicted_state_sensor_space;
+    ((predicted_state_sensor_space.template value<SensorAttributes>()
+      = predicted_state.template value<SensorAttributes>()), ...);
+    const SensorVector innovation = static_cast<SensorVector>(measurements - predicted_state_sensor_space);
+
+    // the update only depends on the number of measured attributes, so it is shared by all sensors of same size
+    return this->template updateSelectedStates<sizeof...(SensorAttributes)>(
+      time_stamp, innovation, measurement_covariances, state_indices, predicted_state, predicted_covariances);
+  }
+
   bool predictToTime(const double time_stamp)
   {
     StateVector predicted_state;
@@ -147,6 +197,63 @@ private:
     _time_stamp = time_stamp;
   }              
 
+  template <std::size_t SensorDimension>
+  bool updateSelectedStates(const double time_stamp,
+                            const base::VectorX<typename FilterModel::data_type, SensorDimension>& innovation,
+                            const base::Matrix<typename FilterModel::data_type,
+                                               SensorDimension,
+                                               SensorDimension>& measurement_covariances,
+                            const std::array<std::size_t, SensorDimension>& state_indices,
+                            const StateVector& predicted_state,
+                            const Matrix& predicted_covariances)
+  {
+    using SensorMatrix = base::Matrix<typename FilterModel::data_type, SensorDimension, SensorDimension>;
+    using GainMatrix = base::Matrix<typename FilterModel::data_type, FilterModel::dimension, SensorDimension>;
+
+    const typename StateVector::Vector state = predicted_state;
+
+    // P * H^T and H * P * H^T + R only pick elements, because H has a single one per row
+    GainMatrix covariances_observed;
+    SensorMatrix innovation_covariances;
+
+    for (std::size_t row = 0; row < SensorDimension; ++row) {
+      covariances_observed.col(row) = predicted_covariances.col(state_indices[row]);
+
+      for (std::size_t col = 0; col < SensorDimension; ++col) {
+        innovation_covariances(row, col) = predicted_covariances(state_indices[row], state_indices[col])
+                                           + measurement_covariances(row, col);
+      }
+    }
+
+    // K = P * H^T * S^-1 is solved as S * K^T = H * P, S is symmetric
+    const Eigen::LDLT<SensorMatrix> decomposition(innovation_covariances);
+
+    if (decomposition.info() != Eigen::Success) {
+      base::LogError() << "KalmanFilter::process(): innovation covariances are not positive semidefinite."
+                       << " Keep previous state.";
+      return false;
+    }
+
+    const GainMatrix kalman_gain = decomposition.solve(covariances_observed.transpose()).transpose();
+    _state = state + kalman_gain * innovation;
+
+    // Joseph form (I - K * H) * P * (I - K * H)^T + K * R * K^T, with (I - K * H) * P = P - K * H * P
+    const Matrix reduced_covariances = predicted_covariances - kalman_gain * covariances_observed.transpose();
+    GainMatrix reduced_covariances_observed;
+
+    for (std::size_t col = 0; col < SensorDimension; ++col) {
+      reduced_covariances_observed.col(col) = reduced_covariances.col(state_indices[col]);
+    }
+
+    _corvariances = reduced_covariances - reduced_covariances_observed * kalman_gain.transpose()
+                    + kalman_gain * measurement_covariances * kalman_gain.transpose();
+
+    // set new time stamp
+    _time_stamp = time_stamp;
+
+    return true;
+  }
+
   double calculateDeltaTime(const double future_timestamp) const
   {
     if (future_timestamp <= _time_stamp) {
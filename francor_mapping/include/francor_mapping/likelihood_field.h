@@ -0,0 +1,92 @@
+/**
+ * Likelihood field of an occupancy grid. Each cell holds the log likelihood that a laser beam ends in it, derived
+ * from the distance to the closest occupied cell. Used to score laser scans against a map without ray casting.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace francor {
+
+namespace mapping {
+
+class OccupancyGrid;
+
+class LikelihoodField
+{
+public:
+  struct Parameter
+  {
+    Parameter() { }
+
+    float sigma_hit          = 0.1f;  //> standard deviation of a beam end point around the obstacle in meter
+    float z_hit              = 0.9f;  //> weight of the gaussian around the obstacles
+    float z_rand             = 0.1f;  //> weight of random measurements, the likelihood never drops below it
+    float occupied_threshold = 0.75f; //> cells with a value above are obstacles
+  };
+
+  LikelihoodField() = default;
+
+  /**
+   * \brief Builds the field from the given grid. The distances to the closest obstacle are calculated using an exact
+   *        euclidean distance transform, so the costs are linear in the number of cells.
+   *
+   * \param grid The occupancy grid. It must be valid.
+   * \param parameter The sensor model parameter.
+   * \return true if the field was built.
+   */
+  bool build(const OccupancyGrid& grid, const Parameter& parameter = Parameter());
+
+  inline bool isValid() const noexcept { return !_log_likelihood.empty(); }
+  inline std::size_t numOfCellsX() const noexcept { return _num_cells_x; }
+  inline std::size_t numOfCellsY() const noexcept { return _num_cells_y; }
+  inline float cellSize() const noexcept { return _cell_size; }
+  /**
+   * \brief Position of the lower corner and size of the covered area in meter.
+   */
+  inline float minX() const noexcept { return -_origin_x; }
+  inline float minY() const noexcept { return -_origin_y; }
+  inline float sizeX() const noexcept { return _num_cells_x * _cell_size; }
+  inline float sizeY() const noexcept { return _num_cells_y * _cell_size; }
+
+  /**
+   * \brief Returns the log likelihood of a beam end point at the given position. Positions outside of the grid get
+   *        the likelihood of a random measurement.
+   */
+  inline float logLikelihood(const float x, const float y) const noexcept
+  {
+    const float cell_x = (x + _origin_x) * _inv_cell_size;
+    const float cell_y = (y + _origin_y) * _inv_cell_size;
+
+    if (cell_x < 0.0f || cell_y < 0.0f) {
+      return _log_likelihood_outside;
+    }
+
+    const std::size_t idx_x = static_cast<std::size_t>(cell_x);
+    const std::size_t idx_y = static_cast<std::size_t>(cell_y);
+
+    if (idx_x >= _num_cells_x || idx_y >= _num_cells_y) {
+      return _log_likelihood_outside;
+    }
+
+    return _log_likelihood[idx_y * _num_cells_x + idx_x];
+  }
+
+private:
+  std::vector<float> _log_likelihood;   //> row major, one value per grid cell
+  std::size_t _num_cells_x = 0;
+  std::size_t _num_cells_y = 0;
+  float _cell_size = 0.0f;
+  float _inv_cell_size = 0.0f;
+  float _origin_x = 0.0f;               //> same meaning as the origin of the grid
+  float _origin_y = 0.0f;
+  float _log_likelihood_outside = 0.0f;
+};
+
+} // end namespace mapping
+
+} // end namespace francor
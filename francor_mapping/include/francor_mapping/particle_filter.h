@@ -0,0 +1,134 @@
+/**
+ * Particle filter (Monte Carlo localization) of the ego pose on an occupancy grid. The particles are stored as
+ * structure of arrays, so the scoring of all particles against the likelihood field streams through contiguous memory.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include <francor_base/pose.h>
+#include <francor_base/matrix.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace francor {
+
+namespace base {
+class LaserScan;
+}
+
+namespace mapping {
+
+class LikelihoodField;
+
+class ParticleFilter
+{
+public:
+  struct Parameter
+  {
+    Parameter() { }
+
+    std::size_t min_particles = 500;
+    std::size_t max_particles = 5000;
+    // KLD sampling: the number of particles is chosen so that the error between the particle approximation and the
+    // true posterior is below kld_error with probability 1 - delta. kld_z is the upper 1 - delta quantile of the
+    // standard normal distribution (2.326 for delta = 0.01).
+    double kld_error         = 0.05;
+    double kld_z             = 2.326;
+    double bin_size_position = 0.5;  //> bin size of the KLD histogram in meter
+    double bin_size_yaw      = 0.17; //> bin size of the KLD histogram in rad (~10°)
+    double resample_threshold = 0.5; //> resample if the effective sample size drops below this ratio of particles
+    std::size_t max_beams    = 100;  //> used beams of a laser scan, they are picked evenly over the scan
+    // odometry motion model, standard deviations of the noise added to each particle on prediction
+    double noise_translation_per_meter = 0.1;
+    double noise_yaw_per_rad           = 0.1;
+    double noise_yaw_per_meter         = 0.05;
+  };
+
+  ParticleFilter(const Parameter& parameter = Parameter());
+
+  /**
+   * \brief Draws max_particles particles normal distributed around the given pose.
+   */
+  void initialize(const base::Pose2d& pose, const double sigma_position, const double sigma_yaw);
+  /**
+   * \brief Draws max_particles particles uniformly distributed over the area of the likelihood field (global
+   *        localization). The KLD sampling reduces them as soon as they converge.
+   */
+  bool initialize(const LikelihoodField& field);
+  /**
+   * \brief Moves all particles by the given motion and adds noise according the motion model.
+   *
+   * \param delta_pose Motion of the ego object in its own frame since the last prediction.
+   */
+  void predict(const base::Pose2d& delta_pose);
+  /**
+   * \brief Weights the particles by the likelihood of the laser scan and resamples them if the effective sample size
+   *        is too small. The particles are scored in parallel (see base::parallelFor()).
+   *
+   * \param field Likelihood field of the map.
+   * \param scan The laser scan. Its pose is the sensor pose in ego frame.
+   * \return true if the update was successful.
+   */
+  bool update(const LikelihoodField& field, const base::LaserScan& scan);
+  /**
+   * \brief Scores each particle with the sum of the log likelihoods of the given beam end points. The end points are
+   *        given in ego frame. This is the inner kernel of update().
+   */
+  void score(const LikelihoodField& field, const std::vector<float>& points_x, const std::vector<float>& points_y);
+  /**
+   * \brief Draws a new particle set using low variance resampling. The size of the new set is adapted by KLD
+   *        sampling to the number of histogram bins the resampled particles occupy.
+   */
+  void resample();
+  /**
+   * \brief Estimates the weighted mean pose and its covariances.
+   */
+  void estimate(base::Pose2d& pose, base::Matrix3d& covariances) const;
+
+  inline void seed(const std::uint32_t value) { _generator.seed(value); }
+  inline std::size_t size() const noexcept { return _x.size(); }
+  inline bool isInitialized() const noexcept { return !_x.empty(); }
+  inline const std::vector<float>& x() const noexcept { return _x; }
+  inline const std::vector<float>& y() const noexcept { return _y; }
+  inline const std::vector<float>& yaw() const noexcept { return _yaw; }
+  inline const std::vector<float>& weights() const noexcept { return _weights; }
+  inline const std::vector<float>& scores() const noexcept { return _scores; }
+  inline const Parameter& parameter() const noexcept { return _parameter; }
+  /**
+   * \brief Number of particles required by KLD sampling for the given number of occupied histogram bins.
+   */
+  std::size_t requiredNumOfParticles(const std::size_t num_bins) const;
+
+private:
+  void lowVarianceSample(const std::size_t num_particles, std::vector<std::size_t>& indices);
+  std::uint64_t binKey(const std::size_t particle) const;
+  double effectiveSampleSize() const;
+
+  Parameter _parameter;
+  std::mt19937 _generator;
+
+  // particles, structure of arrays
+  std::vector<float> _x;
+  std::vector<float> _y;
+  std::vector<float> _yaw;
+  std::vector<float> _weights;
+  std::vector<float> _scores;            //> log likelihood of the last scan per particle
+
+  // buffers reused between updates
+  std::vector<float> _points_x;          //> beam end points in ego frame
+  std::vector<float> _points_y;
+  std::vector<std::size_t> _indices;     //> particles picked by the resampling
+  std::vector<std::uint64_t> _bins;      //> KLD histogram bins of the picked particles
+  std::vector<float> _resampled_x;
+  std::vector<float> _resampled_y;
+  std::vector<float> _resampled_yaw;
+};
+
+} // end namespace mapping
+
+} // end namespace francor
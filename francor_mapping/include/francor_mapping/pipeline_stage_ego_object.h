@@ -6,9 +6,15 @@
 #pragma once
 
 #include "francor_mapping/ego_object.h"
+#include "francor_mapping/likelihood_field.h"
+#include "francor_mapping/particle_filter.h"
+
+#include <francor_base/pose_sensor_data.h>
 
 #include <francor_processing/data_processing_pipeline_stage.h>
 
+#include <memory>
+
 namespace francor {
 
 namespace mapping {
@@ -73,6 +79,59 @@ private:
 };
 
 
+/**
+ * \brief Localizes the ego object on an occupancy grid using a particle filter (Monte Carlo localization). The ego
+ *        state is predicted to the time stamp of the laser scan and the motion since the last run moves the
+ *        particles. The particle estimate updates the ego object and is provided as pose measurement. The likelihood
+ *        field is rebuilt each time the grid is written.
+ */
+class StageLocalizeEgoWithParticleFilter final : public processing::ProcessingStage<EgoObject>
+{
+public:
+  enum Inputs {
+    IN_SCAN = 0,
+    IN_GRID,
+    COUNT_INPUTS
+  };
+  enum Outputs {
+    OUT_POSE_MEASUREMENT = 0,
+    COUNT_OUTPUTS
+  };
+
+  struct Parameter
+  {
+    Parameter() { }
+
+    ParticleFilter::Parameter filter;
+    LikelihoodField::Parameter field;
+    bool   global_initialization  = false; //> spread the initial particles over the whole grid
+    double initial_sigma_position = 0.5;   //> otherwise they are spread around the ego pose
+    double initial_sigma_yaw      = 0.2;
+  };
+
+  StageLocalizeEgoWithParticleFilter(const Parameter& parameter = Parameter())
+    : processing::ProcessingStage<EgoObject>("localize ego with particle filter", COUNT_INPUTS, COUNT_OUTPUTS),
+      _parameter(parameter),
+      _filter(parameter.filter)
+  { }
+
+  inline const ParticleFilter& filter() const noexcept { return _filter; }
+
+private:
+  bool doProcess(EgoObject& ego) final;
+  bool doInitialization() final;
+  bool initializePorts() final;
+  bool isReady() const final;
+  bool validateInputData() const final;
+
+  const Parameter _parameter;
+  ParticleFilter _filter;
+  LikelihoodField _field;
+  std::size_t _grid_version = 0;                        //> version of the grid the field was built from
+  base::Pose2d _last_ego_pose;                          //> ego pose after the last run, origin of the next motion
+  std::shared_ptr<base::PoseSensorData> _pose_measurement;
+};
+
 } // end namespace mapping
 
 } // end namespace francor
\ No newline at end of file
@@ -6,10 +6,12 @@
 #pragma once
 
 #include "francor_mapping/occupancy_grid.h"
+#include "francor_mapping/camera_grid_projection.h"
 
 #include <francor_base/point.h>
 #include <francor_base/angle.h>
 #include <francor_base/laser_scan.h>
+#include <francor_base/buffer_pool.h>
 
 #include <francor_processing/data_processing_pipeline_stage.h>
 
@@ -52,10 +54,10 @@ private:
   bool isReady() const final;
 
   const Parameter _parameter;
-  base::Point2dVector _reconstructed_points;
+  base::BufferPool<base::Point2dVector> _point_buffers;
+  base::BufferHandle<base::Point2dVector> _reconstructed_points;
 };
 
-
 class StageReconstructLaserScanFromOccupancyGrid final : public processing::ProcessingStage<OccupancyGrid>
 {
 public:
@@ -95,8 +97,6 @@ private:
   base::LaserScan _reconstructed_scan;
 };
 
-
-
 class StagePushLaserScanToOccupancyGrid final : public processing::ProcessingStage<OccupancyGrid>
 {
 public:
@@ -121,8 +121,6 @@ private:
   bool isReady() const final;  
 };
 
-
-
 class StagePushPointsToOccupancyGrid final : public processing::ProcessingStage<OccupancyGrid>
 {
 public:
@@ -147,6 +145,44 @@ private:
   bool isReady() const final;  
 };
 
+class StagePushCameraMaskToOccupancyGrid final : public processing::ProcessingStage<OccupancyGrid>
+{
+public:
+  enum Inputs {
+    IN_EGO_POSE = 0,
+    IN_MASK,
+    COUNT_INPUTS
+  };
+  enum Outputs {
+    OUT_LAYER = 0,
+    COUNT_OUTPUTS
+  };
+
+  StagePushCameraMaskToOccupancyGrid(const CameraGridProjection::Parameter& parameter = CameraGridProjection::Parameter())
+    : processing::ProcessingStage<OccupancyGrid>("push camera mask to occupancy grid", COUNT_INPUTS, COUNT_OUTPUTS),
+      _projection(parameter)
+  { }
+
+  /**
+   * \brief Builds the pixel to cell lookup table of the camera. Must be called before the stage is initialized. See
+   *        CameraGridProjection::initialize().
+   */
+  bool setCamera(const francor::algorithm::GroundPlaneProjector& projector, const base::Size2u& num_cells,
+                 const double cell_size, const base::Point2d& origin)
+  {
+    return _projection.initialize(projector, num_cells, cell_size, origin);
+  }
+
+private:
+  bool doProcess(OccupancyGrid& grid) final;
+  bool doInitialization() final;
+  bool initializePorts() final;
+  bool isReady() const final;
+
+  CameraGridProjection _projection;
+  OccupancyGrid _layer;
+};
+
 } // end namespace mapping
 
-} // end namespace francor
\ No newline at end of file
+} // end namespace francor
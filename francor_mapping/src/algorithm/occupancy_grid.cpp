@@ -9,6 +9,8 @@
 #include "francor_mapping/occupancy_grid.h"
 
 #include <francor_base/log.h>
+#include <francor_base/trace.h>
+#include <francor_base/parallel.h>
 #include <francor_base/pose.h>
 #include <francor_base/angle.h>
 #include <francor_base/line.h>
@@ -21,7 +23,13 @@
 #include <francor_vision/image.h>
 
 #include <algorithm>
-#include <numeric>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
 
 namespace francor {
 
@@ -35,53 +43,215 @@ using francor::base::LogError;
 using francor::vision::Image;
 using francor::vision::ColourSpace;
 
-bool convertGridToImage(const OccupancyGrid& grid, vision::Image& image)
+namespace {
+
+constexpr std::uint8_t pixel_value_unknown = 200;
+constexpr std::uint8_t pixel_value_free = 255;
+constexpr float value_free = 0.1f;
+
+// scalar version of the kernels, written without branches so the compiler can vectorize it, too
+inline std::uint8_t cellToGray(const float value)
 {
-  constexpr std::uint8_t pixel_value_unkown = 200;
+  // nan and values below zero are mapped to zero, the nan case is selected afterwards
+  const float clamped = std::min(std::max(value, 0.0f), 1.0f);
+  const auto occupied = static_cast<std::uint8_t>((100 - static_cast<int>(clamped * 100.0f)) * 2);
 
-  image.resize(grid.cell().count().y(), grid.cell().count().x(), ColourSpace::GRAY);
+  return std::isnan(value) ? pixel_value_unknown : (value <= value_free ? pixel_value_free : occupied);
+}
 
-  for (std::size_t col = 0; col < image.cols(); ++col) {
-    for (std::size_t row = 0; row < image.rows(); ++row) {
-      const auto cell_value = grid(col, row).value;
+inline float grayToCell(const std::uint8_t pixel)
+{
+  const float occupied = static_cast<float>(100 - pixel) / 100.0f;
 
-      if (std::isnan(cell_value)) {
-        image(row, col).gray() = pixel_value_unkown;
-      }
-      else if (cell_value <= 0.1f) {
-        image(row, col).gray() = 255;
+  return pixel == 255 ? value_free : (pixel < 100 ? occupied : std::numeric_limits<float>::quiet_NaN());
+}
+
+void grayRowFromCells(const OccupancyCell* const cells, std::uint8_t* const pixels, const std::size_t count)
+{
+  static_assert(sizeof(OccupancyCell) == sizeof(float), "The kernels load the cells as float array.");
+  const float* const values = reinterpret_cast<const float*>(cells);
+  std::size_t i = 0;
+
+#if defined(__AVX2__) && defined(__FMA__)
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 hundred = _mm256_set1_ps(100.0f);
+  const __m256 free = _mm256_set1_ps(value_free);
+  const __m256i hundred_i = _mm256_set1_epi32(100);
+  const __m256i pixel_free = _mm256_set1_epi32(pixel_value_free);
+  const __m256i pixel_unknown = _mm256_set1_epi32(pixel_value_unknown);
+  const __m256i lanes = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+  for (; i + 8 <= count; i += 8) {
+    const __m256 value = _mm256_loadu_ps(values + i);
+    // max returns the second operand if the first one is nan, so nan becomes zero here
+    const __m256 clamped = _mm256_min_ps(_mm256_max_ps(value, zero), one);
+    const __m256i scaled = _mm256_cvttps_epi32(_mm256_mul_ps(clamped, hundred));
+    __m256i result = _mm256_slli_epi32(_mm256_sub_epi32(hundred_i, scaled), 1);
+
+    result = _mm256_blendv_epi8(result, pixel_free, _mm256_castps_si256(_mm256_cmp_ps(value, free, _CMP_LE_OQ)));
+    result = _mm256_blendv_epi8(result, pixel_unknown, _mm256_castps_si256(_mm256_cmp_ps(value, value, _CMP_UNORD_Q)));
+
+    // pack 8 x 32 bit into 8 x 8 bit, the packing works per 128 bit lane, so the bytes are gathered afterwards
+    const __m256i words = _mm256_packs_epi32(result, result);
+    const __m256i bytes = _mm256_packus_epi16(words, words);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(pixels + i),
+                     _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(bytes, lanes)));
+  }
+#endif
+
+  for (; i < count; ++i) {
+    pixels[i] = cellToGray(values[i]);
+  }
+}
+
+void cellsFromGrayRow(const std::uint8_t* const pixels, OccupancyCell* const cells, const std::size_t count)
+{
+  float* const values = reinterpret_cast<float*>(cells);
+  std::size_t i = 0;
+
+#if defined(__AVX2__) && defined(__FMA__)
+  const __m256 hundred = _mm256_set1_ps(100.0f);
+  const __m256 free = _mm256_set1_ps(value_free);
+  const __m256 unknown = _mm256_set1_ps(std::numeric_limits<float>::quiet_NaN());
+  const __m256i hundred_i = _mm256_set1_epi32(100);
+  const __m256i pixel_free = _mm256_set1_epi32(255);
+
+  for (; i + 8 <= count; i += 8) {
+    const __m256i pixel = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pixels + i)));
+    const __m256 occupied = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(hundred_i, pixel)), hundred);
+    // pixel < 100 <=> 100 > pixel
+    const __m256 is_occupied = _mm256_castsi256_ps(_mm256_cmpgt_epi32(hundred_i, pixel));
+    const __m256 is_free = _mm256_castsi256_ps(_mm256_cmpeq_epi32(pixel, pixel_free));
+    const __m256 value = _mm256_blendv_ps(_mm256_blendv_ps(unknown, occupied, is_occupied), free, is_free);
+
+    _mm256_storeu_ps(values + i, value);
+  }
+#endif
+
+  for (; i < count; ++i) {
+    values[i] = grayToCell(pixels[i]);
+  }
+}
+
+// colour map of the BGR visualization: index 0 - 100 occupancy in percent, then free and unknown
+constexpr std::size_t colour_index_free = 101;
+constexpr std::size_t colour_index_unknown = 102;
+
+const std::array<vision::PixelBgr, 103>& colourMap()
+{
+  static const auto map = [] {
+    std::array<vision::PixelBgr, 103> colours;
+
+    // from yellow to dark red
+    for (std::size_t i = 0; i <= 100; ++i) {
+      const float t = static_cast<float>(i) / 100.0f;
+      colours[i] = { 0, static_cast<std::uint8_t>(255.0f * (1.0f - t)), static_cast<std::uint8_t>(255.0f - 127.0f * t) };
+    }
+
+    colours[colour_index_free] = { 255, 255, 255 };
+    colours[colour_index_unknown] = { 128, 128, 128 };
+
+    return colours;
+  }();
+
+  return map;
+}
+
+void bgrRowFromCells(const OccupancyCell* const cells, vision::PixelBgr* const pixels, const std::size_t count)
+{
+  const auto& colours = colourMap();
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const float value = cells[i].value;
+    const float clamped = std::min(std::max(value, 0.0f), 1.0f);
+    const std::size_t index = std::isnan(value) ? colour_index_unknown
+                                                : (value <= value_free ? colour_index_free
+                                                                       : static_cast<std::size_t>(clamped * 100.0f));
+    pixels[i] = colours[index];
+  }
+}
+
+// converts the cells [x, x + size_x) x [y, y + size_y) into the image, the region must be inside of grid and image
+bool renderGridRegion(const OccupancyGrid& grid, const std::size_t x, const std::size_t y, const std::size_t size_x,
+                      const std::size_t size_y, Image& image)
+{
+  switch (image.colourSpace()) {
+  case ColourSpace::GRAY:
+    {
+      const auto view = image.typedView<ColourSpace::GRAY>();
+
+      for (std::size_t row = y; row < y + size_y; ++row) {
+        grayRowFromCells(&grid(x, row), view.row(row) + x, size_x);
       }
-      else {
-        image(row, col).gray() = (100 - static_cast<std::uint8_t>(cell_value * 100.0f)) * 2;
+    }
+    return true;
+
+  case ColourSpace::BGR:
+    {
+      const auto view = image.typedView<ColourSpace::BGR>();
+
+      for (std::size_t row = y; row < y + size_y; ++row) {
+        bgrRowFromCells(&grid(x, row), view.row(row) + x, size_x);
       }
     }
+    return true;
+
+  default:
+    LogError() << "convertGridToImage(): colour space of image isn't supported.";
+    return false;
   }
+}
 
-  return true;
+} // end namespace
+
+bool convertGridToImage(const OccupancyGrid& grid, vision::Image& image, const vision::ColourSpace space)
+{
+  if (space != ColourSpace::GRAY && space != ColourSpace::BGR) {
+    LogError() << "convertGridToImage(): only GRAY and BGR images are supported.";
+    return false;
+  }
+
+  image.resize(grid.cell().count().y(), grid.cell().count().x(), space);
+
+  return renderGridRegion(grid, 0, 0, grid.cell().count().x(), grid.cell().count().y(), image);
+}
+
+bool updateImageFromGrid(const OccupancyGrid& grid, const base::Rectu& region, vision::Image& image)
+{
+  const std::size_t num_x = grid.cell().count().x();
+  const std::size_t num_y = grid.cell().count().y();
+
+  if (image.cols() != num_x || image.rows() != num_y) {
+    LogError() << "updateImageFromGrid(): size of image doesn't match the grid. Can't update image.";
+    return false;
+  }
+
+  const std::size_t x = std::min<std::size_t>(region.origin().x(), num_x);
+  const std::size_t y = std::min<std::size_t>(region.origin().y(), num_y);
+  const std::size_t size_x = std::min<std::size_t>(region.size().x(), num_x - x);
+  const std::size_t size_y = std::min<std::size_t>(region.size().y(), num_y - y);
+
+  return renderGridRegion(grid, x, y, size_x, size_y, image);
 }
 
 bool createGridFromImage(const Image& image, const double cell_size, OccupancyGrid& grid)
 {
+  if (image.colourSpace() != ColourSpace::GRAY) {
+    LogError() << "createGridFromImage(): image must be gray scaled. Can't create grid.";
+    grid.clear();
+    return false;
+  }
   if (!grid.init({image.cols(), image.rows()}, cell_size)) {
     LogError() << "createGridFromImage(): error occurred during occupancy grid initialization. Can't create grid.";
     grid.clear();
     return false;
   }
 
-  for (std::size_t x = 0; x < grid.cell().count().x(); ++x) {
-    for (std::size_t y = 0; y < grid.cell().count().y(); ++y) {
-      const auto pixel_value = image(y, x).gray();
+  const auto view = image.typedView<ColourSpace::GRAY>();
 
-      if (pixel_value == 255) {
-        grid(x, y).value = 0.1f;
-      }
-      else if (pixel_value < 100) {
-        grid(x, y).value = static_cast<float>(100 - pixel_value) / 100.0f;
-      }
-      else {
-        grid(x, y).value = std::numeric_limits<float>::quiet_NaN();
-      }
-    }
+  for (std::size_t y = 0; y < grid.cell().count().y(); ++y) {
+    cellsFromGrayRow(view.row(y), &grid(0, y), grid.cell().count().x());
   }
 
   return true;
@@ -146,66 +316,128 @@ double reconstructLaserBeam(const OccupancyGrid& grid, const base::Point2d& orig
                             const double beam_width_max_range)
 {
   using francor::algorithm::Ray2d;
+  using francor::base::Vector2d;
 
   const base::Angle divergence_2 = divergence * 0.5;  
   const double cell_width = grid.cell().size() / std::max(std::abs(std::cos(phi)), std::abs(std::sin(phi)));
   const std::size_t number_of_rays = static_cast<std::size_t>((beam_width_max_range / cell_width) + 2.0);
   const base::Angle phi_step = divergence / static_cast<double>(std::max(number_of_rays - 1, 1lu));
 
-  // start from the beam border of laser beam and go to the middle of it
-  base::AnglePiToPi current_phi = phi - divergence_2;
-  std::vector<double> distances;
-  distances.reserve(number_of_rays);
+  // start from the beam border of laser beam and go to the middle of it. The direction of the next sub-ray is
+  // rotated by phi step, so only one sin and cos per beam is needed.
+  Vector2d direction(base::algorithm::line::calculateV(phi - divergence_2));
+  const double step_cos = std::cos(phi_step);
+  const double step_sin = std::sin(phi_step);
 
-  for (std::size_t i = 0; i < number_of_rays; ++i, current_phi += phi_step) {
-    const auto direction = base::algorithm::line::calculateV(current_phi);
+  // the hits of the sub-rays are reduced to a running sum
+  double distance_sum = 0.0;
+  std::size_t num_hits = 0;
+
+  for (std::size_t i = 0; i < number_of_rays; ++i) {
     Ray2d ray(Ray2d::create(origin_idx.x(), origin_idx.y(), grid.cell().count().x(),
                             grid.cell().count().y(), grid.cell().size(), origin, direction, range));
 
     for (const auto& idx : ray) {
       if (grid(idx.x(), idx.y()).value >= 0.8) {
-        distances.push_back((grid.find().cell().position(idx) - origin).norm());
+        distance_sum += (grid.find().cell().position(idx) - origin).norm();
+        ++num_hits;
         break;
       }
     }
+
+    direction = Vector2d(step_cos * direction.x() - step_sin * direction.y(),
+                         step_sin * direction.x() + step_cos * direction.y());
   }
 
-  if (0 == distances.size()) {
+  if (0 == num_hits) {
     return std::numeric_limits<double>::infinity();
   }
   else {
-    return std::accumulate(distances.begin(), distances.end(), 0.0) / static_cast<double>(distances.size());
+    return distance_sum / static_cast<double>(num_hits);
   }
 }                            
 
+namespace {
+
+constexpr std::size_t RECONSTRUCTION_GRAIN_SIZE = 32; //> minimum number of beams per thread
+
+inline base::Pose2d estimateSensorPose(const base::Pose2d& pose_ego, const base::Pose2d& pose_sensor)
+{
+  const base::Transform2d transform({ pose_ego.orientation() }, { pose_ego.position().x(), pose_ego.position().y() });
+  return transform * pose_sensor;
+}
+
+/**
+ * \brief Reconstructs the beams [begin, end) of a laser scan located at the given pose in grid frame.
+ */
+void reconstructBeams(const OccupancyGrid& grid, const base::Pose2d& pose, const base::Angle phi_min,
+                      const base::Angle phi_step, const double range, const base::Angle divergence,
+                      const std::size_t begin, const std::size_t end, float* const distances)
+{
+  const base::Angle divergence_2 = divergence / 2.0;
+  const double beam_width = range * std::tan(divergence_2) * 2.0;
+  const auto origin_idx(grid.find().cell().index(pose.position()));
+
+  for (std::size_t beam = begin; beam < end; ++beam) {
+    const base::AnglePiToPi phi = pose.orientation() + phi_min + phi_step * static_cast<double>(beam);
+
+    distances[beam] = static_cast<float>(reconstructLaserBeam(grid, pose.position(), {origin_idx.x(), origin_idx.y()},
+                                                              phi, range, divergence, beam_width));
+  }
+}
+
+} // end namespace
+
 base::LaserScan reconstructLaserScan(const OccupancyGrid& grid, const base::Pose2d& pose_ego, const base::Pose2d& pose_sensor,
                                      const base::Angle phi_min, const base::Angle phi_step, const std::size_t num_beams,
                                      const double range, const double time_stamp, const base::Angle divergence)
 {
-  using francor::base::Pose2d;
-  using francor::base::Transform2d;
-  using francor::base::Angle;
-  using francor::base::AnglePiToPi;
-  using francor::base::Vector2i;
   using francor::base::LaserScan;
 
-  const Transform2d transform({ pose_ego.orientation() }, { pose_ego.position().x(), pose_ego.position().y() });
-  const Pose2d pose(transform * pose_sensor);
+  FRANCOR_TRACE_SCOPE("reconstructLaserScan", "beams", num_beams);
 
-  const Angle divergence_2 = divergence / 2.0;
-  const double beam_width = range * std::tan(divergence_2) * 2.0;
-  const auto origin_idx(grid.find().cell().index(pose.position()));
+  const base::Pose2d pose(estimateSensorPose(pose_ego, pose_sensor));
+  // written directly into the distance buffer of the scan, so no temporary is needed
+  LaserScan::Distances distances(num_beams);
 
-  AnglePiToPi current_phi = pose.orientation() + phi_min;
-  std::vector<double> distances;
-  distances.resize(num_beams);
+  base::parallelFor(0, num_beams, RECONSTRUCTION_GRAIN_SIZE, [&] (const std::size_t begin, const std::size_t end) {
+    reconstructBeams(grid, pose, phi_min, phi_step, range, divergence, begin, end, distances.data());
+  });
 
-  for (std::size_t beam = 0; beam < num_beams; ++beam, current_phi += phi_step) {
-    distances[beam] = reconstructLaserBeam(grid, pose.position(), {origin_idx.x(), origin_idx.y()}, current_phi, range, divergence, beam_width);
+  return LaserScan(std::move(distances), pose_sensor, phi_min, phi_min + phi_step * static_cast<double>(num_beams),
+                   phi_step, range, divergence, "unkown", time_stamp);
+}
+
+void reconstructLaserScans(const OccupancyGrid& grid, const std::vector<base::Pose2d>& poses_ego,
+                           const base::Pose2d& pose_sensor, const base::Angle phi_min, const base::Angle phi_step,
+                           const std::size_t num_beams, const double range, const base::Angle divergence,
+                           std::vector<float>& distances)
+{
+  FRANCOR_TRACE_SCOPE("reconstructLaserScans", "poses", poses_ego.size(), "beams", num_beams);
+
+  distances.resize(poses_ego.size() * num_beams);
+
+  if (num_beams == 0) {
+    return;
   }
 
-  return LaserScan(distances, pose_sensor, phi_min, phi_min + phi_step * static_cast<double>(num_beams),
-                   phi_step, range, divergence, "unkown", time_stamp);
+  std::vector<base::Pose2d> poses(poses_ego.size());
+
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    poses[i] = estimateSensorPose(poses_ego[i], pose_sensor);
+  }
+
+  // the beams of all poses are split as one range, so also a few poses with many beams keep all threads busy
+  base::parallelFor(0, distances.size(), RECONSTRUCTION_GRAIN_SIZE, [&] (const std::size_t begin, const std::size_t end) {
+    for (std::size_t row_begin = begin; row_begin < end; ) {
+      const std::size_t pose = row_begin / num_beams;
+      const std::size_t row_end = std::min(end, (pose + 1) * num_beams);
+
+      reconstructBeams(grid, poses[pose], phi_min, phi_step, range, divergence, row_begin - pose * num_beams,
+                       row_end - pose * num_beams, distances.data() + pose * num_beams);
+      row_begin = row_end;
+    }
+  });
 }
 
 bool reconstructLaserScanFromGrid(const OccupancyGrid& grid, const base::Pose2d& pose_ego, const base::Pose2d& pose_sensor,
@@ -282,20 +514,24 @@ void pushLaserScanToGrid(OccupancyGrid& grid, const base::LaserScan& laser_scan,
   using francor::base::Line;
   using francor::algorithm::Ray2d;
 
+  FRANCOR_TRACE_SCOPE("pushLaserScanToGrid", "beams", laser_scan.distances().size());
+
   Angle current_phi = laser_scan.phiMin();
   const Point2d position = laser_scan.pose().position() + pose_ego.position();
   const auto start_index = grid.find().cell().index(position);
 
   std::size_t index_normal = 0;
+  const auto distances = laser_scan.distances();
+  const auto point_expansions = laser_scan.pointExpansions();
+
+  // assert for consitent laser scan
+  assert(distances.size() == point_expansions.size());
 
   // process each distance measurement. start from phi min
-  for (std::size_t i = 0; i < laser_scan.distances().size(); ++i)
+  for (std::size_t i = 0; i < distances.size(); ++i)
   {
-    // assert for consitent laser scan
-    assert(laser_scan.distances().size() == laser_scan.pointExpansions().size());
-
-    const double point_expansion = laser_scan.pointExpansions()[i];
-    const double distance = laser_scan.distances()[i];
+    const double point_expansion = point_expansions[i];
+    const double distance = distances[i];
     const Angle phi = current_phi + laser_scan.pose().orientation() + pose_ego.orientation();
     const auto direction = base::algorithm::line::calculateV(phi);
     const auto distance_corrected = (std::isnan(distance) || std::isinf(distance) ?
@@ -0,0 +1,175 @@
+/**
+ * Projects bit masks of a camera into a grid layer that is aligned to the ego object. The ground position of each pixel
+ * is computed once and stored as pixel to cell lookup table, so a frame is projected in one gather pass over the mask.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_mapping/camera_grid_projection.h"
+#include "francor_mapping/algorithm/occupancy_grid.h"
+
+#include <francor_base/log.h>
+#include <francor_base/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace francor {
+
+namespace mapping {
+
+bool CameraGridProjection::initialize(const francor::algorithm::GroundPlaneProjector& projector,
+                                      const base::Size2u& num_cells, const double cell_size,
+                                      const base::Point2d& origin)
+{
+  using francor::base::LogError;
+
+  if (!projector.isInitialized()) {
+    LogError() << "CameraGridProjection: ground plane projector isn't initialized. Can't build lookup table.";
+    return false;
+  }
+  if (num_cells.x() == 0 || num_cells.y() == 0 || cell_size <= 0.0) {
+    LogError() << "CameraGridProjection: invalid layer size. Can't build lookup table.";
+    return false;
+  }
+
+  _image_cols = projector.width();
+  _image_rows = projector.height();
+  _num_cells = num_cells;
+  _cell_size = cell_size;
+  _origin = origin;
+
+  _row_begin.assign(1, 0);
+  _pixel_col.clear();
+  _pixel_cell.clear();
+  _observed.assign(num_cells.x() * num_cells.y(), 0);
+
+  // project the image row by row, each row is one batch; like in GroundPlaneProjector and OpenCV the integer pixel
+  // coordinate is the center of the pixel
+  std::vector<francor::algorithm::GroundPlaneProjector::Pixel> pixels(_image_cols);
+  base::Point2dVector points;
+
+  for (std::size_t row = 0; row < _image_rows; ++row) {
+    for (std::size_t col = 0; col < _image_cols; ++col) {
+      pixels[col] = francor::algorithm::GroundPlaneProjector::Pixel(col, row);
+    }
+
+    projector.project(pixels, points);
+
+    for (std::size_t col = 0; col < _image_cols; ++col) {
+      // NaN fails the range check too
+      const double x = (points[col].x() - origin.x()) / cell_size;
+      const double y = (points[col].y() - origin.y()) / cell_size;
+
+      if (!(x >= 0.0 && y >= 0.0 && x < num_cells.x() && y < num_cells.y())) {
+        continue;
+      }
+
+      const std::uint32_t cell = static_cast<std::uint32_t>(y) * num_cells.x() + static_cast<std::uint32_t>(x);
+      _pixel_col.push_back(static_cast<std::uint32_t>(col));
+      _pixel_cell.push_back(cell);
+      ++_observed[cell];
+    }
+
+    _row_begin.push_back(static_cast<std::uint32_t>(_pixel_col.size()));
+  }
+
+  _hits.assign(_observed.size(), 0);
+
+  return true;
+}
+
+bool CameraGridProjection::project(const vision::ConstImageView& mask, OccupancyGrid& layer)
+{
+  using francor::base::LogError;
+
+  if (!this->isInitialized()) {
+    LogError() << "CameraGridProjection: lookup table isn't built. Can't project mask.";
+    return false;
+  }
+  if (mask.colourSpace() != vision::ColourSpace::BIT_MASK || mask.rows() != _image_rows
+      || mask.cols() != _image_cols) {
+    LogError() << "CameraGridProjection: mask doesn't match the camera. Can't project mask.";
+    return false;
+  }
+  if (layer.cell().count() != _num_cells || layer.cell().size() != _cell_size) {
+    layer.init(_num_cells, _cell_size);
+  }
+
+  // gather the mask pixels and scatter them to their cells
+  std::fill(_hits.begin(), _hits.end(), 0);
+
+  for (std::size_t row = 0; row < _image_rows; ++row) {
+    const std::uint8_t* const pixels = mask.row(row);
+
+    for (std::uint32_t i = _row_begin[row]; i < _row_begin[row + 1]; ++i) {
+      _hits[_pixel_cell[i]] += pixels[_pixel_col[i]] != 0;
+    }
+  }
+
+  // share of the mask pixels of each cell
+  const float range = _parameter.probability_occupied - _parameter.probability_free;
+
+  for (std::size_t y = 0; y < _num_cells.y(); ++y) {
+    for (std::size_t x = 0; x < _num_cells.x(); ++x) {
+      const std::size_t cell = y * _num_cells.x() + x;
+
+      layer(x, y).value = _observed[cell] < std::max<std::size_t>(_parameter.min_pixels, 1)
+                          ? std::numeric_limits<float>::quiet_NaN()
+                          : _parameter.probability_free
+                            + range * static_cast<float>(_hits[cell]) / static_cast<float>(_observed[cell]);
+    }
+  }
+
+  return true;
+}
+
+bool CameraGridProjection::pushLayerToGrid(const OccupancyGrid& layer, const base::Pose2d& pose_ego,
+                                           OccupancyGrid& grid) const
+{
+  using francor::base::LogError;
+
+  // each layer cell updates the grid cell of its center, that only covers the grid if both have the same cell size
+  if (std::abs(layer.cell().size() - grid.cell().size()) > 1e-6 * grid.cell().size()) {
+    LogError() << "CameraGridProjection: cell size of layer (" << layer.cell().size() << " m) differs from the one of"
+               << " the grid (" << grid.cell().size() << " m). Can't push layer to grid.";
+    return false;
+  }
+
+  const base::Transform2d transform({ pose_ego.orientation() },
+                                    { pose_ego.position().x(), pose_ego.position().y() });
+  const double cell_size = layer.cell().size();
+
+  for (std::size_t y = 0; y < layer.cell().count().y(); ++y) {
+    for (std::size_t x = 0; x < layer.cell().count().x(); ++x) {
+      const float value = layer(x, y).value;
+
+      if (std::isnan(value)) {
+        continue;
+      }
+
+      // center of the layer cell in the grid frame
+      const base::Point2d position(transform * base::Point2d(_origin.x() + (x + 0.5) * cell_size,
+                                                             _origin.y() + (y + 0.5) * cell_size));
+
+      if (position.x() + grid.getOrigin().x() < 0.0 || position.y() + grid.getOrigin().y() < 0.0) {
+        continue;
+      }
+
+      const auto index = grid.find().cell().index(position);
+
+      if (index.x() >= grid.cell().count().x() || index.y() >= grid.cell().count().y()) {
+        continue;
+      }
+
+      algorithm::occupancy::updateGridCell(grid(index.x(), index.y()), value);
+    }
+  }
+
+  return true;
+}
+
+} // end namespace mapping
+
+} // end namespace francor
@@ -0,0 +1,147 @@
+/**
+ * Likelihood field of an occupancy grid.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_mapping/likelihood_field.h"
+#include "francor_mapping/occupancy_grid.h"
+
+#include <francor_base/log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace francor {
+
+namespace mapping {
+
+namespace {
+
+/**
+ * \brief One dimensional squared euclidean distance transform of a sampled function (Felzenszwalb and Huttenlocher,
+ *        "Distance Transforms of Sampled Functions"). Finds the lower envelope of the parabolas rooted at each sample.
+ *
+ * \param f Input function, zero at obstacles and a large value elsewhere.
+ * \param n Number of samples.
+ * \param d Resulting squared distances.
+ * \param v Buffer of n locations of the parabolas forming the envelope.
+ * \param z Buffer of n + 1 boundaries between the parabolas.
+ */
+void squaredDistanceTransform(const double* const f, const std::size_t n, double* const d, std::size_t* const v,
+                              double* const z)
+{
+  const auto intersection = [&] (const std::size_t q, const std::size_t p) {
+    const double q_d = static_cast<double>(q);
+    const double p_d = static_cast<double>(p);
+
+    return ((f[q] + q_d * q_d) - (f[p] + p_d * p_d)) / (2.0 * (q_d - p_d));
+  };
+
+  std::size_t k = 0;
+  v[0] = 0;
+  z[0] = -std::numeric_limits<double>::infinity();
+  z[1] =  std::numeric_limits<double>::infinity();
+
+  for (std::size_t q = 1; q < n; ++q) {
+    double s = intersection(q, v[k]);
+
+    while (s <= z[k]) {
+      --k;
+      s = intersection(q, v[k]);
+    }
+
+    ++k;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = std::numeric_limits<double>::infinity();
+  }
+
+  k = 0;
+
+  for (std::size_t q = 0; q < n; ++q) {
+    while (z[k + 1] < static_cast<double>(q)) {
+      ++k;
+    }
+
+    const double distance = static_cast<double>(q) - static_cast<double>(v[k]);
+    d[q] = distance * distance + f[v[k]];
+  }
+}
+
+} // end namespace
+
+bool LikelihoodField::build(const OccupancyGrid& grid, const Parameter& parameter)
+{
+  using francor::base::LogError;
+
+  if (!grid.isValid()) {
+    LogError() << "LikelihoodField: grid is not valid. Can't build field.";
+    return false;
+  }
+  if (parameter.sigma_hit <= 0.0f || parameter.z_rand <= 0.0f) {
+    LogError() << "LikelihoodField: sigma hit and z rand must be greater than zero. sigma hit = "
+               << parameter.sigma_hit << ", z rand = " << parameter.z_rand;
+    return false;
+  }
+
+  const std::size_t num_x = grid.cell().count().x();
+  const std::size_t num_y = grid.cell().count().y();
+  const std::size_t num_max = std::max(num_x, num_y);
+  // larger than any squared distance inside the grid but small enough to be exact in double
+  const double far = static_cast<double>(num_x * num_x + num_y * num_y + 1);
+
+  std::vector<double> squared_distances(num_x * num_y);
+  std::vector<double> f(num_max);
+  std::vector<double> d(num_max);
+  std::vector<std::size_t> v(num_max);
+  std::vector<double> z(num_max + 1);
+
+  // columns first, the obstacles are the roots of the distance function
+  for (std::size_t x = 0; x < num_x; ++x) {
+    for (std::size_t y = 0; y < num_y; ++y) {
+      const float value = grid(x, y).value;
+      f[y] = value > parameter.occupied_threshold && value <= 1.0f ? 0.0 : far;
+    }
+
+    squaredDistanceTransform(f.data(), num_y, d.data(), v.data(), z.data());
+
+    for (std::size_t y = 0; y < num_y; ++y) {
+      squared_distances[y * num_x + x] = d[y];
+    }
+  }
+
+  // then the rows on the result of the columns gives the two dimensional distance
+  for (std::size_t y = 0; y < num_y; ++y) {
+    double* const row = &squared_distances[y * num_x];
+
+    std::copy(row, row + num_x, f.begin());
+    squaredDistanceTransform(f.data(), num_x, row, v.data(), z.data());
+  }
+
+  // convert the distances to log likelihoods of the sensor model
+  const double cell_size = grid.cell().size();
+  const double factor = -cell_size * cell_size / (2.0 * parameter.sigma_hit * parameter.sigma_hit);
+
+  _log_likelihood.resize(num_x * num_y);
+
+  for (std::size_t i = 0; i < _log_likelihood.size(); ++i) {
+    _log_likelihood[i] = static_cast<float>(std::log(parameter.z_hit * std::exp(squared_distances[i] * factor)
+                                                     + parameter.z_rand));
+  }
+
+  _num_cells_x = num_x;
+  _num_cells_y = num_y;
+  _cell_size = static_cast<float>(cell_size);
+  _inv_cell_size = static_cast<float>(1.0 / cell_size);
+  _origin_x = static_cast<float>(grid.getOrigin().x());
+  _origin_y = static_cast<float>(grid.getOrigin().y());
+  _log_likelihood_outside = std::log(parameter.z_rand);
+
+  return true;
+}
+
+} // end namespace mapping
+
+} // end namespace francor
@@ -0,0 +1,346 @@
+/**
+ * Particle filter (Monte Carlo localization) of the ego pose on an occupancy grid.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_mapping/particle_filter.h"
+#include "francor_mapping/likelihood_field.h"
+
+#include <francor_base/laser_scan.h>
+#include <francor_base/parallel.h>
+#include <francor_base/trace.h>
+#include <francor_base/log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace francor {
+
+namespace mapping {
+
+namespace {
+
+// the work per particle is the number of beams, so a few hundred particles justify a thread
+constexpr std::size_t SCORING_GRAIN_SIZE = 256;
+
+inline float normalizeYaw(const float yaw)
+{
+  return std::remainder(yaw, static_cast<float>(2.0 * M_PI));
+}
+
+} // end namespace
+
+ParticleFilter::ParticleFilter(const Parameter& parameter)
+  : _parameter(parameter),
+    _generator(std::random_device()())
+{
+  _parameter.min_particles = std::max<std::size_t>(_parameter.min_particles, 1);
+  _parameter.max_particles = std::max(_parameter.max_particles, _parameter.min_particles);
+}
+
+void ParticleFilter::initialize(const base::Pose2d& pose, const double sigma_position, const double sigma_yaw)
+{
+  std::normal_distribution<double> noise_position(0.0, sigma_position);
+  std::normal_distribution<double> noise_yaw(0.0, sigma_yaw);
+  const std::size_t num_particles = _parameter.max_particles;
+
+  _x.resize(num_particles);
+  _y.resize(num_particles);
+  _yaw.resize(num_particles);
+  _weights.assign(num_particles, 1.0f / static_cast<float>(num_particles));
+  _scores.clear();
+
+  for (std::size_t i = 0; i < num_particles; ++i) {
+    _x[i] = static_cast<float>(pose.position().x() + noise_position(_generator));
+    _y[i] = static_cast<float>(pose.position().y() + noise_position(_generator));
+    _yaw[i] = normalizeYaw(static_cast<float>(pose.orientation() + noise_yaw(_generator)));
+  }
+}
+
+bool ParticleFilter::initialize(const LikelihoodField& field)
+{
+  using francor::base::LogError;
+
+  if (!field.isValid()) {
+    LogError() << "ParticleFilter: likelihood field is not valid. Can't initialize particles.";
+    return false;
+  }
+
+  std::uniform_real_distribution<float> random_x(field.minX(), field.minX() + field.sizeX());
+  std::uniform_real_distribution<float> random_y(field.minY(), field.minY() + field.sizeY());
+  std::uniform_real_distribution<float> random_yaw(-M_PI, M_PI);
+  const std::size_t num_particles = _parameter.max_particles;
+
+  _x.resize(num_particles);
+  _y.resize(num_particles);
+  _yaw.resize(num_particles);
+  _weights.assign(num_particles, 1.0f / static_cast<float>(num_particles));
+  _scores.clear();
+
+  for (std::size_t i = 0; i < num_particles; ++i) {
+    _x[i] = random_x(_generator);
+    _y[i] = random_y(_generator);
+    _yaw[i] = random_yaw(_generator);
+  }
+
+  return true;
+}
+
+void ParticleFilter::predict(const base::Pose2d& delta_pose)
+{
+  const double translation = std::hypot(delta_pose.position().x(), delta_pose.position().y());
+  const float sigma_translation = _parameter.noise_translation_per_meter * translation;
+  const float sigma_yaw = _parameter.noise_yaw_per_rad * std::abs(delta_pose.orientation())
+                          + _parameter.noise_yaw_per_meter * translation;
+  const float delta_x = delta_pose.position().x();
+  const float delta_y = delta_pose.position().y();
+  const float delta_yaw = delta_pose.orientation();
+  std::normal_distribution<float> noise(0.0f, 1.0f);
+
+  for (std::size_t i = 0; i < this->size(); ++i) {
+    const float x = delta_x + sigma_translation * noise(_generator);
+    const float y = delta_y + sigma_translation * noise(_generator);
+    const float cos_yaw = std::cos(_yaw[i]);
+    const float sin_yaw = std::sin(_yaw[i]);
+
+    _x[i] += cos_yaw * x - sin_yaw * y;
+    _y[i] += sin_yaw * x + cos_yaw * y;
+    _yaw[i] = normalizeYaw(_yaw[i] + delta_yaw + sigma_yaw * noise(_generator));
+  }
+}
+
+bool ParticleFilter::update(const LikelihoodField& field, const base::LaserScan& scan)
+{
+  using francor::base::LogError;
+  using francor::base::LogWarn;
+
+  FRANCOR_TRACE_SCOPE("ParticleFilter::update", "particles", this->size(), "beams", scan.distances().size());
+
+  if (!this->isInitialized()) {
+    LogError() << "ParticleFilter: particles are not initialized. Can't update.";
+    return false;
+  }
+  if (!field.isValid()) {
+    LogError() << "ParticleFilter: likelihood field is not valid. Can't update.";
+    return false;
+  }
+
+  // beam end points in ego frame, only a subset of the beams is used
+  const auto distances = scan.distances();
+  const auto& trigonometry = scan.trigonometry();
+  const std::size_t num_used_beams = std::min(distances.size(), _parameter.max_beams);
+  const double cos_sensor = std::cos(scan.pose().orientation());
+  const double sin_sensor = std::sin(scan.pose().orientation());
+
+  _points_x.clear();
+  _points_y.clear();
+
+  for (std::size_t i = 0; i < num_used_beams; ++i) {
+    const std::size_t beam = i * distances.size() / num_used_beams;
+    const double distance = distances[beam];
+
+    if (!std::isfinite(distance) || distance <= 0.0 || (scan.range() > 0.0 && distance >= scan.range())) {
+      continue;
+    }
+
+    const double x = distance * trigonometry.cos()[beam];
+    const double y = distance * trigonometry.sin()[beam];
+
+    _points_x.push_back(static_cast<float>(cos_sensor * x - sin_sensor * y + scan.pose().position().x()));
+    _points_y.push_back(static_cast<float>(sin_sensor * x + cos_sensor * y + scan.pose().position().y()));
+  }
+
+  if (_points_x.empty()) {
+    LogWarn() << "ParticleFilter: laser scan contains no valid beam. Skip update.";
+    return true;
+  }
+
+  this->score(field, _points_x, _points_y);
+
+  // scores are log likelihoods, they are shifted by the maximum so the best particle doesn't underflow
+  const float max_score = *std::max_element(_scores.begin(), _scores.end());
+  double sum = 0.0;
+
+  for (std::size_t i = 0; i < this->size(); ++i) {
+    _weights[i] *= std::exp(_scores[i] - max_score);
+    sum += _weights[i];
+  }
+
+  if (!(sum > 0.0) || !std::isfinite(sum)) {
+    LogWarn() << "ParticleFilter: all particle weights vanished. Reset them to equal weights.";
+    std::fill(_weights.begin(), _weights.end(), 1.0f / static_cast<float>(this->size()));
+  }
+  else {
+    for (auto& weight : _weights) {
+      weight = static_cast<float>(weight / sum);
+    }
+  }
+
+  if (this->effectiveSampleSize() < _parameter.resample_threshold * static_cast<double>(this->size())) {
+    this->resample();
+  }
+
+  return true;
+}
+
+void ParticleFilter::score(const LikelihoodField& field, const std::vector<float>& points_x,
+                           const std::vector<float>& points_y)
+{
+  const std::size_t num_points = std::min(points_x.size(), points_y.size());
+
+  _scores.resize(this->size());
+
+  base::parallelFor(0, this->size(), SCORING_GRAIN_SIZE, [&] (const std::size_t begin, const std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      const float cos_yaw = std::cos(_yaw[i]);
+      const float sin_yaw = std::sin(_yaw[i]);
+      float score = 0.0f;
+
+      for (std::size_t point = 0; point < num_points; ++point) {
+        const float x = cos_yaw * points_x[point] - sin_yaw * points_y[point] + _x[i];
+        const float y = sin_yaw * points_x[point] + cos_yaw * points_y[point] + _y[i];
+
+        score += field.logLikelihood(x, y);
+      }
+
+      _scores[i] = score;
+    }
+  });
+}
+
+void ParticleFilter::resample()
+{
+  FRANCOR_TRACE_SCOPE("ParticleFilter::resample", "particles", this->size());
+
+  if (!this->isInitialized()) {
+    return;
+  }
+
+  // count the histogram bins the resampled set would occupy, the indices are sorted so duplicates are neighbours
+  this->lowVarianceSample(this->size(), _indices);
+  _bins.clear();
+
+  for (std::size_t i = 0; i < _indices.size(); ++i) {
+    if (i == 0 || _indices[i] != _indices[i - 1]) {
+      _bins.push_back(this->binKey(_indices[i]));
+    }
+  }
+
+  std::sort(_bins.begin(), _bins.end());
+  const std::size_t num_bins = std::unique(_bins.begin(), _bins.end()) - _bins.begin();
+  const std::size_t num_particles = this->requiredNumOfParticles(num_bins);
+
+  if (num_particles != this->size()) {
+    this->lowVarianceSample(num_particles, _indices);
+  }
+
+  _resampled_x.resize(num_particles);
+  _resampled_y.resize(num_particles);
+  _resampled_yaw.resize(num_particles);
+
+  for (std::size_t i = 0; i < num_particles; ++i) {
+    _resampled_x[i] = _x[_indices[i]];
+    _resampled_y[i] = _y[_indices[i]];
+    _resampled_yaw[i] = _yaw[_indices[i]];
+  }
+
+  _x.swap(_resampled_x);
+  _y.swap(_resampled_y);
+  _yaw.swap(_resampled_yaw);
+  _weights.assign(num_particles, 1.0f / static_cast<float>(num_particles));
+  _scores.clear();
+}
+
+void ParticleFilter::estimate(base::Pose2d& pose, base::Matrix3d& covariances) const
+{
+  double x = 0.0;
+  double y = 0.0;
+  double cos_yaw = 0.0;
+  double sin_yaw = 0.0;
+
+  for (std::size_t i = 0; i < this->size(); ++i) {
+    x += _weights[i] * _x[i];
+    y += _weights[i] * _y[i];
+    cos_yaw += _weights[i] * std::cos(_yaw[i]);
+    sin_yaw += _weights[i] * std::sin(_yaw[i]);
+  }
+
+  const double yaw = std::atan2(sin_yaw, cos_yaw);
+  covariances = base::Matrix3d::Zero();
+
+  for (std::size_t i = 0; i < this->size(); ++i) {
+    const Eigen::Vector3d diff(_x[i] - x, _y[i] - y, std::remainder(_yaw[i] - yaw, 2.0 * M_PI));
+    covariances += _weights[i] * diff * diff.transpose();
+  }
+
+  pose = base::Pose2d({ x, y }, yaw);
+}
+
+std::size_t ParticleFilter::requiredNumOfParticles(const std::size_t num_bins) const
+{
+  if (num_bins <= 1) {
+    return _parameter.min_particles;
+  }
+
+  // Fox, "KLD-Sampling: Adaptive Particle Filters", chi-square quantile approximated by Wilson-Hilferty
+  const double k = static_cast<double>(num_bins - 1);
+  const double a = 2.0 / (9.0 * k);
+  const double b = 1.0 - a + std::sqrt(a) * _parameter.kld_z;
+  const double required = std::ceil(k / (2.0 * _parameter.kld_error) * b * b * b);
+
+  return std::clamp(static_cast<std::size_t>(required), _parameter.min_particles, _parameter.max_particles);
+}
+
+void ParticleFilter::lowVarianceSample(const std::size_t num_particles, std::vector<std::size_t>& indices)
+{
+  // one random number for the whole set, then the cumulative weights are stepped through in equal steps
+  const double step = 1.0 / static_cast<double>(num_particles);
+  std::uniform_real_distribution<double> random(0.0, step);
+  const double start = random(_generator);
+  double cumulative = _weights.front();
+  std::size_t particle = 0;
+
+  indices.resize(num_particles);
+
+  for (std::size_t i = 0; i < num_particles; ++i) {
+    const double u = start + static_cast<double>(i) * step;
+
+    while (u > cumulative && particle + 1 < this->size()) {
+      ++particle;
+      cumulative += _weights[particle];
+    }
+
+    indices[i] = particle;
+  }
+}
+
+std::uint64_t ParticleFilter::binKey(const std::size_t particle) const
+{
+  // 21 bits per dimension with an offset, so negative bins get a positive key
+  constexpr std::int64_t offset = 1 << 20;
+  constexpr std::uint64_t mask = (1u << 21) - 1;
+  const auto bin = [&] (const double value, const double size) {
+    return static_cast<std::uint64_t>(static_cast<std::int64_t>(std::floor(value / size)) + offset) & mask;
+  };
+
+  return (bin(_x[particle], _parameter.bin_size_position) << 42)
+         | (bin(_y[particle], _parameter.bin_size_position) << 21)
+         | bin(_yaw[particle], _parameter.bin_size_yaw);
+}
+
+double ParticleFilter::effectiveSampleSize() const
+{
+  double sum = 0.0;
+
+  for (const auto weight : _weights) {
+    sum += static_cast<double>(weight) * weight;
+  }
+
+  return sum > 0.0 ? 1.0 / sum : 0.0;
+}
+
+} // end namespace mapping
+
+} // end namespace francor
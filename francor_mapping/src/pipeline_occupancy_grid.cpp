@@ -42,7 +42,7 @@ bool PipeSimulateLaserScan::initializePorts()
   this->initializeInputPort<base::Pose2d>(IN_EGO_POSE, "ego_pose");
   this->initializeInputPort<double>(IN_TIME_STAMP, "time_stamp");
 
-  this->initializeOutputPort<base::Point2dVector>(OUT_POINTS, "points 2d");
+  this->initializeOutputPort<base::BufferHandle<base::Point2dVector>>(OUT_POINTS, "points 2d");
   this->initializeOutputPort<base::LaserScan>(OUT_SCAN, "laser scan");
 
   return true;
@@ -118,7 +118,7 @@ bool PipeLocalizeOnOccupancyGrid::initializePorts()
 {
   this->initializeInputPort<std::shared_ptr<base::SensorData>>(IN_SCAN, "laser scan");
 
-  this->initializeOutputPort<base::Point2dVector>(OUT_POINTS, "reconstructed points 2d");
+  this->initializeOutputPort<base::BufferHandle<base::Point2dVector>>(OUT_POINTS, "reconstructed points 2d");
   this->initializeOutputPort<std::shared_ptr<base::PoseSensorData>>(OUT_POSE_MEASUREMENT, "result_localiztation");
 
   return true;
@@ -147,7 +147,7 @@ bool PipeConvertLaserScanToPoints::initializePorts()
 {
   this->initializeInputPort<std::shared_ptr<base::SensorData>>(IN_SCAN, "laser scan");
 
-  this->initializeOutputPort<base::Point2dVector>(OUT_POINTS, "points 2d");
+  this->initializeOutputPort<base::BufferHandle<base::Point2dVector>>(OUT_POINTS, "points 2d");
   this->initializeOutputPort<std::vector<base::AnglePiToPi>>(OUT_NORMALS, "normals");
 
   return true;
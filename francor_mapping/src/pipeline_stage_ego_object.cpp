@@ -9,10 +9,13 @@
 #include "francor_mapping/ego_kalman_filter_model.h"
 #include "francor_mapping/ego_motion_sensor_model.h"
 #include "francor_mapping/pose_sensor_model.h"
+#include "francor_mapping/occupancy_grid.h"
 
 #include <francor_base/laser_scan.h>
 #include <francor_base/transform.h>
 
+#include <cmath>
+
 namespace francor {
 
 namespace mapping {
@@ -92,11 +95,10 @@ bool StageUpdateEgo::doProcess(EgoObject& ego)
     LogDebug() << this->name() << ": received sensor data of type pose sensor data";
     const auto pose_measurment = std::static_pointer_cast<base::PoseSensorData>(sensor_data);
 
-    const auto observation_matrix = PoseSensorModel::getObservationMatrix(EgoObject::StateModel::StateVector{});
     const auto pose_state = PoseSensorModel::transformSensorData(*pose_measurment);
     const auto pose_covariances = PoseSensorModel::transformCovariances(*pose_measurment);
 
-    if (false == ego.model().process(pose_measurment->timeStamp(), pose_state, pose_covariances, observation_matrix)) {
+    if (false == ego.model().process(pose_measurment->timeStamp(), pose_state, pose_covariances)) {
       LogError() << this->name() << ": ego object update failed";
     }
   }
@@ -137,6 +139,135 @@ bool StageUpdateEgo::isReady() const
   return this->input(IN_SENSOR_DATA).numOfConnections() > 0;
 }
 
+
+
+bool StageLocalizeEgoWithParticleFilter::doProcess(EgoObject& ego)
+{
+  using francor::base::LogDebug;
+  using francor::base::LogError;
+
+  const auto scan = std::dynamic_pointer_cast<base::LaserScan>(
+    this->input(IN_SCAN).data<std::shared_ptr<base::SensorData>>());
+  const auto time_stamp = scan->timeStamp();
+
+  // the likelihood field only needs to be rebuilt if the grid was written in the meantime
+  if (!_field.isValid() || this->input(IN_GRID).version() != _grid_version) {
+    LogDebug() << this->name() << ": build likelihood field from occupancy grid.";
+
+    if (!_field.build(this->input(IN_GRID).data<OccupancyGrid>(), _parameter.field)) {
+      LogError() << this->name() << ": building likelihood field failed.";
+      return false;
+    }
+
+    _grid_version = this->input(IN_GRID).version();
+  }
+
+  // predict ego to the time stamp of the scan, the motion since the last run moves the particles
+  base::Pose2d predicted_pose = ego.pose();
+
+  if (ego.timeStamp() < time_stamp) {
+    EgoObject::StateModel::StateVector predicted_state;
+    EgoObject::StateModel::Matrix predicted_covariance;
+
+    if (false == ego.model().predictToTime(time_stamp, predicted_state, predicted_covariance)) {
+      LogError() << this->name() << ": time prediction of ego object failed.";
+      return false;
+    }
+
+    predicted_pose = EgoObject(predicted_state, predicted_covariance, time_stamp).pose();
+  }
+
+  if (!_filter.isInitialized()) {
+    LogDebug() << this->name() << ": initialize particles.";
+
+    if (_parameter.global_initialization) {
+      if (!_filter.initialize(_field)) {
+        LogError() << this->name() << ": global initialization of particles failed.";
+        return false;
+      }
+    }
+    else {
+      _filter.initialize(predicted_pose, _parameter.initial_sigma_position, _parameter.initial_sigma_yaw);
+    }
+  }
+  else {
+    const double cos_yaw = std::cos(_last_ego_pose.orientation());
+    const double sin_yaw = std::sin(_last_ego_pose.orientation());
+    const double delta_x = predicted_pose.position().x() - _last_ego_pose.position().x();
+    const double delta_y = predicted_pose.position().y() - _last_ego_pose.position().y();
+
+    _filter.predict({ {  cos_yaw * delta_x + sin_yaw * delta_y,
+                        -sin_yaw * delta_x + cos_yaw * delta_y },
+                      std::remainder(predicted_pose.orientation() - _last_ego_pose.orientation(), 2.0 * M_PI) });
+  }
+
+  if (!_filter.update(_field, *scan)) {
+    LogError() << this->name() << ": particle filter update failed.";
+    return false;
+  }
+
+  base::Pose2d estimated_pose;
+  base::Matrix3d covariances;
+
+  _filter.estimate(estimated_pose, covariances);
+  LogDebug() << this->name() << ": estimated pose = " << estimated_pose << " using " << _filter.size()
+             << " particles, valid for time stamp = " << time_stamp;
+
+  *_pose_measurement = base::PoseSensorData(time_stamp, estimated_pose, covariances, "particle filter");
+
+  const auto pose_state = PoseSensorModel::transformSensorData(*_pose_measurement);
+  const auto pose_covariances = PoseSensorModel::transformCovariances(*_pose_measurement);
+
+  if (false == ego.model().process(time_stamp, pose_state, pose_covariances)) {
+    LogError() << this->name() << ": ego object update failed";
+    return false;
+  }
+
+  _last_ego_pose = ego.pose();
+
+  return true;
+}
+
+bool StageLocalizeEgoWithParticleFilter::doInitialization()
+{
+  _pose_measurement = std::make_shared<base::PoseSensorData>("particle filter");
+  return true;
+}
+
+bool StageLocalizeEgoWithParticleFilter::initializePorts()
+{
+  this->initializeInputPort<std::shared_ptr<base::SensorData>>(IN_SCAN, "laser scan");
+  this->initializeInputPort<OccupancyGrid>(IN_GRID, "occupancy grid");
+
+  this->initializeOutputPort(OUT_POSE_MEASUREMENT, "pose measurement", &_pose_measurement);
+
+  return true;
+}
+
+bool StageLocalizeEgoWithParticleFilter::validateInputData() const
+{
+  using francor::base::LogError;
+
+  if (nullptr == std::dynamic_pointer_cast<base::LaserScan>(
+                   this->input(IN_SCAN).data<std::shared_ptr<base::SensorData>>())) {
+    LogError() << this->name() << ": input sensor data is not a laser scan";
+    return false;
+  }
+  if (!this->input(IN_GRID).data<OccupancyGrid>().isValid()) {
+    LogError() << this->name() << ": input occupancy grid is not valid";
+    return false;
+  }
+
+  return true;
+}
+
+bool StageLocalizeEgoWithParticleFilter::isReady() const
+{
+  return this->input(IN_SCAN).numOfConnections() > 0
+         &&
+         this->input(IN_GRID).numOfConnections() > 0;
+}
+
 } // end namespace mapping
 
 } // end namespace francor
\ No newline at end of file
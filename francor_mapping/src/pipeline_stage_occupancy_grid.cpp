@@ -9,6 +9,8 @@
 
 #include <francor_base/pose.h>
 
+#include <francor_vision/image.h>
+
 namespace francor {
 
 namespace mapping {
@@ -26,18 +28,23 @@ bool StageReconstructPointsFromOccupancyGrid::doProcess(OccupancyGrid& grid)
   LogDebug() << this->name() << ": start processing.";
   LogDebug() << this->name() << ": uses sensor pose = " << origin;
 
+  // reconstruct into a local handle, so the result of the last run stays valid if the reconstruction fails
+  auto points = _point_buffers.acquire();
+
   if (!algorithm::occupancy::reconstructPointsFromGrid(grid,
                                                        origin,
                                                        _parameter.phi_min,
                                                        _parameter.phi_step,
                                                        _parameter.num_laser_beams,
                                                        _parameter.max_range,
-                                                       _reconstructed_points))
+                                                       *points))
   {
     LogError() << this->name() << ": reconstruct points from tsd grid failed.";
     return false;
   }              
 
+  _reconstructed_points = std::move(points);
+
   LogDebug() << this->name() << ": end processing.";
   return true;                                    
 }
@@ -62,7 +69,6 @@ bool StageReconstructPointsFromOccupancyGrid::isReady() const
   return this->input(IN_SENSOR_POSE).numOfConnections() > 0;
 }
 
-
 bool StageReconstructLaserScanFromOccupancyGrid::doProcess(OccupancyGrid& grid)
 {
   using francor::base::LogError;
@@ -119,8 +125,6 @@ bool StageReconstructLaserScanFromOccupancyGrid::isReady() const
          this->input(IN_TIME_STAMP).numOfConnections() > 0;
 }
 
-
-
 bool StagePushLaserScanToOccupancyGrid::doProcess(OccupancyGrid& grid)
 {
   using francor::base::LogError;
@@ -162,12 +166,10 @@ bool StagePushLaserScanToOccupancyGrid::isReady() const
          this->input(IN_SCAN).numOfConnections() > 0;
 }
 
-
-
 bool StagePushPointsToOccupancyGrid::doProcess(OccupancyGrid& grid)
 {
   // const auto& pose_ego = this->input(IN_EGO_POSE).data<base::Pose2d>();
-  // const auto& points   = this->input(IN_POINTS).data<base::Point2dVector>();
+  // const auto& points   = *this->input(IN_POINTS).data<base::BufferHandle<base::Point2dVector>>();
   // const auto& normals  = this->input(IN_NORMALS).data<std::vector<base::AnglePiToPi>>();
 
   // algorithm::occupancy::
@@ -183,7 +185,7 @@ bool StagePushPointsToOccupancyGrid::doInitialization()
 bool StagePushPointsToOccupancyGrid::initializePorts()
 {
   this->initializeInputPort<base::Point2d                     >(IN_EGO_POSE, "ego pose" );
-  this->initializeInputPort<base::Point2dVector               >(IN_POINTS  , "points 2d");
+  this->initializeInputPort<base::BufferHandle<base::Point2dVector>>(IN_POINTS  , "points 2d");
   this->initializeInputPort<std::vector<base::AnglePiToPi>>(IN_NORMALS , "normals"  );
 
   return true;
@@ -198,6 +200,57 @@ bool StagePushPointsToOccupancyGrid::isReady() const
          this->input(IN_NORMALS).numOfConnections() > 0;
 }
 
+bool StagePushCameraMaskToOccupancyGrid::doProcess(OccupancyGrid& grid)
+{
+  using francor::base::LogError;
+  using francor::base::LogDebug;
+
+  const auto& mask = this->input(IN_MASK).data<vision::Image>();
+
+  LogDebug() << this->name() << ": start processing.";
+
+  if (!_projection.project(mask.view(), _layer)) {
+    LogError() << this->name() << ": project camera mask to grid layer failed.";
+    return false;
+  }
+
+  // without ego pose only the layer is provided
+  if (this->input(IN_EGO_POSE).numOfConnections() > 0
+      &&
+      !_projection.pushLayerToGrid(_layer, this->input(IN_EGO_POSE).data<base::Pose2d>(), grid)) {
+    LogError() << this->name() << ": push grid layer to occupancy grid failed.";
+    return false;
+  }
+
+  LogDebug() << this->name() << ": end processing.";
+  return true;
+}
+
+bool StagePushCameraMaskToOccupancyGrid::doInitialization()
+{
+  if (!_projection.isInitialized()) {
+    base::LogError() << this->name() << ": camera isn't set. Can't initialize stage.";
+    return false;
+  }
+
+  return true;
+}
+
+bool StagePushCameraMaskToOccupancyGrid::initializePorts()
+{
+  this->initializeInputPort<base::Pose2d>(IN_EGO_POSE, "ego pose");
+  this->initializeInputPort<vision::Image>(IN_MASK, "bit mask");
+
+  this->initializeOutputPort(OUT_LAYER, "camera layer", &_layer);
+
+  return true;
+}
+
+bool StagePushCameraMaskToOccupancyGrid::isReady() const
+{
+  return this->input(IN_MASK).numOfConnections() > 0;
+}
+
 } // end namespace mapping
 
-} // end namespace francor
\ No newline at end of file
+} // end namespace francor
@@ -0,0 +1,212 @@
+/**
+ * Unit test for the class CameraGridProjection.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include <francor_base/angle.h>
+#include <francor_base/pose.h>
+
+#include <francor_algorithm/estimate_3d_coordinate.h>
+
+#include <francor_vision/image.h>
+
+#include "francor_mapping/camera_grid_projection.h"
+#include "francor_mapping/occupancy_grid.h"
+
+#include <cmath>
+
+using francor::mapping::OccupancyGrid;
+using francor::mapping::CameraGridProjection;
+using francor::algorithm::GroundPlaneProjector;
+using francor::algorithm::estimate3dCoordinateOnGroundplane;
+
+using francor::base::Pose2d;
+using francor::base::Angle;
+using francor::base::Matrix3d;
+using francor::base::Matrix4d;
+using francor::base::Vector2d;
+using francor::base::Vector3d;
+using francor::base::Point2d;
+using francor::base::Size2u;
+
+using francor::vision::Image;
+using francor::vision::ColourSpace;
+
+namespace {
+
+constexpr std::size_t _width = 64;
+constexpr std::size_t _height = 48;
+constexpr double _cell_size = 0.1;
+const Size2u _num_cells(40, 40);
+const Point2d _origin(0.0, -2.0);
+
+Matrix3d createIntrinsic()
+{
+  Matrix3d intrinsic;
+  intrinsic << 50.0,  0.0, 31.5,
+                0.0, 50.0, 23.5,
+                0.0,  0.0,  1.0;
+
+  return intrinsic;
+}
+
+// camera 1.5 m above the ego origin, looking along the x axis and pitched downwards by 45 degree
+Matrix4d createExtrinsic()
+{
+  const double c = std::cos(M_PI / 4.0);
+  const double s = std::sin(M_PI / 4.0);
+  Matrix4d extrinsic(Matrix4d::Identity());
+
+  extrinsic.block<3, 1>(0, 0) = Vector3d(0.0, -1.0, 0.0);
+  extrinsic.block<3, 1>(0, 1) = Vector3d(-s, 0.0, -c);
+  extrinsic.block<3, 1>(0, 2) = Vector3d(c, 0.0, -s);
+  extrinsic.block<3, 1>(0, 3) = Vector3d(0.0, 0.0, 1.5);
+
+  return extrinsic;
+}
+
+CameraGridProjection createProjection()
+{
+  GroundPlaneProjector projector;
+  CameraGridProjection projection;
+
+  EXPECT_TRUE(projector.initialize(createIntrinsic(), _width, _height));
+  projector.setExtrinsic(createExtrinsic());
+  EXPECT_TRUE(projection.initialize(projector, _num_cells, _cell_size, _origin));
+
+  return projection;
+}
+
+} // end namespace
+
+TEST(CameraGridProjection, EmptyAndFullMask)
+{
+  CameraGridProjection projection(createProjection());
+  const CameraGridProjection::Parameter parameter;
+  OccupancyGrid empty;
+  OccupancyGrid full;
+
+  ASSERT_TRUE(projection.project(Image::zeros(_height, _width, ColourSpace::BIT_MASK).view(), empty));
+  Image mask(_height, _width, ColourSpace::BIT_MASK);
+  mask.cvMat().setTo(255);
+  ASSERT_TRUE(projection.project(mask.view(), full));
+
+  ASSERT_EQ(empty.cell().count(), _num_cells);
+  ASSERT_EQ(full.cell().count(), _num_cells);
+
+  std::size_t num_observed = 0;
+
+  for (std::size_t y = 0; y < _num_cells.y(); ++y) {
+    for (std::size_t x = 0; x < _num_cells.x(); ++x) {
+      if (std::isnan(empty(x, y).value)) {
+        EXPECT_TRUE(std::isnan(full(x, y).value));
+        continue;
+      }
+
+      ++num_observed;
+      EXPECT_FLOAT_EQ(empty(x, y).value, parameter.probability_free);
+      EXPECT_FLOAT_EQ(full(x, y).value, parameter.probability_occupied);
+    }
+  }
+
+  // the camera sees only a part of the layer, e.g. nothing behind it
+  EXPECT_GT(num_observed, 0);
+  EXPECT_LT(num_observed, _num_cells.x() * _num_cells.y());
+  EXPECT_TRUE(std::isnan(empty(0, 20).value));
+}
+
+TEST(CameraGridProjection, SinglePixel)
+{
+  CameraGridProjection projection(createProjection());
+  const CameraGridProjection::Parameter parameter;
+  Image mask(Image::zeros(_height, _width, ColourSpace::BIT_MASK));
+  OccupancyGrid layer;
+
+  // bottom center pixel hits the ground in front of the camera
+  mask(40, 32).bit() = 255;
+  ASSERT_TRUE(projection.project(mask.view(), layer));
+
+  Vector3d point;
+  ASSERT_TRUE(estimate3dCoordinateOnGroundplane(createIntrinsic(), createExtrinsic(), Vector2d(32.0, 40.0), point));
+  const std::size_t hit_x = static_cast<std::size_t>((point.x() - _origin.x()) / _cell_size);
+  const std::size_t hit_y = static_cast<std::size_t>((point.y() - _origin.y()) / _cell_size);
+
+  for (std::size_t y = 0; y < _num_cells.y(); ++y) {
+    for (std::size_t x = 0; x < _num_cells.x(); ++x) {
+      if (std::isnan(layer(x, y).value)) {
+        continue;
+      }
+      if (x == hit_x && y == hit_y) {
+        EXPECT_GT(layer(x, y).value, parameter.probability_free);
+        EXPECT_LE(layer(x, y).value, parameter.probability_occupied);
+      }
+      else {
+        EXPECT_FLOAT_EQ(layer(x, y).value, parameter.probability_free);
+      }
+    }
+  }
+}
+
+TEST(CameraGridProjection, PushLayerToGrid)
+{
+  CameraGridProjection projection(createProjection());
+  const CameraGridProjection::Parameter parameter;
+  Image mask(_height, _width, ColourSpace::BIT_MASK);
+  mask.cvMat().setTo(255);
+
+  OccupancyGrid layer;
+  ASSERT_TRUE(projection.project(mask.view(), layer));
+
+  OccupancyGrid grid;
+  ASSERT_TRUE(grid.init({ 100, 100 }, _cell_size));
+
+  // ego object looks along the y axis
+  const Pose2d pose_ego({ 5.0, 3.0 }, Angle::createFromDegree(90.0));
+  ASSERT_TRUE(projection.pushLayerToGrid(layer, pose_ego, grid));
+
+  std::size_t num_updated = 0;
+
+  for (std::size_t y = 0; y < 100; ++y) {
+    for (std::size_t x = 0; x < 100; ++x) {
+      if (grid(x, y).value == 0.5f) {
+        continue;
+      }
+
+      // all updated cells are in front of the ego object
+      ++num_updated;
+      EXPECT_GT(grid(x, y).value, 0.5f);
+      EXPECT_GT(grid.find().cell().position({ x, y }).y(), 3.0);
+    }
+  }
+
+  EXPECT_GT(num_updated, 0);
+
+  // a grid with other cell size isn't touched
+  OccupancyGrid coarse_grid;
+  ASSERT_TRUE(coarse_grid.init({ 50, 50 }, 2.0 * _cell_size));
+  EXPECT_FALSE(projection.pushLayerToGrid(layer, pose_ego, coarse_grid));
+
+  for (std::size_t y = 0; y < 50; ++y) {
+    for (std::size_t x = 0; x < 50; ++x) {
+      EXPECT_EQ(0.5f, coarse_grid(x, y).value);
+    }
+  }
+}
+
+TEST(CameraGridProjection, InvalidInput)
+{
+  CameraGridProjection projection;
+  OccupancyGrid layer;
+  const Image mask(Image::zeros(_height, _width, ColourSpace::BIT_MASK));
+
+  // lookup table isn't built
+  EXPECT_FALSE(projection.project(mask.view(), layer));
+
+  // mask doesn't match the camera
+  CameraGridProjection initialized(createProjection());
+  EXPECT_FALSE(initialized.project(Image::zeros(_height, _width + 1, ColourSpace::BIT_MASK).view(), layer));
+  EXPECT_FALSE(initialized.project(Image::zeros(_height, _width, ColourSpace::GRAY).view(), layer));
+}
@@ -6,6 +6,8 @@
  */
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cmath>
 #include <random>
 
 #include "francor_mapping/kalman_filter.h"
@@ -18,6 +20,7 @@ using francor::mapping::KalmanFilter;
 using francor::mapping::EgoKalmanFilterModel;
 
 using francor::base::Angle;
+using francor::base::AnglePiToPi;
 
 template <typename StateVector>
 class CsvWriter
@@ -162,6 +165,124 @@ TEST(KalmanFilter, Update_Circle)
   }
 }
 
+namespace {
+
+using PoseSensorAttributes = KinematicAttributePack<KinematicAttribute::POS_X,
+                                                    KinematicAttribute::POS_Y,
+                                                    KinematicAttribute::YAW>;
+using PoseSensorStateVector = KinematicStateVector<PoseSensorAttributes>;
+using PoseObservationMatrix = francor::base::Matrix<EgoKalmanFilterModel::data_type,
+                                                    PoseSensorStateVector::size,
+                                                    EgoKalmanFilterModel::dimension>;
+
+PoseObservationMatrix createPoseObservationMatrix()
+{
+  PoseObservationMatrix observation_matrix(PoseObservationMatrix::Zero());
+  observation_matrix(PoseSensorStateVector::getAttributeIndex<KinematicAttribute::POS_X>(),
+                     EgoKalmanFilterModel::StateVector::getAttributeIndex<KinematicAttribute::POS_X>()) = 1.0;
+  observation_matrix(PoseSensorStateVector::getAttributeIndex<KinematicAttribute::POS_Y>(),
+                     EgoKalmanFilterModel::StateVector::getAttributeIndex<KinematicAttribute::POS_Y>()) = 1.0;
+  observation_matrix(PoseSensorStateVector::getAttributeIndex<KinematicAttribute::YAW>(),
+                     EgoKalmanFilterModel::StateVector::getAttributeIndex<KinematicAttribute::YAW>()) = 1.0;
+
+  return observation_matrix;
+}
+
+KalmanFilter<EgoKalmanFilterModel> createMovingFilter(const double yaw_degree = 20.0)
+{
+  KalmanFilter<EgoKalmanFilterModel>::StateVector initial_state;
+  initial_state.x() = 1.0;
+  initial_state.y() = -2.0;
+  initial_state.velocity() = 1.5;
+  initial_state.acceleration() = 0.1;
+  initial_state.yaw() = Angle::createFromDegree(yaw_degree);
+  initial_state.yawRate() = 0.1;
+
+  KalmanFilter<EgoKalmanFilterModel> kalman_filter(0.0);
+  kalman_filter.initialize(initial_state, KalmanFilter<EgoKalmanFilterModel>::Matrix::Identity() * 0.5);
+
+  return kalman_filter;
+}
+
+} // end namespace
+
+// the selection update with LDLT and Joseph form must give the same result as the update using the dense matrices
+TEST(KalmanFilter, SelectionUpdateEqualsDenseUpdate)
+{
+  const PoseObservationMatrix observation_matrix(createPoseObservationMatrix());
+
+  francor::base::Matrix<double, 3, 3> measurement_covariances = francor::base::Matrix<double, 3, 3>::Identity() * 0.2;
+  measurement_covariances(0, 1) = measurement_covariances(1, 0) = 0.05;
+  measurement_covariances(2, 2) = Angle::createFromDegree(5.0) * Angle::createFromDegree(5.0);
+
+  // the second run crosses +-180 degree at the first measurement, so the yaw innovation must be wrapped
+  for (const double start_yaw : { 20.0, 179.0 }) {
+    KalmanFilter<EgoKalmanFilterModel> dense_filter(createMovingFilter(start_yaw));
+    KalmanFilter<EgoKalmanFilterModel> selection_filter(createMovingFilter(start_yaw));
+    AnglePiToPi measured_yaw;
+
+    for (std::size_t i = 1; i <= 20; ++i) {
+      const double time = 0.1 * i;
+      PoseSensorStateVector measurement;
+      measurement.x() = 1.0 + 1.5 * time;
+      measurement.y() = -2.0 + 0.5 * time;
+      measurement.yaw() = Angle::createFromDegree(start_yaw + 3.0 * i);
+      measured_yaw = measurement.yaw();
+
+      ASSERT_TRUE(dense_filter.process(time, measurement, measurement_covariances, observation_matrix));
+      ASSERT_TRUE(selection_filter.process(time, measurement, measurement_covariances));
+    }
+
+    const auto dense_state = static_cast<KalmanFilter<EgoKalmanFilterModel>::StateVector::Vector>(dense_filter.state());
+    const auto selection_state = static_cast<KalmanFilter<EgoKalmanFilterModel>::StateVector::Vector>(selection_filter.state());
+
+    EXPECT_TRUE(dense_state.isApprox(selection_state, 1e-9));
+    EXPECT_TRUE(dense_filter.covariances().isApprox(selection_filter.covariances(), 1e-9));
+    EXPECT_TRUE(selection_filter.covariances().isApprox(selection_filter.covariances().transpose(), 1e-12));
+    EXPECT_DOUBLE_EQ(dense_filter.timeStamp(), selection_filter.timeStamp());
+
+    // the filter follows the measured yaw, a missing wrap would pull it across zero
+    const AnglePiToPi yaw_error = selection_filter.state().yaw() - measured_yaw;
+    EXPECT_LT(std::abs(yaw_error.degree()), 5.0);
+  }
+}
+
+// compares the run time of both update paths, the result is only printed
+TEST(KalmanFilter, BenchmarkUpdatePaths)
+{
+  constexpr std::size_t num_updates = 10000;
+  const PoseObservationMatrix observation_matrix(createPoseObservationMatrix());
+  const francor::base::Matrix<double, 3, 3> measurement_covariances = francor::base::Matrix<double, 3, 3>::Identity() * 0.2;
+  PoseSensorStateVector measurement;
+  measurement.x() = 1.0;
+  measurement.y() = -2.0;
+  measurement.yaw() = 0.3;
+
+  const auto measure = [&] (const auto& process) {
+    KalmanFilter<EgoKalmanFilterModel> kalman_filter(createMovingFilter());
+    const auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 1; i <= num_updates; ++i) {
+      process(kalman_filter, 0.01 * i);
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    EXPECT_TRUE(kalman_filter.covariances().allFinite());
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / num_updates;
+  };
+
+  const double dense_ns = measure([&] (KalmanFilter<EgoKalmanFilterModel>& kalman_filter, const double time) {
+    kalman_filter.process(time, measurement, measurement_covariances, observation_matrix);
+  });
+  const double selection_ns = measure([&] (KalmanFilter<EgoKalmanFilterModel>& kalman_filter, const double time) {
+    kalman_filter.process(time, measurement, measurement_covariances);
+  });
+
+  std::cout << "predict and update, dense path: " << dense_ns << " ns, selection path: " << selection_ns << " ns"
+            << std::endl;
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -23,8 +23,11 @@
 using francor::mapping::OccupancyGrid;
 using francor::mapping::OccupancyCell;
 using francor::mapping::algorithm::occupancy::createGridFromImage;
+using francor::mapping::algorithm::occupancy::convertGridToImage;
+using francor::mapping::algorithm::occupancy::updateImageFromGrid;
 using francor::mapping::algorithm::occupancy::reconstructLaserBeam;
 using francor::mapping::algorithm::occupancy::reconstructLaserScan;
+using francor::mapping::algorithm::occupancy::reconstructLaserScans;
 using francor::mapping::algorithm::grid::registerLaserScan;
 using francor::mapping::algorithm::occupancy::updateGridCell;
 
@@ -269,6 +272,171 @@ TEST_F(OccupancyGridAlgorithm, RegisterNoisedLaserScanInGrid)
   }
 }
 
+// the batched reconstruction must give the same distances as single scans
+TEST(OccupancyGridReconstruction, BatchOfPosesEqualsSingleScans)
+{
+  // 10 m x 10 m room with walls at the border
+  OccupancyGrid room;
+  ASSERT_TRUE(room.init({ 200u, 200u }, 0.05, OccupancyCell{ 0.0f }));
+
+  for (std::size_t i = 0; i < 200; ++i) {
+    room(i, 0).value = room(i, 199).value = room(0, i).value = room(199, i).value = 1.0f;
+  }
+
+  const std::vector<Pose2d> poses_ego = { Pose2d({ 5.0, 5.0 }, 0.0), Pose2d({ 2.0, 3.0 }, Angle::createFromDegree(45.0)),
+                                          Pose2d({ 7.5, 8.0 }, Angle::createFromDegree(-120.0)) };
+  const Pose2d sensor_pose({ 0.1, 0.0 }, Angle::createFromDegree(0.0));
+  constexpr Angle phi_min(Angle::createFromDegree(-135.0));
+  constexpr Angle phi_step(Angle::createFromDegree(0.5));
+  constexpr Angle divergence(Angle::createFromDegree(0.5));
+  constexpr std::size_t num_beams = 541;
+  constexpr double range = 20.0;
+
+  std::vector<float> distances;
+  reconstructLaserScans(room, poses_ego, sensor_pose, phi_min, phi_step, num_beams, range, divergence, distances);
+  ASSERT_EQ(poses_ego.size() * num_beams, distances.size());
+
+  for (std::size_t pose = 0; pose < poses_ego.size(); ++pose) {
+    const LaserScan scan(reconstructLaserScan(room, poses_ego[pose], sensor_pose, phi_min, phi_step, num_beams, range,
+                                              0.0, divergence));
+    ASSERT_EQ(num_beams, scan.distances().size());
+
+    for (std::size_t beam = 0; beam < num_beams; ++beam) {
+      EXPECT_EQ(scan.distances()[beam], distances[pose * num_beams + beam]);
+    }
+  }
+
+  // the beam in the middle of the first scan points to the wall at x = 10 m
+  EXPECT_NEAR(4.9 - 0.05, distances[num_beams / 2], 0.06);
+}
+
+namespace {
+
+// random grid with free, occupied and unknown cells; the width isn't a multiple of the vector width
+OccupancyGrid createRandomGrid(const std::size_t num_x, const std::size_t num_y)
+{
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> value(0.0f, 1.0f);
+  std::uniform_int_distribution<int> kind(0, 9);
+  OccupancyGrid grid;
+  grid.init({ num_x, num_y }, 0.1);
+
+  for (std::size_t y = 0; y < num_y; ++y) {
+    for (std::size_t x = 0; x < num_x; ++x) {
+      const int k = kind(generator);
+      grid(x, y).value = k == 0 ? std::numeric_limits<float>::quiet_NaN() : (k == 1 ? 0.1f : value(generator));
+    }
+  }
+
+  return grid;
+}
+
+} // end namespace
+
+TEST(OccupancyGridConversion, GridToGrayImage)
+{
+  const OccupancyGrid grid(createRandomGrid(37, 5));
+  Image image;
+  ASSERT_TRUE(convertGridToImage(grid, image));
+
+  ASSERT_EQ(image.colourSpace(), ColourSpace::GRAY);
+  ASSERT_EQ(image.cols(), 37);
+  ASSERT_EQ(image.rows(), 5);
+
+  for (std::size_t y = 0; y < image.rows(); ++y) {
+    for (std::size_t x = 0; x < image.cols(); ++x) {
+      const float value = grid(x, y).value;
+      const std::uint8_t expected = std::isnan(value) ? 200
+                                                      : (value <= 0.1f ? 255
+                                                                       : (100 - static_cast<std::uint8_t>(value * 100.0f)) * 2);
+      ASSERT_EQ(expected, image(y, x).gray()) << "x = " << x << ", y = " << y;
+    }
+  }
+}
+
+TEST(OccupancyGridConversion, GrayImageToGrid)
+{
+  Image image(3, 29, ColourSpace::GRAY);
+
+  for (std::size_t row = 0; row < image.rows(); ++row) {
+    for (std::size_t col = 0; col < image.cols(); ++col) {
+      image(row, col).gray() = (row * 29 + col) * 3 % 256;
+    }
+  }
+  image(0, 0).gray() = 255;
+
+  OccupancyGrid grid;
+  ASSERT_TRUE(createGridFromImage(image, 0.1, grid));
+
+  for (std::size_t y = 0; y < grid.cell().count().y(); ++y) {
+    for (std::size_t x = 0; x < grid.cell().count().x(); ++x) {
+      const std::uint8_t pixel = image(y, x).gray();
+
+      if (pixel == 255) {
+        EXPECT_EQ(0.1f, grid(x, y).value);
+      }
+      else if (pixel < 100) {
+        EXPECT_EQ(static_cast<float>(100 - pixel) / 100.0f, grid(x, y).value);
+      }
+      else {
+        EXPECT_TRUE(std::isnan(grid(x, y).value));
+      }
+    }
+  }
+
+  // only gray images are supported
+  EXPECT_FALSE(createGridFromImage(Image(2, 2, ColourSpace::BGR), 0.1, grid));
+}
+
+TEST(OccupancyGridConversion, UpdateRegionOfColourImage)
+{
+  OccupancyGrid grid(createRandomGrid(40, 30));
+  Image image;
+  ASSERT_TRUE(convertGridToImage(grid, image, ColourSpace::BGR));
+  ASSERT_EQ(image.colourSpace(), ColourSpace::BGR);
+
+  // free cells are white, unknown cells gray
+  grid(0, 0).value = 0.0f;
+  grid(1, 0).value = std::numeric_limits<float>::quiet_NaN();
+  // change a region, cells outside of it are changed too but must not be rendered
+  for (std::size_t y = 10; y < 20; ++y) {
+    for (std::size_t x = 0; x < 40; ++x) {
+      grid(x, y).value = 0.9f;
+    }
+  }
+
+  ASSERT_TRUE(updateImageFromGrid(grid, francor::base::Rectu(5, 10, 10, 5), image));
+  ASSERT_TRUE(updateImageFromGrid(grid, francor::base::Rectu(0, 0, 2, 1), image));
+
+  Image expected;
+  ASSERT_TRUE(convertGridToImage(grid, expected, ColourSpace::BGR));
+
+  for (std::size_t y = 0; y < image.rows(); ++y) {
+    for (std::size_t x = 0; x < image.cols(); ++x) {
+      const bool updated = (x >= 5 && x < 15 && y >= 10 && y < 15) || (x < 2 && y == 0);
+
+      if (updated) {
+        ASSERT_EQ(expected(y, x).b(), image(y, x).b());
+        ASSERT_EQ(expected(y, x).g(), image(y, x).g());
+        ASSERT_EQ(expected(y, x).r(), image(y, x).r());
+      }
+      else if (y >= 15 && y < 20) {
+        // changed, but not rendered
+        ASSERT_NE(expected(y, x).g(), image(y, x).g());
+      }
+    }
+  }
+
+  EXPECT_EQ(255, image(0, 0).g());
+  EXPECT_EQ(128, image(0, 1).g());
+
+  // the region is clipped to the grid
+  EXPECT_TRUE(updateImageFromGrid(grid, francor::base::Rectu(35, 25, 100, 100), image));
+  // a image of another size can't be updated
+  Image small(2, 2, ColourSpace::BGR);
+  EXPECT_FALSE(updateImageFromGrid(grid, francor::base::Rectu(0, 0, 1, 1), small));
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,187 @@
+/**
+ * Unit test for the classes LikelihoodField and ParticleFilter.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include <francor_base/angle.h>
+#include <francor_base/pose.h>
+#include <francor_base/laser_scan.h>
+
+#include "francor_mapping/occupancy_grid.h"
+#include "francor_mapping/likelihood_field.h"
+#include "francor_mapping/particle_filter.h"
+#include "francor_mapping/algorithm/occupancy_grid.h"
+
+#include <cmath>
+
+using francor::mapping::OccupancyGrid;
+using francor::mapping::OccupancyCell;
+using francor::mapping::LikelihoodField;
+using francor::mapping::ParticleFilter;
+using francor::mapping::algorithm::occupancy::reconstructLaserScan;
+
+using francor::base::Pose2d;
+using francor::base::Angle;
+using francor::base::LaserScan;
+using francor::base::Matrix3d;
+
+namespace {
+
+// 10 m x 10 m room with walls at the border and a wall inside, so the room has no symmetry
+OccupancyGrid createRoom()
+{
+  OccupancyGrid room;
+  room.init({ 200u, 200u }, 0.05, OccupancyCell{ 0.0f });
+
+  for (std::size_t i = 0; i < 200; ++i) {
+    room(i, 0).value = room(i, 199).value = room(0, i).value = room(199, i).value = 1.0f;
+  }
+  for (std::size_t i = 0; i < 80; ++i) {
+    room(120, i).value = 1.0f;
+  }
+
+  return room;
+}
+
+} // end namespace
+
+TEST(LikelihoodField, DistanceToClosestObstacle)
+{
+  OccupancyGrid grid;
+  ASSERT_TRUE(grid.init({ 50u, 40u }, 0.1, OccupancyCell{ 0.0f }));
+  grid(10, 20).value = 1.0f;
+
+  LikelihoodField::Parameter parameter;
+  LikelihoodField field;
+  ASSERT_TRUE(field.build(grid, parameter));
+  EXPECT_EQ(50u, field.numOfCellsX());
+  EXPECT_EQ(40u, field.numOfCellsY());
+
+  const auto expected = [&] (const double distance) {
+    return std::log(parameter.z_hit * std::exp(-distance * distance / (2.0 * parameter.sigma_hit * parameter.sigma_hit))
+                    + parameter.z_rand);
+  };
+
+  // cell centers: obstacle, 3 cells right, 3 and 4 cells away (distance 5 cells)
+  EXPECT_NEAR(expected(0.0), field.logLikelihood(1.05f, 2.05f), 1e-5);
+  EXPECT_NEAR(expected(0.3), field.logLikelihood(1.35f, 2.05f), 1e-5);
+  EXPECT_NEAR(expected(0.5), field.logLikelihood(1.35f, 2.45f), 1e-5);
+  // outside of the grid only random measurements are possible
+  EXPECT_NEAR(std::log(parameter.z_rand), field.logLikelihood(-0.01f, 2.0f), 1e-6);
+  EXPECT_NEAR(std::log(parameter.z_rand), field.logLikelihood(1.0f, 4.01f), 1e-6);
+}
+
+TEST(LikelihoodField, InvalidGrid)
+{
+  LikelihoodField field;
+  EXPECT_FALSE(field.build(OccupancyGrid()));
+  EXPECT_FALSE(field.isValid());
+}
+
+TEST(ParticleFilter, KldNumOfParticles)
+{
+  ParticleFilter::Parameter parameter;
+  parameter.min_particles = 100;
+  parameter.max_particles = 5000;
+  const ParticleFilter filter(parameter);
+
+  EXPECT_EQ(100u, filter.requiredNumOfParticles(1));
+  EXPECT_EQ(5000u, filter.requiredNumOfParticles(10000));
+
+  // values of the bound for error 0.05 and delta 0.01
+  EXPECT_EQ(217u, filter.requiredNumOfParticles(10));
+  EXPECT_EQ(750u, filter.requiredNumOfParticles(50));
+}
+
+TEST(ParticleFilter, ResampleConvergedParticles)
+{
+  ParticleFilter::Parameter parameter;
+  parameter.min_particles = 200;
+  parameter.max_particles = 2000;
+  ParticleFilter filter(parameter);
+  filter.seed(42);
+
+  // spread over several bins, after resampling with equal weights the set keeps its bins
+  filter.initialize(Pose2d({ 1.0, 2.0 }, 0.5), 2.0, 1.0);
+  ASSERT_EQ(2000u, filter.size());
+  filter.resample();
+  EXPECT_LT(200u, filter.size());
+
+  // all particles in one bin need only the minimum
+  filter.initialize(Pose2d({ 1.25, 2.25 }, 0.05), 0.001, 0.001);
+  filter.resample();
+  EXPECT_EQ(200u, filter.size());
+
+  Pose2d pose;
+  Matrix3d covariances;
+  filter.estimate(pose, covariances);
+  EXPECT_NEAR(1.25, pose.position().x(), 1e-3);
+  EXPECT_NEAR(2.25, pose.position().y(), 1e-3);
+  EXPECT_NEAR(0.05, pose.orientation(), 1e-3);
+}
+
+TEST(ParticleFilter, LocalizeInRoom)
+{
+  const OccupancyGrid room(createRoom());
+  LikelihoodField field;
+  ASSERT_TRUE(field.build(room));
+
+  ParticleFilter filter;
+  filter.seed(42);
+
+  const Pose2d sensor_pose({ 0.0, 0.0 }, 0.0);
+  constexpr Angle phi_min(Angle::createFromDegree(-135.0));
+  constexpr Angle phi_step(Angle::createFromDegree(0.5));
+  constexpr std::size_t num_beams = 541;
+
+  Pose2d pose_true({ 4.0, 5.0 }, Angle::createFromDegree(30.0));
+  filter.initialize(Pose2d({ 4.3, 4.8 }, Angle::createFromDegree(35.0)), 0.3, 0.1);
+
+  // drive forward, each step 0.2 m
+  const Pose2d step({ 0.2, 0.0 }, 0.0);
+
+  for (std::size_t i = 0; i < 10; ++i) {
+    const LaserScan scan(reconstructLaserScan(room, pose_true, sensor_pose, phi_min, phi_step, num_beams, 20.0, 0.0,
+                                              0.0));
+    ASSERT_TRUE(filter.update(field, scan));
+
+    filter.predict(step);
+    pose_true = Pose2d({ pose_true.position().x() + 0.2 * std::cos(pose_true.orientation()),
+                         pose_true.position().y() + 0.2 * std::sin(pose_true.orientation()) },
+                       pose_true.orientation());
+  }
+
+  const LaserScan scan(reconstructLaserScan(room, pose_true, sensor_pose, phi_min, phi_step, num_beams, 20.0, 0.0, 0.0));
+  ASSERT_TRUE(filter.update(field, scan));
+
+  Pose2d pose;
+  Matrix3d covariances;
+  filter.estimate(pose, covariances);
+
+  EXPECT_NEAR(pose_true.position().x(), pose.position().x(), 0.1);
+  EXPECT_NEAR(pose_true.position().y(), pose.position().y(), 0.1);
+  EXPECT_NEAR(pose_true.orientation(), pose.orientation(), Angle::createFromDegree(3.0));
+  // converged, so KLD sampling reduced the particles
+  EXPECT_GT(filter.parameter().max_particles, filter.size());
+}
+
+TEST(ParticleFilter, UpdateWithoutInitialization)
+{
+  const OccupancyGrid room(createRoom());
+  LikelihoodField field;
+  ASSERT_TRUE(field.build(room));
+
+  ParticleFilter filter;
+  const LaserScan scan(reconstructLaserScan(room, Pose2d({ 4.0, 5.0 }, 0.0), Pose2d(), Angle::createFromDegree(-90.0),
+                                            Angle::createFromDegree(1.0), 180, 20.0, 0.0, 0.0));
+  EXPECT_FALSE(filter.update(field, scan));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
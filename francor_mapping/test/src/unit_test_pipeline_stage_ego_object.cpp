@@ -0,0 +1,121 @@
+/**
+ * Unit test for the processing stages of the ego object.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include <francor_base/angle.h>
+#include <francor_base/pose.h>
+#include <francor_base/laser_scan.h>
+#include <francor_base/pose_sensor_data.h>
+
+#include <francor_processing/data_processing_port.h>
+
+#include "francor_mapping/ego_object.h"
+#include "francor_mapping/occupancy_grid.h"
+#include "francor_mapping/pipeline_stage_ego_object.h"
+#include "francor_mapping/algorithm/occupancy_grid.h"
+
+#include <cmath>
+#include <memory>
+
+using francor::mapping::EgoObject;
+using francor::mapping::OccupancyGrid;
+using francor::mapping::OccupancyCell;
+using francor::mapping::StageLocalizeEgoWithParticleFilter;
+using francor::mapping::algorithm::occupancy::reconstructLaserScan;
+
+using francor::processing::data::SourcePort;
+
+using francor::base::Pose2d;
+using francor::base::Angle;
+using francor::base::LaserScan;
+using francor::base::SensorData;
+using francor::base::PoseSensorData;
+
+namespace {
+
+// 10 m x 10 m room with walls at the border and a wall inside, so the room has no symmetry
+OccupancyGrid createRoom()
+{
+  OccupancyGrid room;
+  room.init({ 200u, 200u }, 0.05, OccupancyCell{ 0.0f });
+
+  for (std::size_t i = 0; i < 200; ++i) {
+    room(i, 0).value = room(i, 199).value = room(0, i).value = room(199, i).value = 1.0f;
+  }
+  for (std::size_t i = 0; i < 80; ++i) {
+    room(120, i).value = 1.0f;
+  }
+
+  return room;
+}
+
+} // end namespace
+
+TEST(StageLocalizeEgoWithParticleFilter, ConvergeToTruePose)
+{
+  const OccupancyGrid room(createRoom());
+  const Pose2d pose_true({ 4.0, 5.0 }, Angle::createFromDegree(30.0));
+
+  StageLocalizeEgoWithParticleFilter::Parameter parameter;
+  parameter.initial_sigma_position = 0.3;
+  parameter.initial_sigma_yaw = 0.1;
+  StageLocalizeEgoWithParticleFilter stage(parameter);
+  ASSERT_TRUE(stage.initialize());
+
+  // the ego object starts next to its true pose and doesn't move
+  EgoObject ego(Pose2d({ 4.3, 4.8 }, Angle::createFromDegree(35.0)));
+
+  auto scan_port = SourcePort::create<std::shared_ptr<SensorData>>("laser scan");
+  auto grid_port = SourcePort::create<OccupancyGrid>("occupancy grid");
+  ASSERT_TRUE(stage.input(StageLocalizeEgoWithParticleFilter::IN_SCAN).connect(scan_port));
+  ASSERT_TRUE(stage.input(StageLocalizeEgoWithParticleFilter::IN_GRID).connect(grid_port));
+  grid_port.assign(&room);
+
+  std::shared_ptr<SensorData> scan;
+
+  for (std::size_t i = 1; i <= 10; ++i) {
+    scan = std::make_shared<LaserScan>(reconstructLaserScan(room, pose_true, Pose2d(), Angle::createFromDegree(-135.0),
+                                                            Angle::createFromDegree(0.5), 541, 20.0, 0.1 * i, 0.0));
+    scan_port.assign(&scan);
+
+    ASSERT_TRUE(stage.process(ego));
+  }
+
+  // the pose measurement and the ego object converged to the true pose
+  const auto& measurement = stage.output(StageLocalizeEgoWithParticleFilter::OUT_POSE_MEASUREMENT)
+                                 .data<std::shared_ptr<PoseSensorData>>();
+  ASSERT_NE(nullptr, measurement);
+  EXPECT_DOUBLE_EQ(1.0, measurement->timeStamp());
+  EXPECT_NEAR(pose_true.position().x(), measurement->pose().position().x(), 0.1);
+  EXPECT_NEAR(pose_true.position().y(), measurement->pose().position().y(), 0.1);
+  EXPECT_NEAR(pose_true.orientation(), measurement->pose().orientation(), Angle::createFromDegree(3.0));
+
+  EXPECT_NEAR(pose_true.position().x(), ego.pose().position().x(), 0.1);
+  EXPECT_NEAR(pose_true.position().y(), ego.pose().position().y(), 0.1);
+  EXPECT_NEAR(pose_true.orientation(), ego.pose().orientation(), Angle::createFromDegree(3.0));
+  EXPECT_GT(stage.filter().parameter().max_particles, stage.filter().size());
+}
+
+TEST(StageLocalizeEgoWithParticleFilter, NotReadyWithoutGrid)
+{
+  StageLocalizeEgoWithParticleFilter stage;
+  ASSERT_TRUE(stage.initialize());
+
+  EgoObject ego;
+  auto scan_port = SourcePort::create<std::shared_ptr<SensorData>>("laser scan");
+  std::shared_ptr<SensorData> scan(std::make_shared<LaserScan>());
+  ASSERT_TRUE(stage.input(StageLocalizeEgoWithParticleFilter::IN_SCAN).connect(scan_port));
+  scan_port.assign(&scan);
+
+  EXPECT_FALSE(stage.process(ego));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
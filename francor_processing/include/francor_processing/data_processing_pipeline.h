@@ -8,6 +8,7 @@
 #pragma once
 
 #include "francor_base/log.h"
+#include "francor_base/frame_arena.h"
 
 #include "francor_processing/data_processing_pipeline_stage.h"
 
@@ -72,6 +73,9 @@ public:
   {
     static_assert(_num_stages > 0, "ProcessingPipeline: no processing stage is added. Minimum one is required to process the pipeline");
 
+    // temporaries the stages took from the frame arena of this thread are released at frame end
+    base::FrameArenaScope frame;
+
     if constexpr (sizeof...(ArgumentTypes) == 0) {
       NoDataType dummy;
       return this->processStage<0>(model, dummy);
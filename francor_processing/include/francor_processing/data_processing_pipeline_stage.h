@@ -7,6 +7,7 @@
 #pragma once
 
 #include <francor_base/log.h>
+#include <francor_base/trace.h>
 
 #include "francor_processing/data_processing_port.h"
 
@@ -99,7 +100,8 @@ public:
 
   bool process(DataStructureType& data)
   {
-    base::LogDebug() << "ProcessingStage (name = " << _name << "): processing...";
+    FRANCOR_TRACE_SCOPE(_name);
+    FRANCOR_LOG(base::LogDebug) << "ProcessingStage (name = " << _name << "): processing...";
     
     // first check if this stage is ready for processing
     if (!this->isReady())
@@ -108,6 +110,15 @@ public:
       // TODO: throw exception
       return false;
     }
+    // skip processing if the result of the last run is still valid
+    if (_result_cache_enabled && this->isResultCacheValid())
+    {
+      FRANCOR_LOG(base::LogDebug) << "ProcessingStage (name = " << _name << "): input data unchanged. Use cached result.";
+      return true;
+    }
+
+    this->invalidateResultCache();
+
     // check if input data are valid
     if (!this->validateInputData())
     {
@@ -147,7 +158,19 @@ public:
       return false;
     }
 
-    base::LogDebug() << "ProcessingStage (name = " << _name << "): finished processing";
+    // mark output data as written and remember the input versions used for this result
+    for (auto& output : this->getOutputs())
+      output.increaseVersion();
+
+    if (_result_cache_enabled)
+    {
+      for (const auto& input : this->getInputs())
+        _cached_input_versions.push_back(input.version());
+
+      _has_cached_result = true;
+    }
+
+    FRANCOR_LOG(base::LogDebug) << "ProcessingStage (name = " << _name << "): finished processing";
     return true;
   }
   bool initialize()
@@ -168,6 +191,22 @@ public:
   }
 
   inline const std::string& name() const noexcept { return _name; }
+  /**
+   * \brief Enables or disables result caching. If enabled the processing is skipped as long as the data of all inputs
+   *        has the same version as at the last successful run. Only enable it for stages whose result depends
+   *        exclusively on the input ports and not on the data structure. The cache relies on the version of the
+   *        connected outputs, so a producer that modifies its data in place has to assign it again (or increase the
+   *        version of the port) each time. Otherwise the stage keeps its stale result. It is disabled by default and
+   *        should be enabled by the owner of the pipeline, which knows its producers.
+   *
+   * \param enable true enables caching.
+   */
+  inline void enableResultCache(const bool enable = true)
+  {
+    _result_cache_enabled = enable;
+    this->invalidateResultCache();
+  }
+  inline bool isResultCacheEnabled() const noexcept { return _result_cache_enabled; }
 
 protected:
   virtual bool doProcess(DataStructureType& data) = 0;
@@ -178,7 +217,28 @@ protected:
   virtual bool isDataConsistant(const DataStructureType&) const { return true; }
   
 private:
+  bool isResultCacheValid()
+  {
+    // no valid result available
+    if (!_has_cached_result)
+      return false;
+
+    for (std::size_t i = 0; i < _cached_input_versions.size(); ++i)
+      if (this->getInputs()[i].version() != _cached_input_versions[i])
+        return false;
+
+    return true;
+  }
+  inline void invalidateResultCache()
+  {
+    _has_cached_result = false;
+    _cached_input_versions.clear();
+  }
+
   const std::string _name;
+  bool _result_cache_enabled = false;
+  bool _has_cached_result = false;
+  std::vector<std::size_t> _cached_input_versions; //> input versions of last successful run
 };
 
 using NoDataType = bool;
@@ -12,6 +12,7 @@
 #include <functional>
 #include <memory>
 #include <array>
+#include <atomic>
 
 #include <francor_base/log.h>
 
@@ -226,6 +227,19 @@ public:
    * \return The maximum number of connections for each output port.
    */
   static constexpr std::size_t maxNumOfConnections(void) { return MAX_CONNECTIONS; }
+  /**
+   * \brief Returns the version of the data this port is representing. An output gets a new version each time its data
+   *        is written. An input returns the version of the connected output or 0 if it isn't connected. Versions are
+   *        unique over all ports, so equal versions mean the data wasn't written in the meantime.
+   *
+   * \return The current version of the data.
+   */
+  std::size_t version(void) const;
+  /**
+   * \brief Marks the data of this port as written by assigning a new version. Only outputs have own versions. Has to
+   *        be called after the data was modified.
+   */
+  void increaseVersion(void);
 
 protected:
   template <typename DataType>
@@ -258,6 +272,8 @@ private:
   void const* _data = nullptr;
   std::reference_wrapper<const std::type_info> _data_type_info = typeid(void);
   std::array<Port*, MAX_CONNECTIONS> _connections;
+  std::size_t _version = 0;
+  static std::atomic<std::size_t> _version_counter;
 };
 
 
@@ -309,6 +325,7 @@ public:
   void assign(DataType const* const data)
   {
     this->updateDataPtrOfConnections(data);
+    this->increaseVersion();
   }
 
 private:
@@ -0,0 +1,127 @@
+/**
+ * Asynchronous ingestion of sensor data. Sensor data is received from multiple producer threads and dispatched in
+ * time stamp order to a consumer, usually a processing pipeline.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include <francor_base/sensor_data.h>
+#include <francor_base/mpsc_queue.h>
+
+#include <memory>
+#include <functional>
+#include <queue>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+namespace francor {
+
+namespace processing {
+
+/**
+ * \brief Collects sensor data of several sensors and dispatches it in time stamp order. Producers push sensor data
+ *        lock-free from any thread. Received data is held back in a reorder buffer until the newest received time
+ *        stamp is at least latency_window ahead, so samples arriving slightly out of order are still dispatched
+ *        in the correct order. Samples older than the last dispatched one are dropped, because the receiver (e.g. a
+ *        kalman filter) can't handle them.
+ *
+ *        Dispatching is done either by calling dispatch() from a single consumer thread or by the internal worker
+ *        thread started with start(). Both must not be used at the same time.
+ */
+class SensorDataIngestion
+{
+public:
+  using Dispatcher = std::function<bool(const std::shared_ptr<base::SensorData>&)>;
+
+  struct Parameter
+  {
+    Parameter() { }
+
+    double latency_window = 0.05;                                          //> hold back time of samples in seconds
+    std::chrono::microseconds poll_period = std::chrono::microseconds(500); //> sleep time of worker if idle
+  };
+
+  SensorDataIngestion(Dispatcher dispatcher, const Parameter& parameter = Parameter());
+  SensorDataIngestion(const SensorDataIngestion&) = delete;
+  ~SensorDataIngestion();
+
+  SensorDataIngestion& operator=(const SensorDataIngestion&) = delete;
+
+  /**
+   * \brief Adds sensor data. Can be called concurrently from any thread and never blocks.
+   * \param sensor_data Sensor data that will be dispatched. Null pointers are ignored.
+   */
+  void push(std::shared_ptr<base::SensorData> sensor_data);
+  /**
+   * \brief Dispatches all samples that left the latency window in time stamp order. Must be called from one thread only.
+   * \return Number of dispatched samples.
+   */
+  std::size_t dispatch();
+  /**
+   * \brief Dispatches all received samples independent of the latency window, e.g. at end of a recording.
+   * \return Number of dispatched samples.
+   */
+  std::size_t flush();
+  /**
+   * \brief Starts a worker thread that dispatches continuously.
+   * \return false if the worker is already running.
+   */
+  bool start();
+  /**
+   * \brief Stops the worker thread. Samples still in the reorder buffer are kept.
+   */
+  void stop();
+  inline bool isRunning() const noexcept { return _running.load(); }
+
+  /**
+   * \brief Returns the number of samples dropped because they arrived after a newer sample was dispatched.
+   */
+  inline std::size_t numOfDroppedSamples() const noexcept { return _num_dropped.load(); }
+  /**
+   * \brief Returns the time stamp of the last dispatched sample.
+   */
+  inline double lastDispatchedTimeStamp() const noexcept { return _last_dispatched_time_stamp.load(); }
+
+private:
+  struct Sample
+  {
+    std::shared_ptr<base::SensorData> data;
+    std::size_t sequence; //> keeps receive order of samples with equal time stamps
+  };
+  struct LaterSample
+  {
+    bool operator()(const Sample& lhs, const Sample& rhs) const
+    {
+      const double lhs_time = lhs.data->timeStamp();
+      const double rhs_time = rhs.data->timeStamp();
+
+      return lhs_time > rhs_time || (lhs_time == rhs_time && lhs.sequence > rhs.sequence);
+    }
+  };
+
+  void receive();
+  std::size_t dispatchUntil(const double time_stamp);
+  void run();
+
+  const Dispatcher _dispatcher;
+  const Parameter _parameter;
+
+  base::MpscQueue<std::shared_ptr<base::SensorData>> _queue;
+  std::priority_queue<Sample, std::vector<Sample>, LaterSample> _reorder_buffer;
+  std::size_t _sequence = 0;
+  double _newest_time_stamp = std::numeric_limits<double>::lowest();
+  std::atomic<double> _last_dispatched_time_stamp{std::numeric_limits<double>::lowest()};
+  std::atomic<std::size_t> _num_dropped{0};
+
+  std::atomic<bool> _running{false};
+  std::thread _worker;
+};
+
+} // end namespace processing
+
+} // end namespace francor
@@ -59,6 +59,7 @@ Port& Port::operator=(Port&& origin)
   _data_flow = origin._data_flow;
   _data = origin._data;
   _data_type_info = origin._data_type_info;
+  _version = origin._version;
 
   // take all connections from origin
   for (auto& connection : origin._connections)
@@ -76,6 +77,7 @@ Port& Port::operator=(Port&& origin)
   origin._data_flow = Direction::NONE;
   origin._data = nullptr;
   origin._data_type_info = typeid(void);
+  origin._version = 0;
 
   return *this;
 }
@@ -227,6 +229,28 @@ std::size_t Port::numOfConnections(void) const
   return counter;
 }
 
+std::size_t Port::version(void) const
+{
+  // an input has no own data, so it represents the version of the connected output
+  if (_data_flow == Direction::IN)
+    return _connections[0] != nullptr ? _connections[0]->_version : 0;
+
+  return _version;
+}
+
+void Port::increaseVersion(void)
+{
+  if (_data_flow != Direction::OUT)
+  {
+    LogError() << "Port (name = " << this->name() << "): only an output can increase the version.";
+    return;
+  }
+
+  _version = ++_version_counter;
+}
+
+std::atomic<std::size_t> Port::_version_counter(0);
+
 std::size_t Port::nextConnectionIndex(void) const
 {
   for (std::size_t i = 0; i < _connections.size(); ++i)
@@ -0,0 +1,129 @@
+/**
+ * Asynchronous ingestion of sensor data. Sensor data is received from multiple producer threads and dispatched in
+ * time stamp order to a consumer, usually a processing pipeline.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_processing/sensor_data_ingestion.h"
+
+#include <francor_base/log.h>
+
+#include <algorithm>
+
+namespace francor {
+
+namespace processing {
+
+using francor::base::LogError;
+using francor::base::LogWarn;
+using francor::base::LogDebug;
+
+SensorDataIngestion::SensorDataIngestion(Dispatcher dispatcher, const Parameter& parameter)
+  : _dispatcher(std::move(dispatcher)),
+    _parameter(parameter)
+{
+
+}
+
+SensorDataIngestion::~SensorDataIngestion()
+{
+  this->stop();
+}
+
+void SensorDataIngestion::push(std::shared_ptr<base::SensorData> sensor_data)
+{
+  if (nullptr == sensor_data) {
+    return;
+  }
+
+  _queue.push(std::move(sensor_data));
+}
+
+std::size_t SensorDataIngestion::dispatch()
+{
+  this->receive();
+  return this->dispatchUntil(_newest_time_stamp - _parameter.latency_window);
+}
+
+std::size_t SensorDataIngestion::flush()
+{
+  this->receive();
+  return this->dispatchUntil(std::numeric_limits<double>::max());
+}
+
+bool SensorDataIngestion::start()
+{
+  if (_running.exchange(true)) {
+    LogError() << "SensorDataIngestion: worker is already running.";
+    return false;
+  }
+
+  _worker = std::thread(&SensorDataIngestion::run, this);
+  return true;
+}
+
+void SensorDataIngestion::stop()
+{
+  _running = false;
+
+  if (_worker.joinable()) {
+    _worker.join();
+  }
+}
+
+void SensorDataIngestion::receive()
+{
+  std::shared_ptr<base::SensorData> sensor_data;
+
+  while (_queue.pop(sensor_data)) {
+    const double time_stamp = sensor_data->timeStamp();
+
+    if (time_stamp < _last_dispatched_time_stamp.load()) {
+      LogWarn() << "SensorDataIngestion: sample of sensor " << sensor_data->sensorName() << " (time stamp = "
+                << time_stamp << ") arrived too late. Drop it.";
+      ++_num_dropped;
+      continue;
+    }
+
+    _newest_time_stamp = std::max(_newest_time_stamp, time_stamp);
+    _reorder_buffer.push({ std::move(sensor_data), _sequence++ });
+  }
+}
+
+std::size_t SensorDataIngestion::dispatchUntil(const double time_stamp)
+{
+  std::size_t num_dispatched = 0;
+
+  while (!_reorder_buffer.empty() && _reorder_buffer.top().data->timeStamp() <= time_stamp) {
+    const auto sensor_data = _reorder_buffer.top().data;
+    _reorder_buffer.pop();
+    _last_dispatched_time_stamp = sensor_data->timeStamp();
+
+    if (!_dispatcher(sensor_data)) {
+      LogError() << "SensorDataIngestion: dispatching of sample of sensor " << sensor_data->sensorName()
+                 << " (time stamp = " << sensor_data->timeStamp() << ") failed.";
+    }
+
+    ++num_dispatched;
+  }
+
+  return num_dispatched;
+}
+
+void SensorDataIngestion::run()
+{
+  LogDebug() << "SensorDataIngestion: worker started.";
+
+  while (_running) {
+    if (this->dispatch() == 0) {
+      std::this_thread::sleep_for(_parameter.poll_period);
+    }
+  }
+
+  LogDebug() << "SensorDataIngestion: worker stopped.";
+}
+
+} // end namespace processing
+
+} // end namespace francor
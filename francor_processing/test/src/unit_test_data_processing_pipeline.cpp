@@ -30,10 +30,13 @@ public:
   StageDummyIntToDouble() : ProcessingStage<NoDataType>("dummy int to double", COUNT_INPUTS, COUNT_OUTPUTS) { }
   ~StageDummyIntToDouble() = default;
 
+  std::size_t numOfProcessed() const { return _num_processed; }
+
 private:
   bool doProcess(NoDataType&) final
   {
     _value = static_cast<double>(this->getInputs()[0].data<int>());
+    ++_num_processed;
     return true;
   }
   bool doInitialization() final
@@ -51,6 +54,7 @@ private:
   bool isReady() const final { return this->input(0).numOfConnections() > 0; }
 
   double _value = 0.0;
+  std::size_t _num_processed = 0;
 };
 
 class Pipeline : public ProcessingPipeline<NoDataType, StageDummyIntToDouble>
@@ -58,6 +62,8 @@ class Pipeline : public ProcessingPipeline<NoDataType, StageDummyIntToDouble>
 public:
   Pipeline() : ProcessingPipeline<NoDataType, StageDummyIntToDouble>("pipeline", 1, 1) { }
 
+  StageDummyIntToDouble& stage() { return std::get<0>(_stages); }
+
 private:
   bool configureStages() final
   {
@@ -100,6 +106,41 @@ TEST(ProcssingPipeline, Process)
   EXPECT_EQ(pipeline.output("output").data<double>(), static_cast<double>(value));
 }
 
+TEST(ProcssingPipeline, ProcessWithResultCache)
+{
+  Pipeline pipeline;
+  int value = 8;
+
+  ASSERT_TRUE(pipeline.initialize());
+  pipeline.stage().enableResultCache();
+  pipeline.input("input").assign(&value);
+
+  // first run must process
+  EXPECT_TRUE(pipeline.process());
+  EXPECT_EQ(pipeline.stage().numOfProcessed(), 1);
+  const std::size_t output_version = pipeline.output("output").version();
+
+  // input is unchanged, so processing is skipped and output keeps its version
+  EXPECT_TRUE(pipeline.process());
+  EXPECT_EQ(pipeline.stage().numOfProcessed(), 1);
+  EXPECT_EQ(pipeline.output("output").version(), output_version);
+
+  // assigning new data to input invalidates result
+  value = 9;
+  pipeline.input("input").assign(&value);
+
+  EXPECT_TRUE(pipeline.process());
+  EXPECT_EQ(pipeline.stage().numOfProcessed(), 2);
+  EXPECT_NE(pipeline.output("output").version(), output_version);
+  EXPECT_EQ(pipeline.output("output").data<double>(), static_cast<double>(value));
+
+  // without caching each run processes
+  pipeline.stage().enableResultCache(false);
+
+  EXPECT_TRUE(pipeline.process());
+  EXPECT_EQ(pipeline.stage().numOfProcessed(), 3);
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
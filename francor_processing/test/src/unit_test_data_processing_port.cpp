@@ -280,6 +280,39 @@ TEST(Port, MoveConnetions)
   }
 }
 
+TEST(Port, Version)
+{
+  int data = 0;
+  Port output("output", Port::Direction::OUT, &data);
+  Port input("input", Port::Direction::IN, static_cast<int*>(nullptr));
+
+  // not connected input and not written output have no version
+  EXPECT_EQ(output.version(), 0);
+  EXPECT_EQ(input.version(), 0);
+
+  // each write results in a new version
+  output.increaseVersion();
+  const std::size_t first_version = output.version();
+  output.increaseVersion();
+
+  EXPECT_NE(first_version, 0);
+  EXPECT_NE(output.version(), first_version);
+
+  // input represents version of connected output
+  ASSERT_TRUE(input.connect(output));
+  EXPECT_EQ(input.version(), output.version());
+
+  // input can't increase version
+  const std::size_t version = input.version();
+  input.increaseVersion();
+  EXPECT_EQ(input.version(), version);
+
+  // versions are unique over all ports
+  Port other("other", Port::Direction::OUT, &data);
+  other.increaseVersion();
+  EXPECT_NE(other.version(), output.version());
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
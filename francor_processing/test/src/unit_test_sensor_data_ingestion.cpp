@@ -0,0 +1,118 @@
+/**
+ * Unit test for the sensor data ingestion.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_processing/sensor_data_ingestion.h"
+
+#include <thread>
+#include <vector>
+
+using francor::processing::SensorDataIngestion;
+using francor::base::SensorData;
+
+class DummySensorData : public SensorData
+{
+public:
+  DummySensorData(char const* const sensor_name, const double time_stamp) : SensorData(sensor_name, time_stamp) { }
+};
+
+class SensorDataIngestionTest : public ::testing::Test
+{
+protected:
+  SensorDataIngestion::Dispatcher dispatcher()
+  {
+    return [this] (const std::shared_ptr<SensorData>& sensor_data) {
+      _received.push_back(sensor_data->timeStamp());
+      return true;
+    };
+  }
+
+  std::vector<double> _received;
+};
+
+TEST_F(SensorDataIngestionTest, DispatchInTimeStampOrder)
+{
+  SensorDataIngestion::Parameter parameter;
+  parameter.latency_window = 0.1;
+  SensorDataIngestion ingestion(this->dispatcher(), parameter);
+
+  ingestion.push(std::make_shared<DummySensorData>("odometry", 1.00));
+  ingestion.push(std::make_shared<DummySensorData>("lidar", 0.98));
+  ingestion.push(std::make_shared<DummySensorData>("odometry", 1.01));
+  ingestion.push(nullptr);
+
+  // all samples are inside latency window
+  EXPECT_EQ(0u, ingestion.dispatch());
+
+  ingestion.push(std::make_shared<DummySensorData>("odometry", 1.10));
+
+  // samples up to 1.00 left the window
+  EXPECT_EQ(2u, ingestion.dispatch());
+  ASSERT_EQ(2u, _received.size());
+  EXPECT_EQ(0.98, _received[0]);
+  EXPECT_EQ(1.00, _received[1]);
+
+  // remaining ones are dispatched on flush
+  EXPECT_EQ(2u, ingestion.flush());
+  ASSERT_EQ(4u, _received.size());
+  EXPECT_EQ(1.01, _received[2]);
+  EXPECT_EQ(1.10, _received[3]);
+  EXPECT_EQ(1.10, ingestion.lastDispatchedTimeStamp());
+}
+
+TEST_F(SensorDataIngestionTest, DropLateSamples)
+{
+  SensorDataIngestion ingestion(this->dispatcher());
+
+  ingestion.push(std::make_shared<DummySensorData>("lidar", 2.0));
+  ingestion.flush();
+
+  // older than last dispatched sample
+  ingestion.push(std::make_shared<DummySensorData>("odometry", 1.0));
+  EXPECT_EQ(0u, ingestion.flush());
+  EXPECT_EQ(1u, ingestion.numOfDroppedSamples());
+  EXPECT_EQ(1u, _received.size());
+}
+
+TEST_F(SensorDataIngestionTest, MultipleProducersWithWorker)
+{
+  constexpr std::size_t num_samples = 1000;
+  SensorDataIngestion::Parameter parameter;
+  parameter.latency_window = 1e9; // hold back everything until flush
+  SensorDataIngestion ingestion(this->dispatcher(), parameter);
+
+  ASSERT_TRUE(ingestion.start());
+  EXPECT_TRUE(ingestion.isRunning());
+  EXPECT_FALSE(ingestion.start());
+
+  auto producer = [&ingestion] (char const* const name, const double offset) {
+    for (std::size_t i = 0; i < num_samples; ++i) {
+      ingestion.push(std::make_shared<DummySensorData>(name, static_cast<double>(i) + offset));
+    }
+  };
+  std::thread odometry(producer, "odometry", 0.0);
+  std::thread lidar(producer, "lidar", 0.5);
+
+  odometry.join();
+  lidar.join();
+  ingestion.stop();
+
+  EXPECT_FALSE(ingestion.isRunning());
+  ingestion.flush();
+
+  ASSERT_EQ(2u * num_samples, _received.size());
+
+  for (std::size_t i = 1; i < _received.size(); ++i) {
+    EXPECT_LE(_received[i - 1], _received[i]);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
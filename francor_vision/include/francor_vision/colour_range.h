@@ -0,0 +1,53 @@
+/**
+ * Defines colour ranges in HSV colour space and a fused kernel that converts a coloured image pixel by pixel to HSV and
+ * masks all pixels inside of the ranges in one pass.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include "francor_vision/image_view.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace francor
+{
+
+namespace vision
+{
+
+/**
+ * \brief Range in HSV colour space. The bounds are inclusive, the hue is in [0, 180) like in opencv.
+ */
+struct ColourRange
+{
+  std::uint8_t min_h = 0;
+  std::uint8_t max_h = 0;
+  std::uint8_t min_s = 0;
+  std::uint8_t max_s = 0;
+  std::uint8_t min_v = 0;
+  std::uint8_t max_v = 0;
+};
+
+/**
+ * \brief Sets each pixel of the mask to 255 whose colour is inside of at least one of the given ranges. Pixels of the
+ *        mask that are already set are kept. BGR and RGB images are converted to HSV on the fly (bit exact to
+ *        cv::cvtColor()), so no converted copy of the image is created and the image is read only once.
+ *
+ * \param image Input image in colour space BGR, RGB or HSV.
+ * \param ranges Colour ranges in HSV colour space.
+ * \param mask Bit mask of the same size as image.
+ * \return true if the mask was successfully updated.
+ */
+bool maskColourRanges(const ConstImageView& image, const std::vector<ColourRange>& ranges, const ImageView& mask);
+
+/**
+ * \brief Same as above, but for a single range.
+ */
+bool maskColourRanges(const ConstImageView& image, const ColourRange& range, const ImageView& mask);
+
+} // end namespace vision
+
+} // end namespace francor
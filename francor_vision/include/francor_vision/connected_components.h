@@ -0,0 +1,156 @@
+/**
+ * Defines a labeller that finds the 8-connected components of a bit mask. It labels the mask in one pass with a union
+ * find structure and writes the statistics of the components (and optionally their outer contours) into flat arrays.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include "francor_vision/image_view.h"
+
+#include <francor_base/point.h>
+#include <francor_base/rect.h>
+#include <francor_base/span.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace francor
+{
+
+namespace vision
+{
+
+/**
+ * \brief Statistics of one connected component. The x coordinate is the column, the y coordinate the row.
+ */
+struct ComponentStatistics
+{
+  std::size_t num_pixels = 0;                    //> number of pixels of the component
+  base::Rectu bounding_box{ 0, 0, 0, 0 };        //> smallest rectangle that contains all pixels
+  base::Point2d centroid;                        //> mean of all pixel coordinates
+  base::Point2<unsigned int> first_pixel;        //> first pixel in row major order, it is the start of the contour
+};
+
+class ConnectedComponents
+{
+public:
+  using Label = std::uint32_t;
+  using ContourPoint = base::Point2<unsigned int>;
+
+  ConnectedComponents(void) = default;
+  ConnectedComponents(const ConnectedComponents&) = default;
+  ConnectedComponents(ConnectedComponents&&) = default;
+  ~ConnectedComponents(void) = default;
+
+  ConnectedComponents& operator=(const ConnectedComponents&) = default;
+  ConnectedComponents& operator=(ConnectedComponents&&) = default;
+
+  /**
+   * \brief Labels all 8-connected components of the given bit mask. The mask is split into horizontal bands that are
+   *        labelled in parallel, the bands are merged afterwards. The components are numbered in the row major order
+   *        of their first pixel, independent of the number of bands.
+   *
+   * \param mask Bit mask, each pixel that isn't zero belongs to a component.
+   * \return true if the mask was successfully labelled.
+   */
+  bool operator()(const ConstImageView& mask);
+
+  /**
+   * \brief Enables the tracing of the outer contour of each component. Disabled by default.
+   */
+  inline void setContourExtraction(const bool enable) noexcept { extract_contours_ = enable; }
+  inline bool isContourExtractionEnabled(void) const noexcept { return extract_contours_; }
+
+  /**
+   * \brief Returns the number of found components.
+   */
+  inline std::size_t numOfComponents(void) const noexcept { return components_.size(); }
+  /**
+   * \brief Returns the statistics of all found components. Component i has label i + 1.
+   */
+  inline const std::vector<ComponentStatistics>& components(void) const noexcept { return components_; }
+  /**
+   * \brief Returns the label of each pixel in row major order. Zero means background.
+   */
+  inline const std::vector<Label>& labels(void) const noexcept { return labels_; }
+  inline Label label(const std::size_t row, const std::size_t col) const noexcept { return labels_[row * cols_ + col]; }
+
+  /**
+   * \brief Returns the contour points of all components in one array. The points of component i are in range
+   *        [contourOffsets()[i], contourOffsets()[i + 1]). Empty if the contour extraction is disabled.
+   */
+  inline const std::vector<ContourPoint>& contourPoints(void) const noexcept { return contour_points_; }
+  inline const std::vector<std::size_t>& contourOffsets(void) const noexcept { return contour_offsets_; }
+  /**
+   * \brief Returns the outer contour of the given component. The points are ordered clockwise, starting at the first
+   *        pixel of the component.
+   */
+  inline base::Span<const ContourPoint> contour(const std::size_t component) const noexcept
+  {
+    return { contour_points_.data() + contour_offsets_[component],
+             contour_offsets_[component + 1] - contour_offsets_[component] };
+  }
+
+private:
+  void labelBand(const ConstImageView& mask, const std::size_t band);
+  void mergeBandBorder(const std::size_t row);
+  void traceContour(const ComponentStatistics& component, const Label label);
+  inline Label firstLabelOfBand(const std::size_t band) const noexcept
+  {
+    // a new label is only created if the left neighbour is background, so a row can't have more than (cols + 1) / 2
+    return static_cast<Label>(band_begin_[band] * ((cols_ + 1) / 2) + 1);
+  }
+
+  inline Label findRoot(Label label) noexcept
+  {
+    Label root = label;
+
+    while (parent_[root] != root)
+      root = parent_[root];
+
+    // path compression
+    while (parent_[label] != root)
+    {
+      const Label next = parent_[label];
+      parent_[label] = root;
+      label = next;
+    }
+
+    return root;
+  }
+  inline Label unite(const Label a, const Label b) noexcept
+  {
+    const Label rootA = this->findRoot(a);
+    const Label rootB = this->findRoot(b);
+
+    // the smaller label stays root, so the first label of a component in row major order is its root
+    if (rootA < rootB)
+    {
+      parent_[rootB] = rootA;
+      return rootA;
+    }
+
+    parent_[rootA] = rootB;
+    return rootB;
+  }
+
+  bool extract_contours_ = false;
+  std::size_t rows_ = 0;
+  std::size_t cols_ = 0;
+
+  std::vector<Label> labels_;
+  std::vector<Label> parent_;                    //> union find forest over the provisional labels
+  std::vector<std::size_t> band_begin_;          //> first row of each band and the number of rows at the end
+  std::vector<Label> band_num_labels_;           //> number of provisional labels used by each band
+
+  std::vector<ComponentStatistics> components_;
+  std::vector<ContourPoint> contour_points_;
+  std::vector<std::size_t> contour_offsets_;
+};
+
+} // end namespace vision
+
+} // end namespace francor
@@ -7,7 +7,11 @@
 #pragma once
 
 #include "francor_vision/pixel.h"
+#include "francor_vision/image_view.h"
+#include "francor_vision/typed_image_view.h"
+#include "francor_vision/image_pool.h"
 
+#include <memory>
 #include <vector>
 
 #include <opencv2/opencv.hpp>
@@ -35,6 +39,22 @@ public:
    */
   Image(const std::size_t rows, const std::size_t cols, const ColourSpace space);
 
+  /**
+   * \brief Constructs a image with the given rows, cols and colour space. The image is attached to the given pool and
+   *        its buffer is taken from it.
+   * \param rows Number of rows of the construced image.
+   * \param cols Number of cols of the construced image.
+   * \param space The colour space of the construced image.
+   * \param pool Pool the image buffers are drawn from.
+   */
+  Image(const std::size_t rows, const std::size_t cols, const ColourSpace space, std::shared_ptr<ImagePool> pool);
+
+  /**
+   * \brief Constructs an empty image that is attached to the given pool.
+   * \param pool Pool the image buffers are drawn from.
+   */
+  explicit Image(std::shared_ptr<ImagePool> pool) : pool_(std::move(pool)) { }
+
   /**
    * \brief Constructs a image from a cv::Mat. The colour space must be given. The cv::Mat image data will be copied.
    * \param mat Original image. The data are copied from the original image.
@@ -49,6 +69,13 @@ public:
    */
   Image(cv::Mat&& mat, const ColourSpace space);
 
+  /**
+   * \brief Constructs a image from a view. The data of the view are copied, so the new image doesn't depend on the
+   *        viewed image.
+   * \param view The data of the view are copied.
+   */
+  explicit Image(const ConstImageView& view);
+
   /**
    * \brief Constructs a copy of the given image. Corrects the copy contructor of cv::Mat, because it is actually 
    *        like a shared pointer.
@@ -57,18 +84,17 @@ public:
   Image(const Image& image);
 
   Image(const Image& image, const ColourSpace space)
+    : pool_(image.pool_)
   {
-    *this = image;
-    this->transformTo(space);
+    this->convertFrom(image, space);
   }
 
   /**
-   * \brief Move constructor. Corrects the copy contructor of cv::Mat, because it is actually like a shared pointer.
-   *        This constructor releases the data from the origin image.
+   * \brief Move constructor. Takes over the data of the origin image. No data are copied.
    * 
-   * \param image origin image. After the origin is moved the contained data are released.
+   * \param image origin image. After the origin is moved it is empty.
    */
-  Image(Image&& image);
+  Image(Image&& image) noexcept;
 
   /**
    * \brief Destructor.
@@ -84,13 +110,13 @@ public:
   Image& operator=(const Image& image);
 
   /**
-   * \brief Move assignment operator. Corrects the copy assignment operator of cv::Mat, because it is actually like a shared
-   *        pointer. This constructor releases the data from the origin image.
+   * \brief Move assignment operator. Takes over the data of the origin image. No data are copied. The former data of
+   *        this image are released.
    * 
-   * \param image Origin image that will be moved.
+   * \param image Origin image that will be moved. After the origin is moved it is empty.
    * \return a reference to this image.
    */
-  Image& operator=(Image&& image);
+  Image& operator=(Image&& image) noexcept;
 
   /**
    * Returns the current colour space of this image.
@@ -106,7 +132,7 @@ public:
    * \param col
    * \return pixel that contains references to the data
    */
-  inline Pixel operator()(const std::size_t row, const std::size_t col) { return { data_ + (row * stride_ + col * Image::solveBytesPerPixel(colour_space_)), colour_space_ }; }
+  inline Pixel operator()(const std::size_t row, const std::size_t col) { return { data_ + (row * stride_ + col * numOfBytesPerPixel(colour_space_)), colour_space_ }; }
 
   /**
    * \brief Returns the const pixel at (row, col).
@@ -115,7 +141,7 @@ public:
    * \param col
    * \return pixel that contains const references to the data
    */
-  inline ConstPixel operator()(const std::size_t row, const std::size_t col) const { return { data_ + (row * stride_ + col * Image::solveBytesPerPixel(colour_space_)), colour_space_ }; }
+  inline ConstPixel operator()(const std::size_t row, const std::size_t col) const { return { data_ + (row * stride_ + col * numOfBytesPerPixel(colour_space_)), colour_space_ }; }
   
   /**
    * \brief Return the number of rows of this image.
@@ -138,6 +164,40 @@ public:
    */
   inline cv::Mat cvMat(void) const { return data_source_; }
 
+  /**
+   * \brief Returns a view on the data of this image. No data are copied. The view is valid as long as this image isn't
+   *        resized, cleared or destroyed.
+   * 
+   * \return view on the whole image
+   */
+  inline ImageView view(void) { return { data_, rows_, cols_, stride_, colour_space_ }; }
+
+  /**
+   * \brief Returns a const view on the data of this image. No data are copied. The view is valid as long as this image
+   *        isn't resized, cleared or destroyed.
+   * 
+   * \return const view on the whole image
+   */
+  inline ConstImageView view(void) const { return { data_, rows_, cols_, stride_, colour_space_ }; }
+
+  /**
+   * \brief Returns a view with the colour space as template argument. It gives access to the pixels without runtime
+   *        dispatch on the colour space. If the colour space of this image doesn't match the view is empty.
+   * 
+   * \return typed view on the whole image
+   */
+  template <ColourSpace Space>
+  inline TypedImageView<Space> typedView(void) { return { this->view() }; }
+
+  /**
+   * \brief Returns a const view with the colour space as template argument. If the colour space of this image doesn't
+   *        match the view is empty.
+   * 
+   * \return typed const view on the whole image
+   */
+  template <ColourSpace Space>
+  inline ConstTypedImageView<Space> typedView(void) const { return { this->view() }; }
+
   /**
    * \brief Gets a refernce to the data of a cv::Mat. The cv::Mat uses internally shared memory. The reference counter of the data will be incremented. No data are copied.
    * 
@@ -177,89 +237,37 @@ public:
    */
   void applyMask(const Image& mask);
 
-  // TODO: complete the implementation 
-  bool transformTo(const ColourSpace space)
-  {
-    cv::Mat mat(this->cvMat());
-
-    switch (colour_space_)
-    {
-    case ColourSpace::BGR:
-      {
-        switch (space)
-        {
-        case ColourSpace::GRAY:
-          cv::cvtColor(mat, mat, cv::COLOR_BGR2GRAY);
-          break;
-
-        case ColourSpace::HSV:
-          cv::cvtColor(mat, mat, cv::COLOR_BGR2HSV);
-          break;
-
-        case ColourSpace::RGB:
-          cv::cvtColor(mat, mat, cv::COLOR_BGR2RGB);
-          break;
-
-        default:
-          return false;
-        }
-      }
-
-      break;
-
-    case ColourSpace::RGB:
-      {
-        switch (space)
-        {
-        case ColourSpace::GRAY:
-          cv::cvtColor(mat, mat, cv::COLOR_RGB2GRAY);
-          break;
-
-        case ColourSpace::HSV:
-          cv::cvtColor(mat, mat, cv::COLOR_RGB2HSV);
-          break;
-
-        case ColourSpace::BGR:
-          cv::cvtColor(mat, mat, cv::COLOR_RGB2BGR);
-          break;
-
-        default:
-          return false;
-        }
-      }
-
-      break;
-
-    case ColourSpace::GRAY:
-      {
-        switch (space)
-        {
-        case ColourSpace::RGB:
-          cv::cvtColor(mat, mat, cv::COLOR_GRAY2RGB);
-          break;
-        
-        case ColourSpace::BGR:
-          cv::cvtColor(mat, mat, cv::COLOR_GRAY2BGR);
-          break;
-
-        default:
-          break;
-        }
-      }
-
-      break;
-
-    // TODO: add implementation for HSV and GRAY, too 
-
-    default:
-      return false;
-    }
-
-    // read back the image attributes
-    this->fromCvMat(mat, space);
-
-    return true;
-  }
+  /**
+   * \brief Transforms this image into the given colour space. If this image is attached to a pool the transformed
+   *        image is drawn from it.
+   *
+   * \param space Target colour space.
+   * \return true if the transformation is supported and was successful.
+   */
+  bool transformTo(const ColourSpace space);
+
+  /**
+   * \brief Stores the given image transformed into the given colour space in this image. The buffer of this image is
+   *        reused if it has already the required size.
+   *
+   * \param image Source image.
+   * \param space Target colour space.
+   * \return true if the transformation is supported and was successful.
+   */
+  bool convertFrom(const Image& image, const ColourSpace space);
+
+  /**
+   * \brief Attaches this image to a buffer pool. From now on resizing takes buffers from the pool and gives the former
+   *        buffer back to it. The cv::Mat returned by cvMat() doesn't keep a pooled buffer alive.
+   *
+   * \param pool The pool. nullptr detaches the image, the current buffer is kept until the next resize.
+   */
+  void setPool(std::shared_ptr<ImagePool> pool) { pool_ = std::move(pool); }
+
+  /**
+   * \brief Returns the pool this image is attached to or nullptr.
+   */
+  inline const std::shared_ptr<ImagePool>& pool(void) const noexcept { return pool_; }
 
   /**
    * \brief Creates a image with the given size and colour space and initialize it with zeros.
@@ -267,9 +275,11 @@ public:
    * \param rows The number of rows of the image.
    * \param cols The number of cols of the image.
    * \param space The colour space of the image.
+   * \param pool If given the image is attached to this pool and its buffer is drawn from it.
    * \return New allocated image if no error was occurred otherwise an empty image.
    */
-  static Image zeros(const std::size_t rows, const std::size_t cols, const ColourSpace space);
+  static Image zeros(const std::size_t rows, const std::size_t cols, const ColourSpace space,
+                     std::shared_ptr<ImagePool> pool = nullptr);
 
 private:
 
@@ -282,6 +292,14 @@ private:
 
   static std::size_t solveBytesPerPixel(const ColourSpace space);
 
+  /**
+   * \brief Returns the opencv conversion code between the colour spaces or -1 if the conversion isn't supported.
+   */
+  static int solveConversionCode(const ColourSpace from, const ColourSpace to);
+
+  void takeBufferFromPool(const std::size_t rows, const std::size_t cols, const ColourSpace space);
+  void releaseUnusedBuffer(void);
+
   // members
   ColourSpace colour_space_ = ColourSpace::NONE;
 
@@ -291,6 +309,9 @@ private:
   std::size_t stride_ = 0;
   std::size_t rows_ = 0;
   std::size_t cols_ = 0;
+
+  std::shared_ptr<ImagePool> pool_; // if set, the buffers are taken from this pool
+  ImagePool::Buffer buffer_;        // pooled buffer the data_source_ refers to
 };
 
 } // end namespace vision
@@ -28,6 +28,12 @@ public:
   ColourSpace requiredColourSpace(void) const { return required_colour_space_; }
   virtual bool isValid(void) const = 0;
 
+  /**
+   * \brief Returns the number of rows above and below a pixel the filter reads to calculate the pixel. If an image is
+   *        processed in horizontal bands, each band is extended by this number of halo rows.
+   */
+  virtual std::size_t neighbourhoodRadius(void) const { return 0; }
+
 private:
   ColourSpace required_colour_space_;
 };
@@ -50,8 +56,46 @@ public:
     return this->processImpl(input, output);    
   }
 
+  /**
+   * \brief Returns true if the filter can process horizontal bands of an image (see processBand()).
+   */
+  virtual bool isBandProcessingSupported(void) const { return false; }
+
+  /**
+   * \brief Returns the colour space of the output image.
+   */
+  virtual ColourSpace outputColourSpace(void) const { return this->requiredColourSpace(); }
+
+  /**
+   * \brief Processes a horizontal band of an image. The bands can be processed in parallel, so the implementation must
+   *        be thread safe.
+   *
+   * \param input Input rows including the halo rows above and below the band. Rows outside of the input view are
+   *              outside of the image and have to be treated like the border rows.
+   * \param first_row Row of input that corresponds to the first row of output.
+   * \param output Output rows of the band. It has the width of input and the colour space outputColourSpace().
+   * \return true if the band was processed successfully.
+   */
+  bool processBand(const ConstImageView& input, const std::size_t first_row, const ImageView& output) const
+  {
+    if (input.colourSpace() != this->requiredColourSpace()
+        ||
+        output.colourSpace() != this->outputColourSpace()
+        ||
+        input.cols() != output.cols()
+        ||
+        first_row + output.rows() > input.rows())
+    {
+      // TODO: print error
+      return false;
+    }
+
+    return this->processBandImpl(input, first_row, output);
+  }
+
 protected:
   virtual bool processImpl(const Image& input, Image& output) const = 0;
+  virtual bool processBandImpl(const ConstImageView&, const std::size_t, const ImageView&) const { return false; }
 
 private:
   bool safetyCheck(const Image& image) const
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "francor_vision/image_filter.h"
+#include "francor_vision/colour_range.h"
 
 namespace francor {
 
@@ -43,17 +44,25 @@ public:
       return false;
     }
 
-    // work on opencv mat
-    cv::Mat tempMask(mask.cvMat());
-    cv::Mat resultMask;
+    // works in place on the mask, so the mask isn't reallocated
+    return maskColourRanges(image.view(), this->colourRange(), mask.view());
+  }
 
-    cv::inRange(image.cvMat(), cv::Scalar(min_h_, min_s_, min_v_), cv::Scalar(max_h_, max_s_, max_v_), resultMask);
-    cv::bitwise_or(tempMask, resultMask, tempMask);
+  /**
+   * \brief Returns the HSV range of this filter.
+   */
+  ColourRange colourRange(void) const
+  {
+    ColourRange range;
 
-    // actually if tempMask wasn't reallocated there is no reason to use fromCvMat(), but we don't really know it
-    mask.fromCvMat(tempMask, mask.colourSpace());
+    range.min_h = min_h_;
+    range.max_h = max_h_;
+    range.min_s = min_s_;
+    range.max_s = max_s_;
+    range.min_v = min_v_;
+    range.max_v = max_v_;
 
-    return true;
+    return range;
   }
 
   virtual bool isValid(void) const override final
@@ -7,8 +7,16 @@
 #pragma once
 
 #include "francor_vision/image_filter.h"
+#include "francor_vision/image_filter_criteria.h"
 
+#include <francor_base/buffer_pool.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace francor
 {
@@ -70,6 +78,11 @@ public:
 
   std::size_t numOfFilters(void) const noexcept { return filter_.size(); }
 
+  /**
+   * \brief Returns the pool the images of this pipeline are drawn from.
+   */
+  const std::shared_ptr<ImagePool>& pool(void) const noexcept { return pool_; }
+
 protected:
   std::map<ColourSpace, std::shared_ptr<Image>> createRequiredImages(const Image& image) const
   {
@@ -81,12 +94,16 @@ protected:
       if (it.first == image.colourSpace())
         continue;
 
-      it.second = std::make_shared<Image>(image, it.first);
+      // the converted images are drawn from the pool, so their buffers are reused from frame to frame; if the
+      // conversion isn't supported the image stays empty and is rejected by the filter
+      it.second = std::make_shared<Image>(pool_);
+      it.second->convertFrom(image, it.first);
     }
 
     return images;
   }
 
+  std::shared_ptr<ImagePool> pool_ = std::make_shared<ImagePool>();
   std::map<ColourSpace, std::shared_ptr<Image>> required_images_;
   std::vector<std::pair<const std::string, std::unique_ptr<const T>>> filter_;
 };
@@ -99,6 +116,10 @@ public:
 
   bool operator()(const Image& input, Image& output) const
   {
+    // the bands are written directly into the output, so it must not be the input
+    if (&input != &output && this->isBandProcessingSupported() && input.rows() > 0)
+      return this->processInBands(input, output);
+
     const Image* image = &input;
 
     for (auto& filter : filter_)
@@ -120,6 +141,50 @@ public:
 
     return true;
   }
+
+  /**
+   * \brief Returns true if the images are processed in horizontal bands. That is the case if all filters support it.
+   */
+  bool isBandProcessingSupported(void) const
+  {
+    if (filter_.empty())
+      return false;
+
+    for (auto& filter : filter_)
+      if (!filter.second->isBandProcessingSupported())
+        return false;
+
+    return true;
+  }
+
+  /**
+   * \brief Sets the number of bytes one band may use over all filter stages, including the input and the output rows.
+   *        It should fit into the L2 cache, so the intermediate images of a band don't have to be fetched from memory.
+   */
+  void setBandSize(const std::size_t bytes) { band_size_ = bytes; }
+  std::size_t bandSize(void) const noexcept { return band_size_; }
+  /**
+   * \brief Returns the pool the buffers of the intermediate band stages are drawn from.
+   */
+  const std::shared_ptr<base::BufferPool<std::vector<std::uint8_t>>>& bandBuffers(void) const noexcept
+  {
+    return band_buffers_;
+  }
+
+private:
+  /**
+   * \brief Splits the image into horizontal bands and runs the whole filter chain band by band. The bands are
+   *        processed in parallel (see base::parallelFor()). Each thread takes the buffer for the intermediate stages
+   *        of its bands from band_buffers_, so the buffers are allocated once and reused over the frames.
+   *
+   *        Only the scheduling is in place yet: no filter of this library implements processBandImpl(), so the
+   *        pipelines built from them still run on the whole frame.
+   */
+  bool processInBands(const Image& input, Image& output) const;
+
+  std::size_t band_size_ = 256 * 1024;
+  std::shared_ptr<base::BufferPool<std::vector<std::uint8_t>>> band_buffers_
+    = std::make_shared<base::BufferPool<std::vector<std::uint8_t>>>();
 };
 
 class ImageMaskFilterPipeline : public ImageFilterPipeline_<ImageMaskFilter>
@@ -128,15 +193,44 @@ public:
   ImageMaskFilterPipeline(void) = default;
   virtual ~ImageMaskFilterPipeline(void) = default;
 
+  bool addFilter(const std::string& name, std::unique_ptr<const ImageMaskFilter> filter)
+  {
+    // colour range filters are collected, so they can be fused into one pass
+    const auto colourRangeFilter = dynamic_cast<const ImageMaskFilterColourRange*>(filter.get());
+
+    if (!ImageFilterPipeline_<ImageMaskFilter>::addFilter(name, std::move(filter)))
+      return false;
+
+    if (colourRangeFilter != nullptr)
+      colour_ranges_.push_back(colourRangeFilter->colourRange());
+
+    return true;
+  }
+
   bool operator()(const Image& image, Image& mask) const
   {
-    // prepare mask for filter operations even there is no filter added
-    mask = std::move(Image::zeros(image.rows(), image.cols(), ColourSpace::BIT_MASK));
+    // prepare mask for filter operations even there is no filter added, the buffer of the mask is reused if it has
+    // already the right size
+    mask.resize(image.rows(), image.cols(), ColourSpace::BIT_MASK);
+    mask.cvMat().setTo(cv::Scalar(0));
 
     // return if there is no filter added otherwise the required images access is not initialized properly
     if (filter_.size() == 0)
       return true;
 
+    // if all filters are colour ranges they are evaluated in one pass on the input image, the conversion to HSV is done
+    // on the fly
+    if (colour_ranges_.size() == filter_.size()
+        &&
+        (image.colourSpace() == ColourSpace::BGR
+         ||
+         image.colourSpace() == ColourSpace::RGB
+         ||
+         image.colourSpace() == ColourSpace::HSV))
+    {
+      return maskColourRanges(image.view(), colour_ranges_, mask.view());
+    }
+
     auto requiredImages(this->createRequiredImages(image));
 
     for (auto& filter : filter_)
@@ -163,6 +257,9 @@ public:
 
     return true;
   }
+
+private:
+  std::vector<ColourRange> colour_ranges_;
 };
 
 } // end namespace vision
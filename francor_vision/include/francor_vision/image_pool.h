@@ -0,0 +1,71 @@
+/**
+ * Defines a pool of image buffers. Images that are attached to a pool take their pixel buffers from it and give them
+ * back if they are resized, cleared or destroyed, so a pipeline that processes images of the same size frame by frame
+ * doesn't allocate new buffers.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include "francor_vision/colour_space.h"
+
+#include <francor_base/buffer_pool.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace francor
+{
+
+namespace vision
+{
+
+class ImagePool
+{
+public:
+  using Buffer = base::BufferHandle<std::vector<std::uint8_t>>;
+
+  ImagePool(void) = default;
+  ImagePool(const ImagePool&) = delete;
+  ImagePool(ImagePool&&) = delete;
+  ~ImagePool(void) = default;
+
+  ImagePool& operator=(const ImagePool&) = delete;
+  ImagePool& operator=(ImagePool&&) = delete;
+
+  /**
+   * \brief Acquires a buffer for an image of the given size and colour space. The buffer is continuous, its stride is
+   *        cols times the bytes per pixel. It goes back to this pool when the last handle is released.
+   *
+   * \param rows Number of rows of the image.
+   * \param cols Number of columns of the image.
+   * \param space Colour space of the image.
+   * \return Handle to the buffer.
+   */
+  Buffer acquire(const std::size_t rows, const std::size_t cols, const ColourSpace space);
+
+  /**
+   * \brief Returns the number of buffers owned by this pool, used or not.
+   */
+  std::size_t numOfBuffers(void) const;
+
+  /**
+   * \brief Returns the number of buffers that are currently not in use.
+   */
+  std::size_t numOfAvailable(void) const;
+
+private:
+  using Key = std::tuple<std::size_t, std::size_t, ColourSpace>;
+
+  mutable std::mutex mutex_;
+  std::map<Key, base::BufferPool<std::vector<std::uint8_t>>> pools_;
+};
+
+} // end namespace vision
+
+} // end namespace francor
@@ -13,8 +13,14 @@
 #include <francor_processing/data_processing_pipeline_stage.h>
 
 #include "francor_vision/image.h"
+#include "francor_vision/connected_components.h"
 #include "francor_vision/image_filter_pipeline.h"
 #include "francor_vision/image_filter_criteria.h"
+#include "francor_vision/image_sequence.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
 
 namespace francor
 {
@@ -27,7 +33,10 @@ class ExportClusteredPointsFromBitMask : public processing::ProcessingStage<NoDa
 {
 public:
   ExportClusteredPointsFromBitMask(void)
-    : processing::ProcessingStage<NoDataType>("export clustered points from bit mask", 1, 1) {  }
+    : processing::ProcessingStage<NoDataType>("export clustered points from bit mask", 1, 2)
+  {
+    _labeller.setContourExtraction(true);
+  }
   ~ExportClusteredPointsFromBitMask(void) = default;
 
   bool doProcess(NoDataType&) final
@@ -39,22 +48,25 @@ public:
       return false;
     }
 
-    // find contours using opencv function
-    std::vector<std::vector<cv::Point2i>> foundClusters;
-
-    cv::findContours(this->getInputs()[0].data<Image>().cvMat(), foundClusters, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE);
+    // label connected components and trace their outer contours in one go
+    if (!_labeller(this->getInputs()[0].data<Image>().view()))
+    {
+      //TODO: print error
+      return false;
+    }
 
-    // copy data to francor data types
-    _clustered_points.resize(foundClusters.size());
+    // copy contours to francor data types, the buffers of the clusters are kept over frames
+    _clustered_points.resize(_labeller.numOfComponents());
     
-    for (std::size_t cluster = 0; cluster < foundClusters.size(); ++cluster)
+    for (std::size_t cluster = 0; cluster < _clustered_points.size(); ++cluster)
     {
-      _clustered_points[cluster].resize(foundClusters[cluster].size());
+      const auto contour = _labeller.contour(cluster);
+      _clustered_points[cluster].resize(contour.size());
 
-      for (std::size_t point = 0; point < _clustered_points[cluster].size(); ++point)
+      for (std::size_t point = 0; point < contour.size(); ++point)
       {
-        _clustered_points[cluster][point].x() = static_cast<double>(foundClusters[cluster][point].x);
-        _clustered_points[cluster][point].y() = static_cast<double>(foundClusters[cluster][point].y);
+        _clustered_points[cluster][point].x() = static_cast<double>(contour[point].x());
+        _clustered_points[cluster][point].y() = static_cast<double>(contour[point].y());
       }
     }
 
@@ -73,6 +85,7 @@ private:
   {
     this->initializeInputPort<Image>(0, "bit mask");
     this->initializeOutputPort<std::vector<VectorVector2d>>(0, "clustered 2d points", &_clustered_points);
+    this->initializeOutputPort<std::vector<ComponentStatistics>>(1, "cluster statistics", &_labeller.components());
 
     return true;
   }
@@ -82,6 +95,7 @@ private:
   }
 
   std::vector<VectorVector2d> _clustered_points;
+  ConnectedComponents _labeller;
 };
 
 class ColouredImageToBitMask : public processing::ProcessingStage<NoDataType>
@@ -111,6 +125,9 @@ private:
   bool doInitialization() final
   {
     auto rangeFilter = std::make_unique<ImageMaskFilterColourRange>(100, 120, 70, 255, 30, 255);
+
+    // the bit mask buffer is drawn from the pool of the pipeline and kept as long as the image size doesn't change
+    _bit_mask.setPool(_image_pipeline.pool());
     
     return _image_pipeline.addFilter("colour range", std::move(rangeFilter));
   }
@@ -130,6 +147,124 @@ private:
   ImageMaskFilterPipeline _image_pipeline;
 };
 
+class ImageSequenceSource : public processing::ProcessingStage<NoDataType>
+{
+public:
+  /**
+   * \brief Constructs a source that outputs the given image files frame by frame. The files are decoded on a
+   *        background thread ahead of the processing.
+   *
+   * \param file_names Files of the sequence in frame order, e.g. created by listImageFiles().
+   * \param space Colour space of the output images.
+   * \param parameter Parameter of the reader.
+   * \param decoder Loads one file. Uses loadImageFromFile() if not set.
+   */
+  ImageSequenceSource(std::vector<std::string> file_names, const ColourSpace space,
+                      const ImageSequenceReader::Parameter& parameter = ImageSequenceReader::Parameter(),
+                      ImageSequenceReader::Decoder decoder = ImageSequenceReader::Decoder())
+    : processing::ProcessingStage<NoDataType>("image sequence source", 0, 1),
+      _file_names(std::move(file_names)),
+      _space(space),
+      _reader(parameter, std::move(decoder))
+  { }
+  ~ImageSequenceSource() = default;
+
+  bool doProcess(NoDataType&) final
+  {
+    // the former frame's buffer goes back to the pool of the reader
+    return _reader.next(_image);
+  }
+
+  /**
+   * \brief Returns true if all frames of the sequence were processed.
+   */
+  inline bool isFinished() const noexcept
+  {
+    return _reader.numOfTakenFrames() + _reader.numOfFailedFrames() >= _reader.numOfFrames();
+  }
+  inline const ImageSequenceReader& reader() const noexcept { return _reader; }
+
+private:
+  bool doInitialization() final
+  {
+    return _reader.open(_file_names, _space);
+  }
+  bool initializePorts() final
+  {
+    this->initializeOutputPort<Image>(0, "image", &_image);
+
+    return true;
+  }
+  bool isReady() const final
+  {
+    return _reader.isOpen();
+  }
+
+  const std::vector<std::string> _file_names;
+  const ColourSpace _space;
+  ImageSequenceReader _reader;
+  Image _image;
+};
+
+class ImageSequenceSink : public processing::ProcessingStage<NoDataType>
+{
+public:
+  /**
+   * \brief Constructs a stage that saves each input image on a background thread, e.g. for debugging a pipeline.
+   *
+   * \param file_pattern printf like pattern of the file names. It gets the frame number, e.g. "mask_%05u.png".
+   * \param parameter Parameter of the writer.
+   * \param encoder Saves one image. Uses saveImageToFile() if not set.
+   */
+  ImageSequenceSink(const std::string& file_pattern,
+                    const AsyncImageWriter::Parameter& parameter = AsyncImageWriter::Parameter(),
+                    AsyncImageWriter::Encoder encoder = AsyncImageWriter::Encoder())
+    : processing::ProcessingStage<NoDataType>("image sequence sink", 1, 0),
+      _file_pattern(file_pattern),
+      _writer(parameter, std::move(encoder))
+  { }
+  ~ImageSequenceSink() = default;
+
+  bool doProcess(NoDataType&) final
+  {
+    char fileName[512];
+    const int length = std::snprintf(fileName, sizeof(fileName), _file_pattern.c_str(), _frame);
+
+    if (length < 0 || static_cast<std::size_t>(length) >= sizeof(fileName))
+    {
+      base::LogError() << "ImageSequenceSink: can't create file name from pattern \"" << _file_pattern << "\".";
+      return false;
+    }
+
+    ++_frame;
+
+    return _writer.write(fileName, this->getInputs()[0].data<Image>());
+  }
+
+  inline AsyncImageWriter& writer() noexcept { return _writer; }
+
+private:
+  bool doInitialization() final
+  {
+    _frame = 0;
+    return true;
+  }
+  bool initializePorts() final
+  {
+    this->initializeInputPort<Image>(0, "image");
+
+    return true;
+  }
+  bool isReady() const final
+  {
+    return this->input(0).numOfConnections() > 0;
+  }
+
+  const std::string _file_pattern;
+  unsigned int _frame = 0;
+  AsyncImageWriter _writer;
+};
+
 } // end namespace vision
 
 } // end namespace francor
\ No newline at end of file
@@ -0,0 +1,213 @@
+/**
+ * Asynchronous reading and writing of image sequences. Images are decoded and encoded on background threads, so the
+ * processing of a frame overlaps with the file operations of the neighbouring frames.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include "francor_vision/image.h"
+#include "francor_vision/image_pool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace francor
+{
+
+namespace vision
+{
+
+/**
+ * \brief Lists the files of a directory sorted by name. Can be used to open a image sequence.
+ *
+ * \param directory Path to the directory.
+ * \param extension If not empty only files with this extension (e.g. ".png") are listed.
+ * \return Sorted file paths. Empty if the directory doesn't exist.
+ */
+std::vector<std::string> listImageFiles(const std::string& directory, const std::string& extension = "");
+
+/**
+ * \brief Reads a sequence of image files. A decoder thread loads up to lookahead frames in advance into buffers of an
+ *        image pool, so the consumer usually gets the next frame without waiting for the file system.
+ */
+class ImageSequenceReader
+{
+public:
+  using Decoder = std::function<bool(const std::string& file_name, const ColourSpace space, Image& image)>;
+
+  struct Parameter
+  {
+    Parameter(void) { }
+
+    std::size_t lookahead = 4; //> maximum number of decoded frames that wait for the consumer
+  };
+
+  /**
+   * \brief Constructs a reader.
+   *
+   * \param parameter Parameter of the reader.
+   * \param decoder Loads one file into the given image. Uses loadImageFromFile() if not set.
+   */
+  ImageSequenceReader(const Parameter& parameter = Parameter(), Decoder decoder = Decoder());
+  ImageSequenceReader(const ImageSequenceReader&) = delete;
+  ImageSequenceReader(ImageSequenceReader&&) = delete;
+  ~ImageSequenceReader(void);
+
+  ImageSequenceReader& operator=(const ImageSequenceReader&) = delete;
+  ImageSequenceReader& operator=(ImageSequenceReader&&) = delete;
+
+  /**
+   * \brief Opens a sequence and starts decoding. A former sequence is closed.
+   *
+   * \param file_names Files of the sequence in frame order.
+   * \param space Colour space of the frames.
+   * \return true if the decoder was started.
+   */
+  bool open(std::vector<std::string> file_names, const ColourSpace space);
+
+  /**
+   * \brief Stops the decoder thread and drops all frames that weren't taken yet.
+   */
+  void close(void);
+
+  /**
+   * \brief Takes the next frame. Blocks until it is decoded. The buffer of the former content of frame goes back to
+   *        the pool. Files that can't be decoded are skipped.
+   *
+   * \param frame Gets the next frame. It is attached to the pool of this reader.
+   * \return false if the end of the sequence is reached or no sequence is open.
+   */
+  bool next(Image& frame);
+
+  inline bool isOpen(void) const noexcept { return decoder_thread_.joinable(); }
+  inline std::size_t numOfFrames(void) const noexcept { return file_names_.size(); }
+  /**
+   * \brief Returns the number of frames that were taken by next().
+   */
+  inline std::size_t numOfTakenFrames(void) const noexcept { return num_taken_; }
+  /**
+   * \brief Returns the number of files that couldn't be decoded.
+   */
+  inline std::size_t numOfFailedFrames(void) const noexcept { return num_failed_.load(); }
+  inline const std::shared_ptr<ImagePool>& pool(void) const noexcept { return pool_; }
+
+private:
+  void decode(void);
+
+  const Parameter parameter_;
+  const Decoder decoder_;
+  const std::shared_ptr<ImagePool> pool_;
+
+  std::vector<std::string> file_names_;
+  ColourSpace space_ = ColourSpace::NONE;
+  std::size_t num_taken_ = 0;
+  std::atomic<std::size_t> num_failed_{0};
+
+  // frames decoded in advance, guarded by mutex_
+  std::mutex mutex_;
+  std::condition_variable frame_decoded_;
+  std::condition_variable frame_taken_;
+  std::deque<Image> frames_;
+  bool decoder_finished_ = false;
+  bool stop_ = false;
+
+  std::thread decoder_thread_;
+};
+
+/**
+ * \brief Writes images to files on a background thread. Images are copied into pooled buffers and queued, so the
+ *        caller only pays for the copy. If the queue is full write() waits for the encoder.
+ */
+class AsyncImageWriter
+{
+public:
+  using Encoder = std::function<bool(const std::string& file_name, const Image& image)>;
+
+  struct Parameter
+  {
+    Parameter(void) { }
+
+    std::size_t queue_size = 8; //> maximum number of images that wait for the encoder
+  };
+
+  /**
+   * \brief Constructs a writer and starts its encoder thread.
+   *
+   * \param parameter Parameter of the writer.
+   * \param encoder Saves one image to the given file. Uses saveImageToFile() if not set.
+   */
+  AsyncImageWriter(const Parameter& parameter = Parameter(), Encoder encoder = Encoder());
+  AsyncImageWriter(const AsyncImageWriter&) = delete;
+  AsyncImageWriter(AsyncImageWriter&&) = delete;
+  /**
+   * \brief Writes all queued images and stops the encoder thread.
+   */
+  ~AsyncImageWriter(void);
+
+  AsyncImageWriter& operator=(const AsyncImageWriter&) = delete;
+  AsyncImageWriter& operator=(AsyncImageWriter&&) = delete;
+
+  /**
+   * \brief Queues a copy of the image. The image can be modified as soon as this function returns.
+   *
+   * \param file_name Target file.
+   * \param image Image that will be written.
+   * \return false if the image is empty.
+   */
+  bool write(const std::string& file_name, const Image& image);
+
+  /**
+   * \brief Waits until all queued images are written.
+   */
+  void flush(void);
+
+  /**
+   * \brief Returns the number of images that were written successfully.
+   */
+  inline std::size_t numOfWrittenImages(void) const noexcept { return num_written_.load(); }
+  /**
+   * \brief Returns the number of images the encoder failed to write.
+   */
+  inline std::size_t numOfFailedImages(void) const noexcept { return num_failed_.load(); }
+  inline const std::shared_ptr<ImagePool>& pool(void) const noexcept { return pool_; }
+
+private:
+  struct Job
+  {
+    std::string file_name;
+    Image image;
+  };
+
+  void encode(void);
+
+  const Parameter parameter_;
+  const Encoder encoder_;
+  const std::shared_ptr<ImagePool> pool_;
+
+  std::atomic<std::size_t> num_written_{0};
+  std::atomic<std::size_t> num_failed_{0};
+
+  // queued images, guarded by mutex_
+  std::mutex mutex_;
+  std::condition_variable job_queued_;
+  std::condition_variable job_done_;
+  std::deque<Job> jobs_;
+  std::size_t num_in_progress_ = 0;
+  bool stop_ = false;
+
+  std::thread encoder_thread_;
+};
+
+} // end namespace vision
+
+} // end namespace francor
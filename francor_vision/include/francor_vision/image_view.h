@@ -0,0 +1,162 @@
+/**
+ * Defines a non-owning view on the pixel data of an image. Used to pass images or regions of them between filters
+ * without copying the pixels.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include "francor_vision/pixel.h"
+
+#include <cstddef>
+#include <type_traits>
+
+#include <opencv2/opencv.hpp>
+
+namespace francor
+{
+
+namespace vision
+{
+
+/**
+ * \brief Returns the number of bytes of a pixel of the given colour space.
+ */
+inline std::size_t numOfBytesPerPixel(const ColourSpace space)
+{
+  switch (space)
+  {
+  case ColourSpace::BGR:
+  case ColourSpace::HSV:
+  case ColourSpace::RGB:
+    return 3;
+
+  case ColourSpace::BIT_MASK:
+  case ColourSpace::GRAY:
+    return 1;
+
+  default:
+    return 0;
+  }
+}
+
+namespace impl
+{
+
+/**
+ * \brief View on the pixel data of an image. The view doesn't own the data, so the viewed image must outlive it. The
+ *        rows of a view can have a larger stride than its width, like a region of interest of a bigger image.
+ */
+template <typename DataType>
+class ImageView
+{
+public:
+  using PixelType = Pixel_<DataType>;
+
+  /**
+   * \brief Default constructor. Constructs an empty view.
+   */
+  ImageView(void) = default;
+
+  /**
+   * \brief Constructs a view on the given data.
+   *
+   * \param data Pointer to the first byte of the first pixel.
+   * \param rows Number of rows.
+   * \param cols Number of columns.
+   * \param stride Number of bytes between the beginning of two rows.
+   * \param space Colour space of the pixels.
+   */
+  ImageView(DataType* const data, const std::size_t rows, const std::size_t cols, const std::size_t stride,
+            const ColourSpace space)
+    : data_(data),
+      rows_(rows),
+      cols_(cols),
+      stride_(stride),
+      colour_space_(space)
+  {
+
+  }
+
+  /**
+   * \brief A view on mutable data can be used where a view on const data is required.
+   */
+  template <typename OtherType,
+            typename = std::enable_if_t<std::is_same<DataType, const OtherType>::value>>
+  ImageView(const ImageView<OtherType>& view)
+    : ImageView(view.data(), view.rows(), view.cols(), view.stride(), view.colourSpace())
+  {
+
+  }
+
+  inline ColourSpace colourSpace(void) const noexcept { return colour_space_; }
+  inline std::size_t rows(void) const noexcept { return rows_; }
+  inline std::size_t cols(void) const noexcept { return cols_; }
+  inline std::size_t stride(void) const noexcept { return stride_; }
+  inline DataType* data(void) const noexcept { return data_; }
+  inline bool empty(void) const noexcept { return data_ == nullptr || rows_ == 0 || cols_ == 0; }
+
+  /**
+   * \brief Returns a pointer to the first byte of the given row.
+   */
+  inline DataType* row(const std::size_t row) const noexcept { return data_ + row * stride_; }
+
+  /**
+   * \brief Returns the pixel at (row, col).
+   */
+  inline PixelType operator()(const std::size_t row, const std::size_t col) const
+  {
+    return { data_ + row * stride_ + col * numOfBytesPerPixel(colour_space_), colour_space_ };
+  }
+
+  /**
+   * \brief Returns a view on a region of this view. No data are copied.
+   *
+   * \param row First row of the region.
+   * \param col First column of the region.
+   * \param rows Number of rows of the region.
+   * \param cols Number of columns of the region.
+   * \return View on the region or an empty view if the region doesn't fit into this view.
+   */
+  ImageView roi(const std::size_t row, const std::size_t col, const std::size_t rows, const std::size_t cols) const
+  {
+    if (row + rows > rows_ || col + cols > cols_)
+    {
+      // TODO: print error
+      return { };
+    }
+
+    return { data_ + row * stride_ + col * numOfBytesPerPixel(colour_space_), rows, cols, stride_, colour_space_ };
+  }
+
+  /**
+   * \brief Creates a cv::Mat header on the data of this view, so opencv operations can work on it. No data are
+   *        copied. The cv::Mat doesn't keep the data alive.
+   */
+  cv::Mat cvMat(void) const
+  {
+    if (this->empty())
+      return { };
+
+    const int type = numOfBytesPerPixel(colour_space_) == 3 ? CV_8UC3 : CV_8UC1;
+
+    return cv::Mat(static_cast<int>(rows_), static_cast<int>(cols_), type, const_cast<std::uint8_t*>(data_), stride_);
+  }
+
+private:
+  DataType* data_ = nullptr;
+  std::size_t rows_ = 0;
+  std::size_t cols_ = 0;
+  std::size_t stride_ = 0;
+  ColourSpace colour_space_ = ColourSpace::NONE;
+};
+
+} // end namespace impl
+
+using ImageView = impl::ImageView<std::uint8_t>;
+using ConstImageView = impl::ImageView<const std::uint8_t>;
+
+} // end namespace vision
+
+} // end namespace francor
@@ -8,38 +8,43 @@
 
 #include "francor_vision/image.h"
 
+#include <string>
+
 namespace francor
 {
 
 namespace vision
 {
 
-Image loadImageFromFile(const std::string& fileName, const ColourSpace space)
-{
-  cv::Mat mat;
-  
-  switch (space)
-  {
-  case ColourSpace::BGR:
-    mat = cv::imread(fileName, cv::IMREAD_COLOR);
-    break;
-
-  case ColourSpace::GRAY:
-    mat = cv::imread(fileName, cv::IMREAD_GRAYSCALE);
-    break;
-
-  default:
-    //TODO: print error
-    return { };
-  }
-
-  return { mat, space };
-}
-
-void saveImageToFile(const std::string& file_name, const Image& image)
-{
-  cv::imwrite(file_name, image.cvMat());
-}
+/**
+ * \brief Loads an image from file.
+ *
+ * \param fileName Path to the image file.
+ * \param space Colour space of the loaded image. Only BGR and GRAY are supported.
+ * \return The loaded image or an empty image if an error occurred.
+ */
+Image loadImageFromFile(const std::string& fileName, const ColourSpace space);
+
+/**
+ * \brief Loads an image from file into the given image. If the image has already the size and colour space of the
+ *        file the image is decoded directly into its buffer. Otherwise the buffer is replaced, it is drawn from the
+ *        pool of the image if it has one.
+ *
+ * \param fileName Path to the image file.
+ * \param space Colour space of the loaded image. Only BGR and GRAY are supported.
+ * \param image Target image.
+ * \return true if the image was successfully loaded.
+ */
+bool loadImageFromFile(const std::string& fileName, const ColourSpace space, Image& image);
+
+/**
+ * \brief Saves an image to file. The file format is deduced from the file extension.
+ *
+ * \param file_name Path to the image file.
+ * \param image Image that will be saved.
+ * \return true if the image was successfully saved.
+ */
+bool saveImageToFile(const std::string& file_name, const Image& image);
 
 } // end namespace vision
 
@@ -0,0 +1,214 @@
+/**
+ * Defines image views with the colour space as template argument. The pixel layout is known at compile time, so pixel
+ * accesses don't need to dispatch on the colour space and loops over the pixels can be vectorized by the compiler.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#pragma once
+
+#include "francor_vision/image_view.h"
+
+#include <francor_base/span.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace francor
+{
+
+namespace vision
+{
+
+struct PixelBgr { std::uint8_t b; std::uint8_t g; std::uint8_t r; };
+struct PixelRgb { std::uint8_t r; std::uint8_t g; std::uint8_t b; };
+struct PixelHsv { std::uint8_t h; std::uint8_t s; std::uint8_t v; };
+
+static_assert(sizeof(PixelBgr) == 3 && sizeof(PixelRgb) == 3 && sizeof(PixelHsv) == 3,
+              "The pixel types must match the memory layout of the image data.");
+
+/**
+ * \brief Maps a colour space to its pixel type.
+ */
+template <ColourSpace Space>
+struct PixelType;
+
+template <> struct PixelType<ColourSpace::GRAY>     { using type = std::uint8_t; };
+template <> struct PixelType<ColourSpace::BIT_MASK> { using type = std::uint8_t; };
+template <> struct PixelType<ColourSpace::BGR>      { using type = PixelBgr; };
+template <> struct PixelType<ColourSpace::RGB>      { using type = PixelRgb; };
+template <> struct PixelType<ColourSpace::HSV>      { using type = PixelHsv; };
+
+namespace impl
+{
+
+/**
+ * \brief View on an image of colour space Space. Like ImageView it doesn't own the data.
+ */
+template <ColourSpace Space, typename Pixel>
+class TypedImageView
+{
+  using Byte = std::conditional_t<std::is_const<Pixel>::value, const std::uint8_t, std::uint8_t>;
+
+public:
+  using PixelType = Pixel;
+  using RowType = base::Span<Pixel>;
+
+  class RowIterator;
+  class Rows;
+
+  /**
+   * \brief Default constructor. Constructs an empty view.
+   */
+  TypedImageView(void) = default;
+
+  /**
+   * \brief Constructs a typed view from a view. If the colour space of the view doesn't match the view is empty.
+   */
+  TypedImageView(const impl::ImageView<Byte>& view)
+  {
+    if (view.colourSpace() != Space || view.empty())
+    {
+      // TODO: print error
+      return;
+    }
+
+    data_ = view.data();
+    rows_ = view.rows();
+    cols_ = view.cols();
+    stride_ = view.stride();
+  }
+
+  /**
+   * \brief A view on mutable pixels can be used where a view on const pixels is required.
+   */
+  template <typename OtherPixel,
+            typename = std::enable_if_t<std::is_same<Pixel, const OtherPixel>::value>>
+  TypedImageView(const TypedImageView<Space, OtherPixel>& view)
+    : TypedImageView(view.view())
+  {
+
+  }
+
+  static constexpr ColourSpace colourSpace(void) noexcept { return Space; }
+  inline std::size_t rows(void) const noexcept { return rows_; }
+  inline std::size_t cols(void) const noexcept { return cols_; }
+  inline std::size_t stride(void) const noexcept { return stride_; }
+  inline bool empty(void) const noexcept { return data_ == nullptr; }
+  /**
+   * \brief Returns true if there is no padding between the rows, so all pixels can be iterated as one row.
+   */
+  inline bool isContinuous(void) const noexcept { return stride_ == cols_ * sizeof(Pixel); }
+
+  /**
+   * \brief Returns a pointer to the first pixel of the given row.
+   */
+  inline Pixel* row(const std::size_t row) const noexcept
+  {
+    return reinterpret_cast<Pixel*>(data_ + row * stride_);
+  }
+
+  /**
+   * \brief Returns the pixel at (row, col).
+   */
+  inline Pixel& operator()(const std::size_t row, const std::size_t col) const noexcept { return this->row(row)[col]; }
+
+  /**
+   * \brief Returns the rows of this view for range based for loops.
+   */
+  inline Rows rowRange(void) const { return { *this }; }
+
+  /**
+   * \brief Returns the untyped view on the same data.
+   */
+  inline impl::ImageView<Byte> view(void) const { return { data_, rows_, cols_, stride_, Space }; }
+
+  /**
+   * \brief Calls function(pixel) for each pixel. The pixels are visited row by row, each row is a plain loop over
+   *        contiguous pixels that the compiler can vectorize. If the view is continuous it is processed as one row.
+   *
+   * \param function Callable with signature void(Pixel&).
+   */
+  template <typename Function>
+  void forEachPixel(Function function) const
+  {
+    const std::size_t numRows = this->isContinuous() ? 1 : rows_;
+    const std::size_t numCols = this->isContinuous() ? rows_ * cols_ : cols_;
+
+    for (std::size_t r = 0; r < numRows; ++r)
+    {
+      Pixel* const pixels = this->row(r);
+
+      for (std::size_t c = 0; c < numCols; ++c)
+        function(pixels[c]);
+    }
+  }
+
+private:
+  Byte* data_ = nullptr;
+  std::size_t rows_ = 0;
+  std::size_t cols_ = 0;
+  std::size_t stride_ = 0;
+};
+
+/**
+ * \brief Iterates over the rows of a view. Each row is a span of pixels. The view is held by value, so the iterator
+ *        stays valid if it was created from a temporary view.
+ */
+template <ColourSpace Space, typename Pixel>
+class TypedImageView<Space, Pixel>::RowIterator
+{
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = RowType;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = RowType;
+
+  RowIterator(const TypedImageView& view, const std::size_t row) : view_(view), row_(row) { }
+
+  inline RowType operator*(void) const { return { view_.row(row_), view_.cols() }; }
+  inline RowIterator& operator++(void) { ++row_; return *this; }
+  inline RowIterator operator++(int) { RowIterator it(*this); ++row_; return it; }
+  inline bool operator==(const RowIterator& rhs) const { return view_.row(row_) == rhs.view_.row(rhs.row_); }
+  inline bool operator!=(const RowIterator& rhs) const { return !(*this == rhs); }
+
+private:
+  TypedImageView view_;
+  std::size_t row_;
+};
+
+/**
+ * \brief Range of the rows of a view, can be used in range based for loops. The view is held by value, so
+ *        "for (auto row : image.typedView<Space>().rowRange())" is safe.
+ */
+template <ColourSpace Space, typename Pixel>
+class TypedImageView<Space, Pixel>::Rows
+{
+public:
+  Rows(const TypedImageView& view) : view_(view) { }
+
+  inline RowIterator begin(void) const { return { view_, 0 }; }
+  inline RowIterator end(void) const { return { view_, view_.rows() }; }
+
+private:
+  TypedImageView view_;
+};
+
+} // end namespace impl
+
+template <ColourSpace Space>
+using TypedImageView = impl::TypedImageView<Space, typename PixelType<Space>::type>;
+template <ColourSpace Space>
+using ConstTypedImageView = impl::TypedImageView<Space, const typename PixelType<Space>::type>;
+
+using GrayImageView = TypedImageView<ColourSpace::GRAY>;
+using ConstGrayImageView = ConstTypedImageView<ColourSpace::GRAY>;
+using BgrImageView = TypedImageView<ColourSpace::BGR>;
+using ConstBgrImageView = ConstTypedImageView<ColourSpace::BGR>;
+
+} // end namespace vision
+
+} // end namespace francor
@@ -0,0 +1,162 @@
+/**
+ * Defines colour ranges in HSV colour space and a fused kernel that converts a coloured image pixel by pixel to HSV and
+ * masks all pixels inside of the ranges in one pass.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_vision/colour_range.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace francor
+{
+
+namespace vision
+{
+
+namespace
+{
+
+// fixed point lookup tables of the 8 bit HSV conversion, the same as used by opencv
+constexpr int hsv_shift = 12;
+
+struct HsvDivisionTables
+{
+  HsvDivisionTables(void)
+  {
+    saturation[0] = hue[0] = 0;
+
+    for (int i = 1; i < 256; ++i)
+    {
+      saturation[i] = static_cast<int>(std::lround((255 << hsv_shift) / (1.0 * i)));
+      hue[i] = static_cast<int>(std::lround((180 << hsv_shift) / (6.0 * i)));
+    }
+  }
+
+  std::array<int, 256> saturation;
+  std::array<int, 256> hue;
+};
+
+const HsvDivisionTables& divisionTables(void)
+{
+  static const HsvDivisionTables tables;
+  return tables;
+}
+
+inline bool isInRange(const std::uint8_t h, const std::uint8_t s, const std::uint8_t v, const ColourRange& range)
+{
+  return h >= range.min_h && h <= range.max_h
+         &&
+         s >= range.min_s && s <= range.max_s
+         &&
+         v >= range.min_v && v <= range.max_v;
+}
+
+struct Ranges
+{
+  const ColourRange* begin;
+  const ColourRange* end;
+};
+
+inline bool isInRanges(const std::uint8_t h, const std::uint8_t s, const std::uint8_t v, const Ranges& ranges)
+{
+  for (const ColourRange* range = ranges.begin; range < ranges.end; ++range)
+    if (isInRange(h, s, v, *range))
+      return true;
+
+  return false;
+}
+
+// masks one row, blue_index is 0 for BGR and 2 for RGB
+inline void maskRowFromBgr(const std::uint8_t* pixel, std::uint8_t* mask, const std::size_t cols,
+                           const std::size_t blue_index, const Ranges& ranges,
+                           const HsvDivisionTables& tables)
+{
+  for (std::size_t col = 0; col < cols; ++col, pixel += 3)
+  {
+    if (mask[col])
+      continue;
+
+    const int b = pixel[blue_index];
+    const int g = pixel[1];
+    const int r = pixel[blue_index ^ 2];
+
+    const int v = std::max(b, std::max(g, r));
+    const int diff = v - std::min(b, std::min(g, r));
+    const int vr = v == r ? -1 : 0;
+    const int vg = v == g ? -1 : 0;
+
+    const int s = (diff * tables.saturation[v] + (1 << (hsv_shift - 1))) >> hsv_shift;
+    int h = (vr & (g - b)) + (~vr & ((vg & (b - r + 2 * diff)) + (~vg & (r - g + 4 * diff))));
+    h = (h * tables.hue[diff] + (1 << (hsv_shift - 1))) >> hsv_shift;
+    h += h < 0 ? 180 : 0;
+
+    if (isInRanges(static_cast<std::uint8_t>(h), static_cast<std::uint8_t>(s), static_cast<std::uint8_t>(v), ranges))
+      mask[col] = 255;
+  }
+}
+
+inline void maskRowFromHsv(const std::uint8_t* pixel, std::uint8_t* mask, const std::size_t cols,
+                           const Ranges& ranges)
+{
+  for (std::size_t col = 0; col < cols; ++col, pixel += 3)
+    if (!mask[col] && isInRanges(pixel[0], pixel[1], pixel[2], ranges))
+      mask[col] = 255;
+}
+
+bool maskRanges(const ConstImageView& image, const Ranges& ranges, const ImageView& mask)
+{
+  if (mask.colourSpace() != ColourSpace::BIT_MASK || image.rows() != mask.rows() || image.cols() != mask.cols())
+  {
+    // TODO: print error
+    return false;
+  }
+
+  const HsvDivisionTables& tables = divisionTables();
+
+  // the rows are processed one after another, so the input row is only read once and the mask row is written while
+  // it is still in the cache
+  switch (image.colourSpace())
+  {
+  case ColourSpace::BGR:
+    for (std::size_t row = 0; row < image.rows(); ++row)
+      maskRowFromBgr(image.row(row), mask.row(row), image.cols(), 0, ranges, tables);
+
+    return true;
+
+  case ColourSpace::RGB:
+    for (std::size_t row = 0; row < image.rows(); ++row)
+      maskRowFromBgr(image.row(row), mask.row(row), image.cols(), 2, ranges, tables);
+
+    return true;
+
+  case ColourSpace::HSV:
+    for (std::size_t row = 0; row < image.rows(); ++row)
+      maskRowFromHsv(image.row(row), mask.row(row), image.cols(), ranges);
+
+    return true;
+
+  default:
+    // TODO: print error
+    return false;
+  }
+}
+
+} // end namespace
+
+bool maskColourRanges(const ConstImageView& image, const std::vector<ColourRange>& ranges, const ImageView& mask)
+{
+  return maskRanges(image, Ranges{ ranges.data(), ranges.data() + ranges.size() }, mask);
+}
+
+bool maskColourRanges(const ConstImageView& image, const ColourRange& range, const ImageView& mask)
+{
+  return maskRanges(image, Ranges{ &range, &range + 1 }, mask);
+}
+
+} // end namespace vision
+
+} // end namespace francor
@@ -0,0 +1,321 @@
+/**
+ * Defines a labeller that finds the 8-connected components of a bit mask. It labels the mask in one pass with a union
+ * find structure and writes the statistics of the components (and optionally their outer contours) into flat arrays.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_vision/connected_components.h"
+
+#include <francor_base/parallel.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace francor
+{
+
+namespace vision
+{
+
+namespace
+{
+
+// minimum number of rows of a band, smaller bands aren't worth a thread
+constexpr std::size_t _min_rows_per_band = 32;
+
+// statistics of the part of a component that is inside of one band
+struct Accumulator
+{
+  std::size_t num_pixels = 0;
+  std::uint64_t sum_rows = 0;
+  std::uint64_t sum_cols = 0;
+  unsigned int min_row = std::numeric_limits<unsigned int>::max();
+  unsigned int min_col = std::numeric_limits<unsigned int>::max();
+  unsigned int max_row = 0;
+  unsigned int max_col = 0;
+  unsigned int first_row = 0;
+  unsigned int first_col = 0;
+};
+
+// neighbour directions in clockwise order, starting with east; y points downwards
+constexpr int _direction_x[8] = { 1, 1, 0, -1, -1, -1,  0,  1 };
+constexpr int _direction_y[8] = { 0, 1, 1,  1,  0, -1, -1, -1 };
+
+} // end namespace
+
+bool ConnectedComponents::operator()(const ConstImageView& mask)
+{
+  if (mask.colourSpace() != ColourSpace::BIT_MASK)
+  {
+    // TODO: print error
+    return false;
+  }
+
+  rows_ = mask.rows();
+  cols_ = mask.cols();
+  labels_.resize(rows_ * cols_);
+  parent_.resize(rows_ * ((cols_ + 1) / 2) + 1);
+  components_.clear();
+  contour_points_.clear();
+  contour_offsets_.assign(1, 0);
+
+  if (mask.empty())
+    return true;
+
+  // split the rows into bands, one band per thread
+  const std::size_t numBands = std::max<std::size_t>(std::min(base::maxParallelThreads(), rows_ / _min_rows_per_band),
+                                                     1);
+  band_begin_.resize(numBands + 1);
+  band_num_labels_.resize(numBands);
+
+  for (std::size_t band = 0; band <= numBands; ++band)
+    band_begin_[band] = rows_ * band / numBands;
+
+  // first pass: label each band on its own, each band uses its own range of provisional labels
+  base::parallelFor(0, numBands, 1, [&] (const std::size_t bandBegin, const std::size_t bandEnd)
+  {
+    for (std::size_t band = bandBegin; band < bandEnd; ++band)
+      this->labelBand(mask, band);
+  });
+
+  for (std::size_t band = 1; band < numBands; ++band)
+    this->mergeBandBorder(band_begin_[band]);
+
+  // flatten the forest: the roots get consecutive labels in the row major order of their first pixel, because a parent
+  // label is always smaller than its child label
+  Label numComponents = 0;
+
+  for (std::size_t band = 0; band < numBands; ++band)
+  {
+    const Label first = this->firstLabelOfBand(band);
+
+    for (Label label = first; label < first + band_num_labels_[band]; ++label)
+      parent_[label] = parent_[label] == label ? ++numComponents : parent_[parent_[label]];
+  }
+
+  // second pass: replace the provisional labels and accumulate the statistics of each band
+  std::vector<std::vector<Accumulator>> accumulators(numBands, std::vector<Accumulator>(numComponents));
+
+  base::parallelFor(0, numBands, 1, [&] (const std::size_t bandBegin, const std::size_t bandEnd)
+  {
+    for (std::size_t band = bandBegin; band < bandEnd; ++band)
+    {
+      auto& bandAccumulators = accumulators[band];
+
+      for (std::size_t row = band_begin_[band]; row < band_begin_[band + 1]; ++row)
+      {
+        Label* const labels = &labels_[row * cols_];
+
+        for (std::size_t col = 0; col < cols_; ++col)
+        {
+          if (!labels[col])
+            continue;
+
+          const Label label = parent_[labels[col]];
+          Accumulator& accumulator = bandAccumulators[label - 1];
+          labels[col] = label;
+
+          if (!accumulator.num_pixels)
+          {
+            accumulator.first_row = static_cast<unsigned int>(row);
+            accumulator.first_col = static_cast<unsigned int>(col);
+          }
+
+          ++accumulator.num_pixels;
+          accumulator.sum_rows += row;
+          accumulator.sum_cols += col;
+          accumulator.min_row = std::min(accumulator.min_row, static_cast<unsigned int>(row));
+          accumulator.min_col = std::min(accumulator.min_col, static_cast<unsigned int>(col));
+          accumulator.max_row = std::max(accumulator.max_row, static_cast<unsigned int>(row));
+          accumulator.max_col = std::max(accumulator.max_col, static_cast<unsigned int>(col));
+        }
+      }
+    }
+  });
+
+  // reduce the statistics of all bands
+  components_.resize(numComponents);
+
+  for (std::size_t component = 0; component < numComponents; ++component)
+  {
+    Accumulator total;
+
+    for (std::size_t band = 0; band < numBands; ++band)
+    {
+      const Accumulator& accumulator = accumulators[band][component];
+
+      if (!accumulator.num_pixels)
+        continue;
+
+      if (!total.num_pixels)
+      {
+        total.first_row = accumulator.first_row;
+        total.first_col = accumulator.first_col;
+      }
+
+      total.num_pixels += accumulator.num_pixels;
+      total.sum_rows += accumulator.sum_rows;
+      total.sum_cols += accumulator.sum_cols;
+      total.min_row = std::min(total.min_row, accumulator.min_row);
+      total.min_col = std::min(total.min_col, accumulator.min_col);
+      total.max_row = std::max(total.max_row, accumulator.max_row);
+      total.max_col = std::max(total.max_col, accumulator.max_col);
+    }
+
+    ComponentStatistics& statistics = components_[component];
+    statistics.num_pixels = total.num_pixels;
+    statistics.bounding_box = base::Rectu(total.min_col, total.min_row,
+                                          total.max_col - total.min_col + 1, total.max_row - total.min_row + 1);
+    statistics.centroid = base::Point2d(static_cast<double>(total.sum_cols) / static_cast<double>(total.num_pixels),
+                                        static_cast<double>(total.sum_rows) / static_cast<double>(total.num_pixels));
+    statistics.first_pixel = ContourPoint(total.first_col, total.first_row);
+  }
+
+  // optional contours
+  contour_offsets_.assign(numComponents + 1, 0);
+
+  if (!extract_contours_)
+    return true;
+
+  for (std::size_t component = 0; component < numComponents; ++component)
+  {
+    this->traceContour(components_[component], static_cast<Label>(component + 1));
+    contour_offsets_[component + 1] = contour_points_.size();
+  }
+
+  return true;
+}
+
+void ConnectedComponents::labelBand(const ConstImageView& mask, const std::size_t band)
+{
+  const Label first = this->firstLabelOfBand(band);
+  Label next = first;
+
+  for (std::size_t row = band_begin_[band]; row < band_begin_[band + 1]; ++row)
+  {
+    const std::uint8_t* const pixels = mask.row(row);
+    Label* const labels = &labels_[row * cols_];
+    // the row above is only available inside of the band, the band borders are merged later
+    const Label* const above = row > band_begin_[band] ? labels - cols_ : nullptr;
+
+    for (std::size_t col = 0; col < cols_; ++col)
+    {
+      if (!pixels[col])
+      {
+        labels[col] = 0;
+        continue;
+      }
+
+      const Label west = col > 0 ? labels[col - 1] : 0;
+
+      if (above)
+      {
+        // the north neighbour is connected to all other already labelled neighbours
+        if (above[col])
+        {
+          labels[col] = above[col];
+          continue;
+        }
+
+        // west and north west are connected to each other, north east can belong to another tree
+        const Label left = west ? west : (col > 0 ? above[col - 1] : 0);
+        const Label northEast = col + 1 < cols_ ? above[col + 1] : 0;
+
+        if (northEast)
+        {
+          labels[col] = left ? this->unite(northEast, left) : northEast;
+          continue;
+        }
+        if (left)
+        {
+          labels[col] = left;
+          continue;
+        }
+      }
+      else if (west)
+      {
+        labels[col] = west;
+        continue;
+      }
+
+      parent_[next] = next;
+      labels[col] = next++;
+    }
+  }
+
+  band_num_labels_[band] = next - first;
+}
+
+void ConnectedComponents::mergeBandBorder(const std::size_t row)
+{
+  const Label* const labels = &labels_[row * cols_];
+  const Label* const above = labels - cols_;
+
+  for (std::size_t col = 0; col < cols_; ++col)
+  {
+    if (!labels[col])
+      continue;
+
+    const std::size_t begin = col > 0 ? col - 1 : 0;
+    const std::size_t end = std::min(col + 2, cols_);
+
+    for (std::size_t neighbour = begin; neighbour < end; ++neighbour)
+      if (above[neighbour])
+        this->unite(labels[col], above[neighbour]);
+  }
+}
+
+void ConnectedComponents::traceContour(const ComponentStatistics& component, const Label label)
+{
+  const ContourPoint start(component.first_pixel);
+  contour_points_.push_back(start);
+
+  if (component.num_pixels == 1)
+    return;
+
+  const auto isPartOfComponent = [&] (const long x, const long y)
+  {
+    return x >= 0 && y >= 0 && x < static_cast<long>(cols_) && y < static_cast<long>(rows_)
+           && labels_[y * cols_ + x] == label;
+  };
+
+  // the start is the first pixel in row major order, so all neighbours above are background; the search begins north
+  // east as if the contour was entered from the west
+  long x = start.x();
+  long y = start.y();
+  int searchBegin = 7;
+  int firstDirection = -1;
+
+  while (true)
+  {
+    // moore neighbour tracing: walk clockwise around the current pixel starting next to the previous background pixel
+    int direction = searchBegin;
+
+    for (int i = 0; i < 8; ++i, direction = (direction + 1) % 8)
+      if (isPartOfComponent(x + _direction_x[direction], y + _direction_y[direction]))
+        break;
+
+    // stop if the start is left the same way as at the beginning
+    if (x == start.x() && y == start.y())
+    {
+      if (direction == firstDirection)
+        break;
+      if (firstDirection < 0)
+        firstDirection = direction;
+    }
+
+    x += _direction_x[direction];
+    y += _direction_y[direction];
+    contour_points_.emplace_back(static_cast<unsigned int>(x), static_cast<unsigned int>(y));
+
+    searchBegin = direction % 2 ? (direction + 6) % 8 : (direction + 7) % 8;
+  }
+
+  // the start was added again when the contour was closed
+  contour_points_.pop_back();
+}
+
+} // end namespace vision
+
+} // end namespace francor
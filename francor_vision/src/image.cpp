@@ -6,6 +6,7 @@
  */
 #include "francor_vision/image.h"
 
+#include <cstring>
 
 namespace francor
 {
@@ -24,26 +25,30 @@ Image::Image(const std::size_t rows, const std::size_t cols, const ColourSpace s
 
 }
 
-Image::Image(const Image& image)
-  : colour_space_(image.colour_space_),
-    data_source_(image.data_source_.clone()),
-    data_(data_source_.data),
-    stride_(data_source_.step),
-    rows_(data_source_.rows),
-    cols_(data_source_.cols)
+Image::Image(const std::size_t rows, const std::size_t cols, const ColourSpace space, std::shared_ptr<ImagePool> pool)
+  : pool_(std::move(pool))
 {
+  this->resize(rows, cols, space);
+}
 
+Image::Image(const Image& image)
+  : pool_(image.pool_)
+{
+  // the copy is drawn from the same pool as the origin
+  this->copyFromCvMat(image.data_source_, image.colour_space_);
 }
 
-Image::Image(Image&& image)
+Image::Image(Image&& image) noexcept
   : colour_space_(image.colour_space_),
-    data_source_(image.data_source_.clone()),
-    data_(data_source_.data),
-    stride_(data_source_.step),
-    rows_(data_source_.rows),
-    cols_(data_source_.cols)
+    data_source_(std::move(image.data_source_)),
+    data_(image.data_),
+    stride_(image.stride_),
+    rows_(image.rows_),
+    cols_(image.cols_),
+    pool_(std::move(image.pool_)),
+    buffer_(std::move(image.buffer_))
 {
-  // clear all attributes and release memory of image
+  // the data are owned by this image now, only reset the attributes of the origin
   image.clear();
 }
 
@@ -58,6 +63,19 @@ Image::Image(cv::Mat&& mat, const ColourSpace space)
   mat.release();
 }
 
+Image::Image(const ConstImageView& view)
+{
+  if (view.empty())
+    return;
+
+  // the view can have a larger stride than its width, so copy row by row into a continuous image
+  this->resize(view.rows(), view.cols(), view.colourSpace());
+  const std::size_t bytesPerRow = view.cols() * Image::solveBytesPerPixel(view.colourSpace());
+
+  for (std::size_t row = 0; row < rows_; ++row)
+    std::memcpy(data_ + row * stride_, view.row(row), bytesPerRow);
+}
+
 Image::~Image(void)
 {
 
@@ -70,9 +88,19 @@ Image& Image::operator=(const Image& image)
   return *this;
 }
 
-Image& Image::operator=(Image&& image)
+Image& Image::operator=(Image&& image) noexcept
 {
-  this->fromCvMat(image.data_source_, image.colour_space_);
+  if (this == &image)
+    return *this;
+
+  data_source_ = std::move(image.data_source_);
+  data_ = image.data_;
+  stride_ = image.stride_;
+  rows_ = image.rows_;
+  cols_ = image.cols_;
+  colour_space_ = image.colour_space_;
+  pool_ = std::move(image.pool_);
+  buffer_ = std::move(image.buffer_);
   image.clear();
 
   return *this;
@@ -80,8 +108,9 @@ Image& Image::operator=(Image&& image)
 
 void Image::clear(void)
 {
-  // release memory
+  // release memory, a pooled buffer goes back to its pool
   data_source_.release();
+  buffer_.reset();
   data_ = nullptr;
 
   // reset image attributes
@@ -112,6 +141,7 @@ bool Image::fromCvMat(cv::Mat& mat, const ColourSpace space)
 
   // release memory reference from mat
   mat.release();
+  this->releaseUnusedBuffer();
 
   return true;
 }
@@ -125,7 +155,10 @@ bool Image::copyFromCvMat(const cv::Mat& mat, const ColourSpace space)
     return false;
   }
 
-  // copy data from mat
+  // copy data from mat, a pooled buffer of the right size is reused by copyTo()
+  if (pool_)
+    this->resize(mat.rows, mat.cols, space);
+
   mat.copyTo(data_source_);
   data_ = data_source_.data;
 
@@ -134,6 +167,7 @@ bool Image::copyFromCvMat(const cv::Mat& mat, const ColourSpace space)
   cols_ = data_source_.cols;
   stride_ = data_source_.step;
   colour_space_ = space;
+  this->releaseUnusedBuffer();
 
   return true;
 }
@@ -141,6 +175,15 @@ bool Image::copyFromCvMat(const cv::Mat& mat, const ColourSpace space)
 void Image::resize(const std::size_t rows, const std::size_t cols, const ColourSpace space)
 {
   const ColourSpace newSpace = (space == ColourSpace::NONE ? colour_space_ : space);
+
+  if (pool_)
+  {
+    // the current buffer is kept if neither size nor colour space change
+    if (!buffer_ || rows != rows_ || cols != cols_ || newSpace != colour_space_)
+      this->takeBufferFromPool(rows, cols, newSpace);
+
+    return;
+  }
   
   data_source_.create(rows, cols, this->solveType(newSpace));
   data_ = data_source_.data;
@@ -184,23 +227,123 @@ int Image::solveType(const ColourSpace space)
 
 std::size_t Image::solveBytesPerPixel(const ColourSpace space)
 {
-  switch (space)
+  return numOfBytesPerPixel(space);
+}
+
+int Image::solveConversionCode(const ColourSpace from, const ColourSpace to)
+{
+  // TODO: add conversions from and to HSV and GRAY, too
+  switch (from)
   {
   case ColourSpace::BGR:
-  case ColourSpace::HSV:
+    switch (to)
+    {
+    case ColourSpace::GRAY: return cv::COLOR_BGR2GRAY;
+    case ColourSpace::HSV:  return cv::COLOR_BGR2HSV;
+    case ColourSpace::RGB:  return cv::COLOR_BGR2RGB;
+    default:                return -1;
+    }
+
   case ColourSpace::RGB:
-    return 3;
+    switch (to)
+    {
+    case ColourSpace::GRAY: return cv::COLOR_RGB2GRAY;
+    case ColourSpace::HSV:  return cv::COLOR_RGB2HSV;
+    case ColourSpace::BGR:  return cv::COLOR_RGB2BGR;
+    default:                return -1;
+    }
 
-  case ColourSpace::BIT_MASK:
   case ColourSpace::GRAY:
-    return 1;
+    switch (to)
+    {
+    case ColourSpace::RGB:  return cv::COLOR_GRAY2RGB;
+    case ColourSpace::BGR:  return cv::COLOR_GRAY2BGR;
+    default:                return -1;
+    }
 
   default:
-    return 0;
+    return -1;
+  }
+}
+
+bool Image::transformTo(const ColourSpace space)
+{
+  if (space == colour_space_)
+    return true;
+
+  // the transformed image is drawn from the same pool, the former buffer goes back to it
+  Image transformed(pool_);
+
+  if (!transformed.convertFrom(*this, space))
+    return false;
+
+  *this = std::move(transformed);
+
+  return true;
+}
+
+bool Image::convertFrom(const Image& image, const ColourSpace space)
+{
+  if (&image == this)
+    return this->transformTo(space);
+
+  if (space == image.colour_space_)
+  {
+    *this = image;
+    return true;
+  }
+
+  const int code = Image::solveConversionCode(image.colour_space_, space);
+
+  if (code < 0)
+  {
+    // TODO: print error
+    return false;
+  }
+
+  this->resize(image.rows_, image.cols_, space);
+
+  if (rows_ == 0 || cols_ == 0)
+    return true;
+
+  // size and type of mat already match, so cvtColor() writes into the buffer of this image
+  cv::Mat mat(this->cvMat());
+  cv::cvtColor(image.cvMat(), mat, code);
+
+  return true;
+}
+
+void Image::takeBufferFromPool(const std::size_t rows, const std::size_t cols, const ColourSpace space)
+{
+  if (rows == 0 || cols == 0)
+  {
+    this->clear();
+    colour_space_ = space;
+    return;
   }
+
+  ImagePool::Buffer buffer(pool_->acquire(rows, cols, space));
+
+  data_source_ = cv::Mat(rows, cols, Image::solveType(space), buffer->data(), cols * Image::solveBytesPerPixel(space));
+  data_ = data_source_.data;
+  rows_ = rows;
+  cols_ = cols;
+  stride_ = data_source_.step;
+  colour_space_ = space;
+
+  // the former buffer goes back to the pool
+  buffer_ = std::move(buffer);
+}
+
+void Image::releaseUnusedBuffer(void)
+{
+  // the data source doesn't refer to the pooled buffer anymore, so it can be given back
+  if (buffer_ && (data_ < buffer_->data() || data_ >= buffer_->data() + buffer_->size()))
+    buffer_.reset();
 }
 
-Image Image::zeros(const std::size_t rows, const std::size_t cols, const ColourSpace space)
+Image Image::zeros(const std::size_t rows, const std::size_t cols, const ColourSpace space,
+                   std::shared_ptr<ImagePool> pool)
 {
   if (space == ColourSpace::NONE)
   {
@@ -208,6 +351,14 @@ Image Image::zeros(const std::size_t rows, const std::size_t cols, const ColourS
     return { };
   }
 
+  if (pool)
+  {
+    Image image(rows, cols, space, std::move(pool));
+    image.cvMat().setTo(cv::Scalar(0));
+
+    return image;
+  }
+
   Image image;
 
   // uses open cv static function to initialize the image
@@ -219,7 +370,7 @@ Image Image::zeros(const std::size_t rows, const std::size_t cols, const ColourS
   assert(image.cols() == cols);
   assert(image.colourSpace() == space);
 
-  return std::move(image);
+  return image;
 }
 
 } // end namespace vision
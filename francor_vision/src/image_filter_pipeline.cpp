@@ -0,0 +1,132 @@
+/**
+ * Defines filter pipeline and strategy that are work on images.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_vision/image_filter_pipeline.h"
+
+#include <francor_base/parallel.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace francor
+{
+
+namespace vision
+{
+
+bool ImageFilterPipeline::processInBands(const Image& input, Image& output) const
+{
+  // check that the colour spaces of the filter chain fit together
+  ColourSpace space = input.colourSpace();
+
+  for (auto& filter : filter_)
+  {
+    if (space != filter.second->requiredColourSpace())
+    {
+      // TODO: print error
+      return false;
+    }
+
+    space = filter.second->outputColourSpace();
+  }
+
+  // halo[i] is the number of rows the output of filter i - 1 must be extended by, so all following filters have their
+  // neighbourhood available; halo[num_filters] is zero, because the output has no halo
+  const std::size_t numFilters = filter_.size();
+  std::vector<std::size_t> halo(numFilters + 1, 0);
+  std::vector<std::size_t> bytesPerPixel(numFilters + 1, 0);
+
+  bytesPerPixel[0] = numOfBytesPerPixel(input.colourSpace());
+
+  for (std::size_t i = numFilters; i > 0; --i)
+  {
+    halo[i - 1] = halo[i] + filter_[i - 1].second->neighbourhoodRadius();
+    bytesPerPixel[i] = numOfBytesPerPixel(filter_[i - 1].second->outputColourSpace());
+  }
+
+  // choose the band height so the rows of all stages of one band fit into the band size
+  std::size_t bytesPerRow = 0;
+
+  for (const auto bytes : bytesPerPixel)
+    bytesPerRow += bytes * input.cols();
+
+  const std::size_t rows = input.rows();
+  const std::size_t bandRows = std::max<std::size_t>(band_size_ / std::max<std::size_t>(bytesPerRow, 1), 8);
+  const std::size_t numBands = (rows + bandRows - 1) / bandRows;
+
+  output.resize(rows, input.cols(), space);
+
+  const ConstImageView inputView(input.view());
+  const ImageView outputView(output.view());
+  std::atomic<bool> success(true);
+
+  // size of the intermediate stages of one band, each stage starts at a cache line
+  constexpr std::size_t alignment = 64;
+  std::vector<std::size_t> bufferOffset(numFilters + 1, 0);
+  std::size_t bufferSize = 0;
+
+  for (std::size_t i = 1; i < numFilters; ++i)
+  {
+    bufferOffset[i] = bufferSize;
+    bufferSize += ((bandRows + 2 * halo[i]) * input.cols() * bytesPerPixel[i] + alignment - 1) & ~(alignment - 1);
+  }
+
+  base::parallelFor(0, numBands, 1, [&] (const std::size_t bandBegin, const std::size_t bandEnd)
+  {
+    // the buffers of the intermediate stages are reused for all bands of this call; they are taken from the pool of
+    // the pipeline, so after the first frame they are only resized if the image grows
+    auto buffer = band_buffers_->acquire();
+    buffer->resize(bufferSize + alignment);
+
+    const auto address = reinterpret_cast<std::uintptr_t>(buffer->data());
+    std::uint8_t* const data = buffer->data() + ((alignment - address % alignment) % alignment);
+    std::vector<ImageView> buffers(numFilters + 1);
+
+    for (std::size_t i = 1; i < numFilters; ++i)
+    {
+      const std::size_t stride = input.cols() * bytesPerPixel[i];
+      const std::size_t maxRows = bandRows + 2 * halo[i];
+
+      buffers[i] = ImageView(data + bufferOffset[i], maxRows, input.cols(), stride,
+                             filter_[i - 1].second->outputColourSpace());
+    }
+
+    for (std::size_t band = bandBegin; band < bandEnd && success; ++band)
+    {
+      const std::size_t rowBegin = band * bandRows;
+      const std::size_t rowEnd = std::min(rowBegin + bandRows, rows);
+
+      // image rows covered by the input of the current filter
+      std::size_t inputBegin = rowBegin - std::min(rowBegin, halo[0]);
+      ConstImageView stageInput(inputView.roi(inputBegin, 0, std::min(rowEnd + halo[0], rows) - inputBegin,
+                                              input.cols()));
+
+      for (std::size_t i = 0; i < numFilters; ++i)
+      {
+        const std::size_t outputBegin = rowBegin - std::min(rowBegin, halo[i + 1]);
+        const std::size_t outputRows = std::min(rowEnd + halo[i + 1], rows) - outputBegin;
+        const ImageView stageOutput(i + 1 == numFilters ? outputView.roi(outputBegin, 0, outputRows, input.cols())
+                                                        : buffers[i + 1].roi(0, 0, outputRows, input.cols()));
+
+        if (!filter_[i].second->processBand(stageInput, outputBegin - inputBegin, stageOutput))
+        {
+          // TODO: print error
+          success = false;
+          return;
+        }
+
+        stageInput = stageOutput;
+        inputBegin = outputBegin;
+      }
+    }
+  });
+
+  return success;
+}
+
+} // end namespace vision
+
+} // end namespace francor
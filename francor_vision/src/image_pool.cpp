@@ -0,0 +1,57 @@
+/**
+ * Defines a pool of image buffers. Images that are attached to a pool take their pixel buffers from it and give them
+ * back if they are resized, cleared or destroyed, so a pipeline that processes images of the same size frame by frame
+ * doesn't allocate new buffers.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_vision/image_pool.h"
+#include "francor_vision/image_view.h"
+
+namespace francor
+{
+
+namespace vision
+{
+
+ImagePool::Buffer ImagePool::acquire(const std::size_t rows, const std::size_t cols, const ColourSpace space)
+{
+  Buffer buffer;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffer = pools_[Key(rows, cols, space)].acquire();
+  }
+
+  // a reused buffer has already the right size, only a new one is allocated here
+  buffer->resize(rows * cols * numOfBytesPerPixel(space));
+
+  return buffer;
+}
+
+std::size_t ImagePool::numOfBuffers(void) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::size_t num = 0;
+
+  for (const auto& pool : pools_)
+    num += pool.second.size();
+
+  return num;
+}
+
+std::size_t ImagePool::numOfAvailable(void) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::size_t num = 0;
+
+  for (const auto& pool : pools_)
+    num += pool.second.numOfAvailable();
+
+  return num;
+}
+
+} // end namespace vision
+
+} // end namespace francor
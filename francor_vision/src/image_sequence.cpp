@@ -0,0 +1,267 @@
+/**
+ * Asynchronous reading and writing of image sequences. Images are decoded and encoded on background threads, so the
+ * processing of a frame overlaps with the file operations of the neighbouring frames.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include "francor_vision/image_sequence.h"
+#include "francor_vision/io.h"
+
+#include <francor_base/log.h>
+
+#include <algorithm>
+#include <filesystem>
+
+namespace francor
+{
+
+namespace vision
+{
+
+std::vector<std::string> listImageFiles(const std::string& directory, const std::string& extension)
+{
+  std::vector<std::string> files;
+  std::error_code error;
+
+  for (const auto& entry : std::filesystem::directory_iterator(directory, error))
+  {
+    if (!entry.is_regular_file())
+      continue;
+    if (!extension.empty() && entry.path().extension() != extension)
+      continue;
+
+    files.push_back(entry.path().string());
+  }
+
+  // the directory iterator doesn't guarantee any order
+  std::sort(files.begin(), files.end());
+
+  return files;
+}
+
+ImageSequenceReader::ImageSequenceReader(const Parameter& parameter, Decoder decoder)
+  : parameter_(parameter),
+    decoder_(decoder ? std::move(decoder) : Decoder([] (const std::string& file_name, const ColourSpace space,
+                                                        Image& image)
+                                                     { return loadImageFromFile(file_name, space, image); })),
+    pool_(std::make_shared<ImagePool>())
+{
+
+}
+
+ImageSequenceReader::~ImageSequenceReader(void)
+{
+  this->close();
+}
+
+bool ImageSequenceReader::open(std::vector<std::string> file_names, const ColourSpace space)
+{
+  using francor::base::LogError;
+
+  if (parameter_.lookahead == 0)
+  {
+    LogError() << "ImageSequenceReader: lookahead must be greater than zero. Can't open sequence.";
+    return false;
+  }
+  if (space != ColourSpace::BGR && space != ColourSpace::GRAY)
+  {
+    LogError() << "ImageSequenceReader: only BGR and GRAY frames are supported. Can't open sequence.";
+    return false;
+  }
+
+  this->close();
+
+  file_names_ = std::move(file_names);
+  space_ = space;
+  num_taken_ = 0;
+  num_failed_ = 0;
+  decoder_finished_ = false;
+  stop_ = false;
+  decoder_thread_ = std::thread(&ImageSequenceReader::decode, this);
+
+  return true;
+}
+
+void ImageSequenceReader::close(void)
+{
+  if (!decoder_thread_.joinable())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+
+  frame_taken_.notify_all();
+  decoder_thread_.join();
+
+  // the buffers of the dropped frames go back to the pool
+  frames_.clear();
+}
+
+bool ImageSequenceReader::next(Image& frame)
+{
+  if (!this->isOpen())
+    return false;
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  frame_decoded_.wait(lock, [this] { return !frames_.empty() || decoder_finished_; });
+
+  if (frames_.empty())
+    return false;
+
+  frame = std::move(frames_.front());
+  frames_.pop_front();
+  ++num_taken_;
+  lock.unlock();
+
+  frame_taken_.notify_one();
+
+  return true;
+}
+
+void ImageSequenceReader::decode(void)
+{
+  using francor::base::LogError;
+
+  // frames of a sequence usually have all the same size, so each frame is decoded into a buffer of the size of the
+  // previous one
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+
+  for (const auto& file_name : file_names_)
+  {
+    // wait for a free slot in the lookahead
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      frame_taken_.wait(lock, [this] { return frames_.size() < parameter_.lookahead || stop_; });
+
+      if (stop_)
+        break;
+    }
+
+    // decode without holding the lock, the buffer is taken from the pool
+    Image frame(pool_);
+
+    if (rows > 0 && cols > 0)
+      frame.resize(rows, cols, space_);
+
+    if (!decoder_(file_name, space_, frame))
+    {
+      LogError() << "ImageSequenceReader: can't decode frame \"" << file_name << "\". Skip it.";
+      ++num_failed_;
+      continue;
+    }
+
+    rows = frame.rows();
+    cols = frame.cols();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      frames_.push_back(std::move(frame));
+    }
+
+    frame_decoded_.notify_one();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    decoder_finished_ = true;
+  }
+
+  frame_decoded_.notify_all();
+}
+
+AsyncImageWriter::AsyncImageWriter(const Parameter& parameter, Encoder encoder)
+  : parameter_(parameter),
+    encoder_(encoder ? std::move(encoder) : Encoder([] (const std::string& file_name, const Image& image)
+                                                    { return saveImageToFile(file_name, image); })),
+    pool_(std::make_shared<ImagePool>()),
+    encoder_thread_(&AsyncImageWriter::encode, this)
+{
+
+}
+
+AsyncImageWriter::~AsyncImageWriter(void)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+
+  // the encoder finishes all queued jobs before it stops
+  job_queued_.notify_all();
+  encoder_thread_.join();
+}
+
+bool AsyncImageWriter::write(const std::string& file_name, const Image& image)
+{
+  if (image.rows() == 0 || image.cols() == 0)
+  {
+    francor::base::LogError() << "AsyncImageWriter: image for file \"" << file_name << "\" is empty. Can't write it.";
+    return false;
+  }
+
+  // copy outside of the lock, the copy is drawn from the pool of this writer
+  Job job{ file_name, Image(pool_) };
+  job.image = image;
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    job_done_.wait(lock, [this] { return jobs_.size() < std::max<std::size_t>(parameter_.queue_size, 1); });
+    jobs_.push_back(std::move(job));
+  }
+
+  job_queued_.notify_one();
+
+  return true;
+}
+
+void AsyncImageWriter::flush(void)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  job_done_.wait(lock, [this] { return jobs_.empty() && num_in_progress_ == 0; });
+}
+
+void AsyncImageWriter::encode(void)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while (true)
+  {
+    job_queued_.wait(lock, [this] { return !jobs_.empty() || stop_; });
+
+    if (jobs_.empty())
+      break;
+
+    Job job(std::move(jobs_.front()));
+    jobs_.pop_front();
+    ++num_in_progress_;
+    lock.unlock();
+
+    // a slot is free now
+    job_done_.notify_all();
+
+    if (encoder_(job.file_name, job.image))
+    {
+      ++num_written_;
+    }
+    else
+    {
+      francor::base::LogError() << "AsyncImageWriter: can't write image \"" << job.file_name << "\".";
+      ++num_failed_;
+    }
+
+    // release the buffer before the job is reported as done
+    job.image.clear();
+
+    lock.lock();
+    --num_in_progress_;
+    job_done_.notify_all();
+  }
+}
+
+} // end namespace vision
+
+} // end namespace francor
@@ -0,0 +1,126 @@
+/**
+ * Provides helper functions to perform input and output data operations like save to file.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 6. April 2019
+ */
+#include "francor_vision/io.h"
+
+#include <francor_base/log.h>
+
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+namespace francor
+{
+
+namespace vision
+{
+
+namespace
+{
+
+bool solveReadFlag(const ColourSpace space, int& flag)
+{
+  switch (space)
+  {
+  case ColourSpace::BGR:
+    flag = cv::IMREAD_COLOR;
+    return true;
+
+  case ColourSpace::GRAY:
+    flag = cv::IMREAD_GRAYSCALE;
+    return true;
+
+  default:
+    base::LogError() << "loadImageFromFile(): colour space " << static_cast<int>(space) << " isn't supported.";
+    return false;
+  }
+}
+
+bool readFile(const std::string& fileName, std::vector<std::uint8_t>& bytes)
+{
+  std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+
+  if (!file.is_open())
+    return false;
+
+  const std::streamsize size = file.tellg();
+
+  if (size <= 0)
+    return false;
+
+  bytes.resize(static_cast<std::size_t>(size));
+  file.seekg(0);
+
+  return static_cast<bool>(file.read(reinterpret_cast<char*>(bytes.data()), size));
+}
+
+} // end namespace
+
+Image loadImageFromFile(const std::string& fileName, const ColourSpace space)
+{
+  int flag = 0;
+
+  if (!solveReadFlag(space, flag))
+    return { };
+
+  cv::Mat mat(cv::imread(fileName, flag));
+
+  if (mat.empty())
+  {
+    base::LogError() << "loadImageFromFile(): can't load image \"" << fileName << "\".";
+    return { };
+  }
+
+  return { std::move(mat), space };
+}
+
+bool loadImageFromFile(const std::string& fileName, const ColourSpace space, Image& image)
+{
+  int flag = 0;
+
+  if (!solveReadFlag(space, flag))
+    return false;
+
+  // the encoded file is read into a buffer that is reused by each thread
+  thread_local std::vector<std::uint8_t> bytes;
+
+  if (!readFile(fileName, bytes))
+  {
+    base::LogError() << "loadImageFromFile(): can't read file \"" << fileName << "\".";
+    return false;
+  }
+
+  // decode into a header over the buffer of the image, imdecode reuses it if size and type match
+  cv::Mat target(image.colourSpace() == space ? image.cvMat() : cv::Mat());
+  const std::uint8_t* const buffer = target.data;
+  cv::imdecode(bytes, flag, &target);
+
+  if (target.empty())
+  {
+    base::LogError() << "loadImageFromFile(): can't decode image \"" << fileName << "\".";
+    return false;
+  }
+  if (buffer != nullptr && target.data == buffer)
+    return true;
+
+  // the size changed, so the decoded image is copied into a new buffer, taken from the pool of the image if it has one
+  return image.copyFromCvMat(target, space);
+}
+
+bool saveImageToFile(const std::string& file_name, const Image& image)
+{
+  if (!cv::imwrite(file_name, image.cvMat()))
+  {
+    base::LogError() << "saveImageToFile(): can't write image \"" << file_name << "\".";
+    return false;
+  }
+
+  return true;
+}
+
+} // end namespace vision
+
+} // end namespace francor
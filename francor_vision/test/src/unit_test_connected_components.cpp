@@ -0,0 +1,255 @@
+/**
+ * Unit test for the connected component labelling.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_vision/connected_components.h"
+#include "francor_vision/image.h"
+
+#include <francor_base/parallel.h>
+
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using francor::vision::ConnectedComponents;
+using francor::vision::Image;
+using francor::vision::ColourSpace;
+
+namespace
+{
+
+// labels the mask by flood filling, the components are numbered in row major order of their first pixel
+std::vector<std::uint32_t> labelByFloodFill(const Image& mask, std::uint32_t& numComponents)
+{
+  std::vector<std::uint32_t> labels(mask.rows() * mask.cols(), 0);
+  numComponents = 0;
+
+  for (std::size_t row = 0; row < mask.rows(); ++row)
+  {
+    for (std::size_t col = 0; col < mask.cols(); ++col)
+    {
+      if (!mask(row, col).bit() || labels[row * mask.cols() + col])
+        continue;
+
+      std::vector<std::pair<long, long>> stack{ { row, col } };
+      labels[row * mask.cols() + col] = ++numComponents;
+
+      while (!stack.empty())
+      {
+        const auto pixel = stack.back();
+        stack.pop_back();
+
+        for (long r = pixel.first - 1; r <= pixel.first + 1; ++r)
+        {
+          for (long c = pixel.second - 1; c <= pixel.second + 1; ++c)
+          {
+            if (r < 0 || c < 0 || r >= static_cast<long>(mask.rows()) || c >= static_cast<long>(mask.cols())
+                || !mask(r, c).bit() || labels[r * mask.cols() + c])
+              continue;
+
+            labels[r * mask.cols() + c] = numComponents;
+            stack.emplace_back(r, c);
+          }
+        }
+      }
+    }
+  }
+
+  return labels;
+}
+
+// pixels of the component that touch the background outside of it (4-connected, reachable from the image border)
+std::set<std::pair<unsigned int, unsigned int>> outerBoundary(const std::vector<std::uint32_t>& labels,
+                                                              const std::size_t rows, const std::size_t cols,
+                                                              const std::uint32_t label)
+{
+  // flood fill the background on a padded grid
+  const long paddedRows = rows + 2;
+  const long paddedCols = cols + 2;
+  std::vector<bool> outside(paddedRows * paddedCols, false);
+  std::vector<std::pair<long, long>> stack{ { 0, 0 } };
+  const auto isComponent = [&] (const long r, const long c)
+  {
+    return r >= 1 && c >= 1 && r <= static_cast<long>(rows) && c <= static_cast<long>(cols)
+           && labels[(r - 1) * cols + c - 1] == label;
+  };
+  outside[0] = true;
+
+  while (!stack.empty())
+  {
+    const auto pixel = stack.back();
+    stack.pop_back();
+    const long neighbours[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+
+    for (const auto& n : neighbours)
+    {
+      const long r = pixel.first + n[0];
+      const long c = pixel.second + n[1];
+
+      if (r < 0 || c < 0 || r >= paddedRows || c >= paddedCols || outside[r * paddedCols + c] || isComponent(r, c))
+        continue;
+
+      outside[r * paddedCols + c] = true;
+      stack.emplace_back(r, c);
+    }
+  }
+
+  std::set<std::pair<unsigned int, unsigned int>> boundary;
+
+  for (long r = 1; r <= static_cast<long>(rows); ++r)
+    for (long c = 1; c <= static_cast<long>(cols); ++c)
+      if (isComponent(r, c) && (outside[(r - 1) * paddedCols + c] || outside[(r + 1) * paddedCols + c]
+                                || outside[r * paddedCols + c - 1] || outside[r * paddedCols + c + 1]))
+        boundary.emplace(c - 1, r - 1);
+
+  return boundary;
+}
+
+Image createRandomMask(const std::size_t rows, const std::size_t cols, const unsigned int seed)
+{
+  std::mt19937 generator(seed);
+  std::bernoulli_distribution isSet(0.45);
+  Image mask(rows, cols, ColourSpace::BIT_MASK);
+
+  for (std::size_t row = 0; row < rows; ++row)
+    for (std::size_t col = 0; col < cols; ++col)
+      mask(row, col).bit() = isSet(generator) ? 255 : 0;
+
+  return mask;
+}
+
+} // end namespace
+
+TEST(ConnectedComponentsTest, Statistics)
+{
+  Image mask(Image::zeros(6, 8, ColourSpace::BIT_MASK));
+  ConnectedComponents labeller;
+
+  // 2x3 block
+  for (std::size_t row = 1; row < 3; ++row)
+    for (std::size_t col = 1; col < 4; ++col)
+      mask(row, col).bit() = 255;
+
+  // diagonal line, connected only by its corners
+  mask(3, 5).bit() = 255;
+  mask(4, 6).bit() = 255;
+  mask(5, 7).bit() = 255;
+
+  ASSERT_TRUE(labeller(mask.view()));
+  ASSERT_EQ(labeller.numOfComponents(), 2);
+
+  const auto& block = labeller.components()[0];
+  EXPECT_EQ(block.num_pixels, 6);
+  EXPECT_EQ(block.bounding_box.origin().x(), 1);
+  EXPECT_EQ(block.bounding_box.origin().y(), 1);
+  EXPECT_EQ(block.bounding_box.size().x(), 3);
+  EXPECT_EQ(block.bounding_box.size().y(), 2);
+  EXPECT_DOUBLE_EQ(block.centroid.x(), 2.0);
+  EXPECT_DOUBLE_EQ(block.centroid.y(), 1.5);
+
+  const auto& line = labeller.components()[1];
+  EXPECT_EQ(line.num_pixels, 3);
+  EXPECT_EQ(line.first_pixel.x(), 5);
+  EXPECT_EQ(line.first_pixel.y(), 3);
+  EXPECT_DOUBLE_EQ(line.centroid.x(), 6.0);
+  EXPECT_DOUBLE_EQ(line.centroid.y(), 4.0);
+
+  EXPECT_EQ(labeller.label(1, 1), 1);
+  EXPECT_EQ(labeller.label(5, 7), 2);
+  EXPECT_EQ(labeller.label(0, 0), 0);
+
+  // contours are only traced on request
+  EXPECT_TRUE(labeller.contourPoints().empty());
+  EXPECT_EQ(labeller.contour(0).size(), 0);
+}
+
+TEST(ConnectedComponentsTest, Contour)
+{
+  Image mask(Image::zeros(4, 5, ColourSpace::BIT_MASK));
+  ConnectedComponents labeller;
+  labeller.setContourExtraction(true);
+
+  // 2x2 square and a diagonal line
+  mask(0, 0).bit() = mask(0, 1).bit() = mask(1, 0).bit() = mask(1, 1).bit() = 255;
+  mask(1, 3).bit() = mask(2, 4).bit() = 255;
+  // single pixel
+  mask(3, 0).bit() = 255;
+
+  ASSERT_TRUE(labeller(mask.view()));
+  ASSERT_EQ(labeller.numOfComponents(), 3);
+
+  using Point = ConnectedComponents::ContourPoint;
+  const std::vector<Point> square{ { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+  const std::vector<Point> line{ { 3, 1 }, { 4, 2 } };
+  const std::vector<Point> single{ { 0, 3 } };
+
+  EXPECT_EQ(std::vector<Point>(labeller.contour(0).begin(), labeller.contour(0).end()), square);
+  EXPECT_EQ(std::vector<Point>(labeller.contour(1).begin(), labeller.contour(1).end()), line);
+  EXPECT_EQ(std::vector<Point>(labeller.contour(2).begin(), labeller.contour(2).end()), single);
+  EXPECT_EQ(labeller.contourPoints().size(), 7);
+}
+
+TEST(ConnectedComponentsTest, RandomMaskInParallelBands)
+{
+  const Image mask(createRandomMask(150, 61, 3));
+  std::uint32_t numExpected = 0;
+  const auto expected = labelByFloodFill(mask, numExpected);
+
+  // single band
+  francor::base::setMaxParallelThreads(1);
+  ConnectedComponents single;
+  single.setContourExtraction(true);
+  ASSERT_TRUE(single(mask.view()));
+
+  // several bands
+  francor::base::setMaxParallelThreads(4);
+  ConnectedComponents parallel;
+  parallel.setContourExtraction(true);
+  ASSERT_TRUE(parallel(mask.view()));
+
+  ASSERT_EQ(single.numOfComponents(), numExpected);
+  ASSERT_EQ(parallel.numOfComponents(), numExpected);
+  EXPECT_EQ(single.labels(), expected);
+  EXPECT_EQ(parallel.labels(), expected);
+  EXPECT_EQ(single.contourPoints(), parallel.contourPoints());
+  EXPECT_EQ(single.contourOffsets(), parallel.contourOffsets());
+
+  std::vector<std::size_t> numPixels(numExpected, 0);
+
+  for (const auto label : expected)
+    if (label)
+      ++numPixels[label - 1];
+
+  for (std::size_t component = 0; component < numExpected; ++component)
+  {
+    EXPECT_EQ(parallel.components()[component].num_pixels, numPixels[component]);
+    EXPECT_EQ(parallel.components()[component].centroid, single.components()[component].centroid);
+
+    // the contour visits exactly the pixels at the outer boundary
+    std::set<std::pair<unsigned int, unsigned int>> contour;
+
+    for (const auto& point : parallel.contour(component))
+      contour.emplace(point.x(), point.y());
+
+    ASSERT_EQ(contour, outerBoundary(expected, mask.rows(), mask.cols(), component + 1)) << "component " << component;
+  }
+}
+
+TEST(ConnectedComponentsTest, RequiresBitMask)
+{
+  ConnectedComponents labeller;
+  const Image image(4, 4, ColourSpace::GRAY);
+
+  EXPECT_FALSE(labeller(image.view()));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
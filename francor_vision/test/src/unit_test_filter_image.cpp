@@ -8,6 +8,8 @@
 
 #include "francor_vision/image_filter_pipeline.h"
 
+#include <francor_base/parallel.h>
+
 using francor::vision::ImageFilter;
 using francor::vision::ImageMaskFilter;
 using francor::vision::Image;
@@ -80,6 +82,84 @@ private:
   const std::size_t col_;
 };
 
+// vertical box filter on gray images that supports processing in bands
+class VerticalBoxFilterGray : public DummyFilter
+{
+public:
+  VerticalBoxFilterGray(const std::size_t radius) : DummyFilter(ColourSpace::GRAY), radius_(radius) { }
+
+  virtual std::size_t neighbourhoodRadius(void) const override { return radius_; }
+  virtual bool isBandProcessingSupported(void) const override { return true; }
+
+private:
+  virtual bool processImpl(const Image& input, Image& output) const override
+  {
+    Image result(input.rows(), input.cols(), ColourSpace::GRAY);
+
+    if (!this->processBand(input.view(), 0, result.view()))
+      return false;
+
+    output = std::move(result);
+    return true;
+  }
+
+  virtual bool processBandImpl(const francor::vision::ConstImageView& input, const std::size_t first_row,
+                               const francor::vision::ImageView& output) const override
+  {
+    for (std::size_t row = 0; row < output.rows(); ++row)
+    {
+      for (std::size_t col = 0; col < output.cols(); ++col)
+      {
+        const std::size_t center = row + first_row;
+        const std::size_t begin = center - std::min(center, radius_);
+        const std::size_t end = std::min(center + radius_ + 1, input.rows());
+        unsigned int sum = 0;
+
+        for (std::size_t i = begin; i < end; ++i)
+          sum += input(i, col).gray();
+
+        output(row, col).gray() = sum / (end - begin);
+      }
+    }
+
+    return true;
+  }
+
+  const std::size_t radius_;
+};
+
+// threshold filter that creates a bit mask from a gray image
+class ThresholdFilterGray : public DummyFilter
+{
+public:
+  ThresholdFilterGray(void) : DummyFilter(ColourSpace::GRAY) { }
+
+  virtual bool isBandProcessingSupported(void) const override { return true; }
+  virtual ColourSpace outputColourSpace(void) const override { return ColourSpace::BIT_MASK; }
+
+private:
+  virtual bool processImpl(const Image& input, Image& output) const override
+  {
+    Image result(input.rows(), input.cols(), ColourSpace::BIT_MASK);
+
+    if (!this->processBand(input.view(), 0, result.view()))
+      return false;
+
+    output = std::move(result);
+    return true;
+  }
+
+  virtual bool processBandImpl(const francor::vision::ConstImageView& input, const std::size_t first_row,
+                               const francor::vision::ImageView& output) const override
+  {
+    for (std::size_t row = 0; row < output.rows(); ++row)
+      for (std::size_t col = 0; col < output.cols(); ++col)
+        output(row, col).bit() = input(row + first_row, col).gray() >= 128 ? 255 : 0;
+
+    return true;
+  }
+};
+
 TEST(ImageFilterPipelineTest, instantiateEmptyPipeline)
 {
   francor::vision::ImageFilterPipeline pipeline;
@@ -132,6 +212,50 @@ TEST(ImageFilterPipelineTest, Process)
   EXPECT_FALSE(pipeline(image, image));
 }
 
+TEST(ImageFilterPipelineTest, ProcessInBands)
+{
+  francor::vision::ImageFilterPipeline pipeline;
+  ASSERT_TRUE(pipeline.addFilter("box 1", std::make_unique<VerticalBoxFilterGray>(1)));
+  ASSERT_TRUE(pipeline.addFilter("box 2", std::make_unique<VerticalBoxFilterGray>(2)));
+  ASSERT_TRUE(pipeline.addFilter("threshold", std::make_unique<ThresholdFilterGray>()));
+  ASSERT_TRUE(pipeline.isBandProcessingSupported());
+
+  Image image(100, 7, ColourSpace::GRAY);
+
+  for (std::size_t row = 0; row < image.rows(); ++row)
+    for (std::size_t col = 0; col < image.cols(); ++col)
+      image(row, col).gray() = (row * 37 + col * 101) % 256;
+
+  // expected result from processing the whole image filter by filter
+  Image expected;
+  ASSERT_TRUE(VerticalBoxFilterGray(1).process(image, expected));
+  ASSERT_TRUE(VerticalBoxFilterGray(2).process(expected, expected));
+  ASSERT_TRUE(ThresholdFilterGray().process(expected, expected));
+
+  // small bands, so the image is split into many bands that have halo rows
+  pipeline.setBandSize(7 * 3 * 10);
+  Image output;
+  ASSERT_TRUE(pipeline(image, output));
+
+  ASSERT_EQ(output.rows(), image.rows());
+  ASSERT_EQ(output.cols(), image.cols());
+  ASSERT_EQ(output.colourSpace(), ColourSpace::BIT_MASK);
+
+  for (std::size_t row = 0; row < output.rows(); ++row)
+    for (std::size_t col = 0; col < output.cols(); ++col)
+      ASSERT_EQ(expected(row, col).bit(), output(row, col).bit()) << "row = " << row << ", col = " << col;
+
+  // the band buffers are kept by the pipeline and reused by the next frame
+  const std::size_t numOfBandBuffers = pipeline.bandBuffers()->size();
+  EXPECT_LE(numOfBandBuffers, francor::base::maxParallelThreads());
+  ASSERT_TRUE(pipeline(image, output));
+  EXPECT_EQ(numOfBandBuffers, pipeline.bandBuffers()->size());
+
+  // a filter without band support disables the band processing
+  ASSERT_TRUE(pipeline.addFilter("rgb", std::make_unique<DummyFilterRgb>()));
+  EXPECT_FALSE(pipeline.isBandProcessingSupported());
+}
+
 TEST(ImageMaskFilterPipeLineTest, Process)
 {
   francor::vision::ImageMaskFilterPipeline pipeline;
@@ -247,6 +371,12 @@ TEST(ImageMaskFilterPipeLineTest, CreateRequiredImageTypes)
   EXPECT_EQ(bgr , ColourSpace::BGR );
   EXPECT_EQ(hsv , ColourSpace::HSV );
   EXPECT_EQ(gray, ColourSpace::GRAY);
+
+  // the converted images are drawn from the pool of the pipeline and reused by the next frame
+  const std::size_t numOfBuffers = pipeline.pool()->numOfBuffers();
+  EXPECT_EQ(numOfBuffers, 3);
+  ASSERT_TRUE(pipeline(image, mask));
+  EXPECT_EQ(pipeline.pool()->numOfBuffers(), numOfBuffers);
 }
 
 int main(int argc, char **argv)
@@ -7,10 +7,14 @@
 #include <gtest/gtest.h>
 
 #include "francor_vision/image_filter_criteria.h"
+#include "francor_vision/image_filter_pipeline.h"
+
+#include <random>
 
 using francor::vision::ImageMaskFilterColourRange;
 using francor::vision::Image;
 using francor::vision::ColourSpace;
+using francor::vision::ImageMaskFilterPipeline;
 
 TEST(ImageMaskFilterColourRangeTest, MissConfiguration)
 {
@@ -44,6 +48,72 @@ TEST(ImageMaskFilterColourRangeTest, Processing)
   EXPECT_FALSE(mask(0, 1).bit());
 }
 
+TEST(ImageMaskFilterColourRangeTest, FusedConversionFromBgr)
+{
+  ImageMaskFilterPipeline pipeline;
+  ASSERT_TRUE(pipeline.addFilter("blue", std::make_unique<ImageMaskFilterColourRange>(100, 120, 70, 255, 30, 255)));
+  ASSERT_TRUE(pipeline.addFilter("red", std::make_unique<ImageMaskFilterColourRange>(0, 10, 70, 255, 30, 255)));
+
+  Image image(Image::zeros(1, 4, ColourSpace::BGR));
+  Image mask;
+
+  // pure blue: h = 120, s = 255, v = 255
+  image(0, 0).b() = 255;
+  // dark blue: h = 109, s = 204, v = 100
+  image(0, 1).b() = 100;
+  image(0, 1).g() =  50;
+  image(0, 1).r() =  20;
+  // pure red: h = 0
+  image(0, 2).r() = 200;
+  // green: h = 60
+  image(0, 3).g() = 200;
+
+  ASSERT_TRUE(pipeline(image, mask));
+  ASSERT_EQ(mask.rows(), 1);
+  ASSERT_EQ(mask.cols(), 4);
+  EXPECT_TRUE(mask(0, 0).bit());
+  EXPECT_TRUE(mask(0, 1).bit());
+  EXPECT_TRUE(mask(0, 2).bit());
+  EXPECT_FALSE(mask(0, 3).bit());
+}
+
+TEST(ImageMaskFilterColourRangeTest, FusedEqualsSeparatePasses)
+{
+  const ImageMaskFilterColourRange blue(100, 120, 70, 255, 30, 255);
+  const ImageMaskFilterColourRange yellow(20, 35, 50, 255, 50, 255);
+  ImageMaskFilterPipeline pipeline;
+  ASSERT_TRUE(pipeline.addFilter("blue", std::make_unique<ImageMaskFilterColourRange>(blue)));
+  ASSERT_TRUE(pipeline.addFilter("yellow", std::make_unique<ImageMaskFilterColourRange>(yellow)));
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> value(0, 255);
+  Image image(48, 64, ColourSpace::BGR);
+
+  for (std::size_t row = 0; row < image.rows(); ++row)
+  {
+    for (std::size_t col = 0; col < image.cols(); ++col)
+    {
+      image(row, col).b() = value(generator);
+      image(row, col).g() = value(generator);
+      image(row, col).r() = value(generator);
+    }
+  }
+
+  // fused pass on the BGR image
+  Image mask;
+  ASSERT_TRUE(pipeline(image, mask));
+
+  // separate passes on a converted image
+  const Image hsv(image, ColourSpace::HSV);
+  Image expected(Image::zeros(image.rows(), image.cols(), ColourSpace::BIT_MASK));
+  ASSERT_TRUE(blue.process(hsv, expected));
+  ASSERT_TRUE(yellow.process(hsv, expected));
+
+  for (std::size_t row = 0; row < image.rows(); ++row)
+    for (std::size_t col = 0; col < image.cols(); ++col)
+      ASSERT_EQ(expected(row, col).bit(), mask(row, col).bit()) << "row = " << row << ", col = " << col;
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -68,8 +68,12 @@ TEST(ImageTest, MoveConstructor)
   origin(0, 0).gray() = 10;
   origin(0, 1).gray() = 10;
 
+  const std::uint8_t* data = &origin(0, 0).gray();
   francor::vision::Image moved(std::move(origin));
 
+  // the data are taken over, not copied
+  EXPECT_EQ(&moved(0, 0).gray(), data);
+
   // size and type must be moved
   ASSERT_EQ(moved.cols(), cols);
   ASSERT_EQ(moved.rows(), rows);
@@ -254,6 +258,213 @@ TEST(ImageTest, Zeros)
   EXPECT_EQ(origin(0, 1).gray(), 0);
 }
 
+TEST(ImageTest, MoveAssignment)
+{
+  francor::vision::Image origin(1, 2, francor::vision::ColourSpace::GRAY);
+  origin(0, 0).gray() = 10;
+  origin(0, 1).gray() = 20;
+
+  const std::uint8_t* data = &origin(0, 0).gray();
+  francor::vision::Image moved(3, 3, francor::vision::ColourSpace::BGR);
+  moved = std::move(origin);
+
+  // the data are taken over, not copied
+  ASSERT_EQ(moved.rows(), 1);
+  ASSERT_EQ(moved.cols(), 2);
+  EXPECT_EQ(moved.colourSpace(), francor::vision::ColourSpace::GRAY);
+  EXPECT_EQ(&moved(0, 0).gray(), data);
+  EXPECT_EQ(moved(0, 1).gray(), 20);
+
+  EXPECT_EQ(origin.cols(), 0);
+  EXPECT_EQ(origin.rows(), 0);
+  EXPECT_EQ(origin.colourSpace(), francor::vision::ColourSpace::NONE);
+}
+
+TEST(ImageTest, ViewWithRoi)
+{
+  francor::vision::Image image(francor::vision::Image::zeros(4, 5, francor::vision::ColourSpace::BGR));
+  francor::vision::ImageView roi(image.view().roi(1, 2, 2, 3));
+
+  ASSERT_FALSE(roi.empty());
+  EXPECT_EQ(roi.rows(), 2);
+  EXPECT_EQ(roi.cols(), 3);
+  EXPECT_EQ(roi.stride(), image.view().stride());
+  EXPECT_EQ(roi.colourSpace(), francor::vision::ColourSpace::BGR);
+
+  // write through the view into the image
+  roi(1, 2).b() = 7;
+  EXPECT_EQ(image(2, 4).b(), 7);
+
+  // read through a const view
+  image(1, 2).r() = 9;
+  const francor::vision::ConstImageView constRoi(roi);
+  EXPECT_EQ(constRoi(0, 0).r(), 9);
+
+  // regions outside of the image are empty
+  EXPECT_TRUE(image.view().roi(3, 0, 2, 1).empty());
+  EXPECT_TRUE(image.view().roi(0, 4, 1, 2).empty());
+}
+
+TEST(ImageTest, CopyFromView)
+{
+  francor::vision::Image image(francor::vision::Image::zeros(4, 5, francor::vision::ColourSpace::GRAY));
+  image(2, 3).gray() = 5;
+
+  const francor::vision::Image copy(image.view().roi(2, 3, 2, 2));
+
+  ASSERT_EQ(copy.rows(), 2);
+  ASSERT_EQ(copy.cols(), 2);
+  EXPECT_EQ(copy.colourSpace(), francor::vision::ColourSpace::GRAY);
+  EXPECT_EQ(copy(0, 0).gray(), 5);
+
+  // the copy doesn't share the data
+  image(2, 3).gray() = 6;
+  EXPECT_EQ(copy(0, 0).gray(), 5);
+}
+
+TEST(ImageTest, CvMatOfView)
+{
+  francor::vision::Image image(francor::vision::Image::zeros(4, 5, francor::vision::ColourSpace::GRAY));
+  cv::Mat mat(image.view().roi(1, 1, 2, 2).cvMat());
+
+  ASSERT_EQ(mat.rows, 2);
+  ASSERT_EQ(mat.cols, 2);
+
+  // the mat uses the data of the image
+  mat.setTo(cv::Scalar(3));
+  EXPECT_EQ(image(0, 0).gray(), 0);
+  EXPECT_EQ(image(1, 1).gray(), 3);
+  EXPECT_EQ(image(2, 2).gray(), 3);
+  EXPECT_EQ(image(2, 3).gray(), 0);
+}
+
+TEST(ImageTest, PooledBufferIsReused)
+{
+  auto pool = std::make_shared<francor::vision::ImagePool>();
+  const std::uint8_t* data = nullptr;
+
+  {
+    francor::vision::Image image(4, 5, francor::vision::ColourSpace::BGR, pool);
+    ASSERT_EQ(image.rows(), 4);
+    ASSERT_EQ(image.cols(), 5);
+    data = &image(0, 0).b();
+
+    // the buffer is kept if the size doesn't change
+    image.resize(4, 5);
+    EXPECT_EQ(&image(0, 0).b(), data);
+    EXPECT_EQ(pool->numOfAvailable(), 0);
+  }
+
+  // the buffer went back to the pool and is reused by the next image of the same size
+  EXPECT_EQ(pool->numOfAvailable(), 1);
+
+  francor::vision::Image image(francor::vision::Image::zeros(4, 5, francor::vision::ColourSpace::BGR, pool));
+  EXPECT_EQ(&image(0, 0).b(), data);
+  EXPECT_EQ(image(3, 4).r(), 0);
+  EXPECT_EQ(pool->numOfBuffers(), 1);
+
+  // a different size needs another buffer, the former one goes back to the pool
+  image.resize(2, 2, francor::vision::ColourSpace::GRAY);
+  EXPECT_EQ(pool->numOfBuffers(), 2);
+  EXPECT_EQ(pool->numOfAvailable(), 1);
+}
+
+TEST(ImageTest, PooledTransformationsDontAllocateInSteadyState)
+{
+  auto pool = std::make_shared<francor::vision::ImagePool>();
+
+  for (std::size_t frame = 0; frame < 3; ++frame)
+  {
+    francor::vision::Image image(3, 4, francor::vision::ColourSpace::BGR, pool);
+    image.cvMat().setTo(cv::Scalar(10, 20, 30));
+
+    const francor::vision::Image copy(image);
+    ASSERT_TRUE(image.transformTo(francor::vision::ColourSpace::RGB));
+    EXPECT_EQ(image.colourSpace(), francor::vision::ColourSpace::RGB);
+    EXPECT_EQ(image(2, 3).r(), 30);
+    EXPECT_EQ(image(2, 3).b(), 10);
+
+    // the copy doesn't share the data
+    EXPECT_EQ(copy(2, 3).b(), 10);
+    EXPECT_EQ(copy.pool(), pool);
+
+    // source image, copy and the transformed image
+    EXPECT_EQ(pool->numOfBuffers(), 3);
+  }
+
+  EXPECT_EQ(pool->numOfAvailable(), 3);
+}
+
+TEST(ImageTest, TypedView)
+{
+  francor::vision::Image image(francor::vision::Image::zeros(3, 4, francor::vision::ColourSpace::BGR));
+  const auto view = image.typedView<francor::vision::ColourSpace::BGR>();
+
+  ASSERT_FALSE(view.empty());
+  EXPECT_EQ(view.rows(), 3);
+  EXPECT_EQ(view.cols(), 4);
+
+  // pixel components are plain struct members
+  view(1, 2).r = 7;
+  EXPECT_EQ(image(1, 2).r(), 7);
+  EXPECT_EQ(view.row(1)[2].r, 7);
+
+  // each pixel is visited once
+  view.forEachPixel([] (francor::vision::PixelBgr& pixel) { pixel.g += 1; });
+
+  std::size_t numOfRows = 0;
+
+  for (const auto row : view.rowRange())
+  {
+    ASSERT_EQ(row.size(), 4);
+
+    for (const auto& pixel : row)
+      EXPECT_EQ(pixel.g, 1);
+
+    ++numOfRows;
+  }
+
+  EXPECT_EQ(numOfRows, 3);
+
+  // the range holds the view, so iterating the rows of a temporary view is safe
+  numOfRows = 0;
+
+  for (const auto row : image.typedView<francor::vision::ColourSpace::BGR>().rowRange())
+  {
+    ASSERT_EQ(row.size(), 4);
+    EXPECT_EQ(row[2].g, 1);
+    ++numOfRows;
+  }
+
+  EXPECT_EQ(numOfRows, 3);
+
+  // wrong colour space gives an empty view
+  const francor::vision::Image& constImage = image;
+  EXPECT_TRUE(constImage.typedView<francor::vision::ColourSpace::GRAY>().empty());
+}
+
+TEST(ImageTest, TypedViewOfRoi)
+{
+  francor::vision::Image image(francor::vision::Image::zeros(4, 5, francor::vision::ColourSpace::GRAY));
+  const francor::vision::GrayImageView roi(image.view().roi(1, 1, 2, 3));
+
+  // a region isn't continuous, the pixels beside it must not be touched
+  ASSERT_FALSE(roi.isContinuous());
+  roi.forEachPixel([] (std::uint8_t& pixel) { pixel = 9; });
+
+  for (std::size_t row = 0; row < image.rows(); ++row)
+  {
+    for (std::size_t col = 0; col < image.cols(); ++col)
+    {
+      const bool inside = row >= 1 && row < 3 && col >= 1 && col < 4;
+      EXPECT_EQ(image(row, col).gray(), inside ? 9 : 0);
+    }
+  }
+
+  const francor::vision::ConstGrayImageView constRoi(roi);
+  EXPECT_EQ(constRoi(0, 0), 9);
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,256 @@
+/**
+ * Unit test for asynchronous reading and writing of image sequences.
+ *
+ * \author Christian Merkl (knueppl@gmx.de)
+ * \date 18. October 2026
+ */
+#include <gtest/gtest.h>
+
+#include "francor_vision/image_sequence.h"
+#include "francor_vision/image_processing_pipeline.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+
+using francor::vision::Image;
+using francor::vision::ColourSpace;
+using francor::vision::ImageSequenceReader;
+using francor::vision::AsyncImageWriter;
+using francor::vision::ImageSequenceSource;
+using francor::vision::ImageSequenceSink;
+using francor::processing::NoDataType;
+
+namespace
+{
+
+// a file system in memory, so the tests don't depend on the image codecs
+class MemoryFiles
+{
+public:
+  bool save(const std::string& file_name, const Image& image)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    files_[file_name] = Image(image.view());
+
+    return true;
+  }
+  bool load(const std::string& file_name, const ColourSpace space, Image& image)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto file = files_.find(file_name);
+
+    if (file == files_.end() || file->second.colourSpace() != space)
+      return false;
+
+    image = file->second;
+
+    return true;
+  }
+  std::size_t size(void)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return files_.size();
+  }
+
+  ImageSequenceReader::Decoder decoder(void)
+  {
+    return [this] (const std::string& file_name, const ColourSpace space, Image& image)
+           { return this->load(file_name, space, image); };
+  }
+  AsyncImageWriter::Encoder encoder(void)
+  {
+    return [this] (const std::string& file_name, const Image& image) { return this->save(file_name, image); };
+  }
+
+private:
+  std::mutex mutex_;
+  std::map<std::string, Image> files_;
+};
+
+Image createFrame(const std::size_t number)
+{
+  Image frame(Image::zeros(12, 16, ColourSpace::GRAY));
+  frame(number % 12, number % 16).gray() = static_cast<std::uint8_t>(number + 1);
+
+  return frame;
+}
+
+std::string fileName(const std::size_t number)
+{
+  return "frame_" + std::to_string(number) + ".png";
+}
+
+} // end namespace
+
+TEST(ImageSequence, WriteAndRead)
+{
+  constexpr std::size_t numOfFrames = 25;
+  MemoryFiles files;
+  std::vector<std::string> fileNames;
+
+  {
+    AsyncImageWriter::Parameter parameter;
+    parameter.queue_size = 3;
+    AsyncImageWriter writer(parameter, files.encoder());
+
+    for (std::size_t i = 0; i < numOfFrames; ++i)
+    {
+      Image frame(createFrame(i));
+      ASSERT_TRUE(writer.write(fileName(i), frame));
+      // the writer works on its own copy
+      frame.clear();
+      fileNames.push_back(fileName(i));
+    }
+
+    writer.flush();
+    EXPECT_EQ(writer.numOfWrittenImages(), numOfFrames);
+    EXPECT_EQ(writer.numOfFailedImages(), 0);
+    // queued images and the one being encoded at most
+    EXPECT_LE(writer.pool()->numOfBuffers(), parameter.queue_size + 2);
+  }
+
+  ASSERT_EQ(files.size(), numOfFrames);
+
+  ImageSequenceReader::Parameter parameter;
+  parameter.lookahead = 2;
+  ImageSequenceReader reader(parameter, files.decoder());
+  ASSERT_TRUE(reader.open(fileNames, ColourSpace::GRAY));
+  EXPECT_EQ(reader.numOfFrames(), numOfFrames);
+
+  Image frame;
+
+  for (std::size_t i = 0; i < numOfFrames; ++i)
+  {
+    ASSERT_TRUE(reader.next(frame));
+    ASSERT_EQ(frame.rows(), 12);
+    ASSERT_EQ(frame.cols(), 16);
+    EXPECT_EQ(frame(i % 12, i % 16).gray(), i + 1);
+    EXPECT_EQ(frame.pool(), reader.pool());
+  }
+
+  EXPECT_FALSE(reader.next(frame));
+  EXPECT_EQ(reader.numOfTakenFrames(), numOfFrames);
+  // the lookahead, the frame being decoded and the frame held by the consumer
+  EXPECT_LE(reader.pool()->numOfBuffers(), parameter.lookahead + 2);
+}
+
+TEST(ImageSequence, SkipFailedFrames)
+{
+  MemoryFiles files;
+  files.save(fileName(0), createFrame(0));
+  files.save(fileName(2), createFrame(2));
+
+  ImageSequenceReader reader(ImageSequenceReader::Parameter(), files.decoder());
+  Image frame;
+
+  // no sequence is open
+  EXPECT_FALSE(reader.next(frame));
+  EXPECT_FALSE(reader.open({ fileName(0) }, ColourSpace::BIT_MASK));
+
+  ASSERT_TRUE(reader.open({ fileName(0), fileName(1), fileName(2) }, ColourSpace::GRAY));
+  ASSERT_TRUE(reader.next(frame));
+  EXPECT_EQ(frame(0, 0).gray(), 1);
+  ASSERT_TRUE(reader.next(frame));
+  EXPECT_EQ(frame(2, 2).gray(), 3);
+  EXPECT_FALSE(reader.next(frame));
+  EXPECT_EQ(reader.numOfFailedFrames(), 1);
+}
+
+TEST(ImageSequence, DecodeIntoBufferOfPreviousSize)
+{
+  MemoryFiles files;
+  std::vector<std::string> fileNames;
+
+  for (std::size_t i = 0; i < 6; ++i)
+  {
+    files.save(fileName(i), createFrame(i));
+    fileNames.push_back(fileName(i));
+  }
+
+  // from the second frame on the decoder gets an image with the size of the previous frame
+  std::size_t numOfPresized = 0;
+  const auto decoder = [&] (const std::string& file_name, const ColourSpace space, Image& image)
+  {
+    numOfPresized += image.rows() == 12 && image.cols() == 16 && image.pool() != nullptr;
+    return files.load(file_name, space, image);
+  };
+
+  ImageSequenceReader reader(ImageSequenceReader::Parameter(), decoder);
+  ASSERT_TRUE(reader.open(fileNames, ColourSpace::GRAY));
+
+  Image frame;
+  std::size_t numOfFrames = 0;
+
+  while (reader.next(frame))
+    ++numOfFrames;
+
+  EXPECT_EQ(numOfFrames, 6);
+  EXPECT_EQ(numOfPresized, 5);
+}
+
+TEST(ImageSequence, CloseWhileDecoding)
+{
+  MemoryFiles files;
+  std::vector<std::string> fileNames;
+
+  for (std::size_t i = 0; i < 10; ++i)
+  {
+    files.save(fileName(i), createFrame(i));
+    fileNames.push_back(fileName(i));
+  }
+
+  ImageSequenceReader::Parameter parameter;
+  parameter.lookahead = 1;
+  ImageSequenceReader reader(parameter, files.decoder());
+  Image frame;
+
+  // the decoder waits for a free slot, closing must not block
+  ASSERT_TRUE(reader.open(fileNames, ColourSpace::GRAY));
+  ASSERT_TRUE(reader.next(frame));
+  reader.close();
+  EXPECT_FALSE(reader.isOpen());
+  EXPECT_FALSE(reader.next(frame));
+
+  // reopening starts from the first frame
+  ASSERT_TRUE(reader.open(fileNames, ColourSpace::GRAY));
+  ASSERT_TRUE(reader.next(frame));
+  EXPECT_EQ(frame(0, 0).gray(), 1);
+}
+
+TEST(ImageSequence, SourceAndSinkStage)
+{
+  constexpr std::size_t numOfFrames = 5;
+  MemoryFiles input;
+  MemoryFiles output;
+  std::vector<std::string> fileNames;
+
+  for (std::size_t i = 0; i < numOfFrames; ++i)
+  {
+    input.save(fileName(i), createFrame(i));
+    fileNames.push_back(fileName(i));
+  }
+
+  ImageSequenceSource source(fileNames, ColourSpace::GRAY, ImageSequenceReader::Parameter(), input.decoder());
+  ImageSequenceSink sink("out_%02u.png", AsyncImageWriter::Parameter(), output.encoder());
+  NoDataType data;
+
+  ASSERT_TRUE(source.initialize());
+  ASSERT_TRUE(sink.initialize());
+  ASSERT_TRUE(sink.input("image").connect(source.output("image")));
+
+  while (!source.isFinished())
+  {
+    ASSERT_TRUE(source.process(data));
+    ASSERT_TRUE(sink.process(data));
+  }
+
+  EXPECT_FALSE(source.process(data));
+
+  sink.writer().flush();
+  ASSERT_EQ(output.size(), numOfFrames);
+
+  Image frame;
+  ASSERT_TRUE(output.load("out_03.png", ColourSpace::GRAY, frame));
+  EXPECT_EQ(frame(3, 3).gray(), 4);
+}